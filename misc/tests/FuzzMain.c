@@ -0,0 +1,86 @@
+/* Runs a fuzz target without libFuzzer, for compilers that don't support -fsanitize=fuzzer */
+/* Usage: fuzz_xyz_replay [file ...] */
+/*  Runs the target once on each file, or if no files are given, on random mutations of compression_vectors.h */
+#include "TestUtils.h"
+#include "../../src/ExtMath.h"
+#include "../../src/Platform.h"
+#include "../../src/Funcs.h"
+#include <stdio.h>
+#include <stddef.h>
+
+enum CONTAINER_ { CONTAINER_RAW, CONTAINER_GZIP, CONTAINER_ZLIB };
+#include "compression_vectors.h"
+#define FUZZ_ITERATIONS 20000
+int LLVMFuzzerTestOneInput(const cc_uint8* data, size_t size);
+
+/* Flips, overwrites, inserts or removes some random bytes */
+static cc_uint32 Fuzz_Mutate(RNGState* rnd, cc_uint8* data, cc_uint32 len, cc_uint32 capacity) {
+	int i, changes = 1 + Random_Next(rnd, 8);
+	cc_uint32 pos, j;
+
+	for (i = 0; i < changes && len; i++) {
+		pos = Random_Next(rnd, len);
+
+		switch (Random_Next(rnd, 4)) {
+		case 0:
+			data[pos] ^= 1 << Random_Next(rnd, 8); break;
+		case 1:
+			data[pos] = (cc_uint8)Random_Next(rnd, 256); break;
+		case 2:
+			if (len == capacity) break;
+			for (j = len; j > pos; j--) data[j] = data[j - 1];
+			data[pos] = (cc_uint8)Random_Next(rnd, 256); len++; break;
+		case 3:
+			for (j = pos; j < len - 1; j++) data[j] = data[j + 1];
+			len--; break;
+		}
+	}
+	return len;
+}
+
+static void Fuzz_Random(void) {
+	cc_uint32 capacity = sizeof(vec_zip) + 64, len, seeds = Array_Elems(vectors) + 1;
+	cc_uint8* data = (cc_uint8*)Mem_Alloc(capacity + 1, 1, "fuzz input");
+	RNGState rnd;
+	int i, seed;
+	Random_Seed(&rnd, 4321);
+
+	for (i = 0; i < FUZZ_ITERATIONS; i++) {
+		seed = i % seeds;
+
+		if (seed == Array_Elems(vectors)) {
+			len = sizeof(vec_zip);
+			Mem_Copy(data, vec_zip, len);
+		} else {
+			/* First byte selects container format for fuzz_inflate */
+			len = min(vectors[seed].size + 1, capacity);
+			data[0] = (cc_uint8)vectors[seed].container;
+			Mem_Copy(data + 1, vectors[seed].data, len - 1);
+		}
+
+		len = Fuzz_Mutate(&rnd, data, len, capacity);
+		LLVMFuzzerTestOneInput(data, len);
+	}
+	Mem_Free(data);
+	printf("Ran %d random inputs\n", FUZZ_ITERATIONS);
+}
+
+int main(int argc, char** argv) {
+	cc_uint8* data;
+	cc_uint32 len;
+	cc_result res;
+	int i;
+	Platform_Init();
+
+	if (argc <= 1) { Fuzz_Random(); return 0; }
+
+	for (i = 1; i < argc; i++) {
+		res = Test_ReadFile(argv[i], &data, &len);
+		if (res) { printf("%s: error %x reading\n", argv[i], res); return 1; }
+
+		LLVMFuzzerTestOneInput(data, len);
+		Mem_Free(data);
+	}
+	printf("Ran %d inputs\n", argc - 1);
+	return 0;
+}
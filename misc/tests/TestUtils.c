@@ -0,0 +1,266 @@
+#include "TestUtils.h"
+#include "../../src/Platform.h"
+#include "../../src/ExtMath.h"
+#include "../../src/Errors.h"
+#include "../../src/String.h"
+#include "../../src/Funcs.h"
+#include "../../src/Deflate.h"
+#include <stdio.h>
+
+/*########################################################################################################################*
+*--------------------------------------------------------Assertions-------------------------------------------------------*
+*#########################################################################################################################*/
+int Test_Failures;
+
+void Test_Fail(const char* cond, const char* file, int line) {
+	printf("FAILED: %s (%s, line %d)\n", cond, file, line);
+	Test_Failures++;
+}
+
+int Test_Finish(const char* name) {
+	if (Test_Failures) { printf("%s: %d failures\n", name, Test_Failures); return 1; }
+	printf("%s: passed\n", name);
+	return 0;
+}
+
+
+/*########################################################################################################################*
+*------------------------------------------------------Memory stream------------------------------------------------------*
+*#########################################################################################################################*/
+static cc_result MemStream_Write(struct Stream* s, const cc_uint8* data, cc_uint32 count, cc_uint32* modified) {
+	cc_uint32 pos = (cc_uint32)(s->Meta.Mem.Cur - s->Meta.Mem.Base);
+	cc_uint32 capacity = s->Meta.Mem.Left;
+
+	if (pos + count > capacity) {
+		while (pos + count > capacity) capacity *= 2;
+		s->Meta.Mem.Base = (cc_uint8*)Mem_TryRealloc(s->Meta.Mem.Base, capacity, 1);
+		if (!s->Meta.Mem.Base) return ERR_OUT_OF_MEMORY;
+
+		s->Meta.Mem.Cur  = s->Meta.Mem.Base + pos;
+		s->Meta.Mem.Left = capacity;
+	}
+
+	Mem_Copy(s->Meta.Mem.Cur, data, count);
+	s->Meta.Mem.Cur += count;
+	s->Meta.Mem.Length = max(s->Meta.Mem.Length, pos + count);
+	*modified = count;
+	return 0;
+}
+
+static cc_result MemStream_Seek(struct Stream* s, cc_uint32 position) {
+	if (position > s->Meta.Mem.Length) return ERR_INVALID_ARGUMENT;
+	s->Meta.Mem.Cur = s->Meta.Mem.Base + position;
+	return 0;
+}
+
+static cc_result MemStream_Position(struct Stream* s, cc_uint32* position) {
+	*position = (cc_uint32)(s->Meta.Mem.Cur - s->Meta.Mem.Base); return 0;
+}
+
+static cc_result MemStream_Length(struct Stream* s, cc_uint32* length) {
+	*length = s->Meta.Mem.Length; return 0;
+}
+
+static cc_result MemStream_Close(struct Stream* s) {
+	Mem_Free(s->Meta.Mem.Base);
+	s->Meta.Mem.Base = NULL;
+	return 0;
+}
+
+void MemStream_Create(struct Stream* s) {
+	Stream_Init(s);
+	s->Write    = MemStream_Write;
+	s->Seek     = MemStream_Seek;
+	s->Position = MemStream_Position;
+	s->Length   = MemStream_Length;
+	s->Close    = MemStream_Close;
+
+	s->Meta.Mem.Left   = 64 * 1024;
+	s->Meta.Mem.Base   = (cc_uint8*)Mem_Alloc(s->Meta.Mem.Left, 1, "memory stream");
+	s->Meta.Mem.Cur    = s->Meta.Mem.Base;
+	s->Meta.Mem.Length = 0;
+}
+
+void MemStream_Reset(struct Stream* s) {
+	s->Meta.Mem.Cur    = s->Meta.Mem.Base;
+	s->Meta.Mem.Length = 0;
+}
+
+cc_result Test_ReadFile(const char* path, cc_uint8** data, cc_uint32* len) {
+	cc_string str = String_FromReadonly(path);
+	struct Stream s;
+	cc_result res;
+
+	*data = NULL;
+	if ((res = Stream_OpenFile(&s, &str))) return res;
+
+	if (!(res = s.Length(&s, len))) {
+		*data = (cc_uint8*)Mem_Alloc(*len + 1, 1, "test file");
+		res   = Stream_Read(&s, *data, *len);
+	}
+	s.Close(&s);
+	return res;
+}
+
+cc_result Test_GUnzip(cc_uint8** data, cc_uint32* len) {
+	struct InflateState* inflate;
+	struct GZipHeader header;
+	struct Stream src, stream, dst;
+	cc_uint8 buffer[64 * 1024];
+	cc_uint32 read;
+	cc_result res;
+	if (*len < 2 || (*data)[0] != 0x1F || (*data)[1] != 0x8B) return 0;
+
+	Stream_ReadonlyMemory(&src, *data, *len);
+	GZipHeader_Init(&header);
+	while (!header.done) {
+		if ((res = GZipHeader_Read(&src, &header))) return res;
+	}
+
+	inflate = (struct InflateState*)Mem_Alloc(1, sizeof(struct InflateState), "inflate state");
+	Inflate_MakeStream2(&stream, inflate, &src);
+	MemStream_Create(&dst);
+
+	for (;;) {
+		if ((res = stream.Read(&stream, buffer, sizeof(buffer), &read))) break;
+		if (!read) break;
+		if ((res = Stream_Write(&dst, buffer, read))) break;
+	}
+	Mem_Free(inflate);
+
+	if (res) { dst.Close(&dst); return res; }
+	Mem_Free(*data);
+	*data = dst.Meta.Mem.Base;
+	*len  = dst.Meta.Mem.Length;
+	return 0;
+}
+
+
+/*########################################################################################################################*
+*--------------------------------------------------------Test data--------------------------------------------------------*
+*#########################################################################################################################*/
+const char* const TestData_Names[TEST_DATA_COUNT] = { "map", "text", "random" };
+
+/* Generates blocks in YZX order, just like map formats store them */
+static void TestData_MakeMap(cc_uint8* data, cc_uint32 len, RNGState* rnd) {
+	int x, y, z, width = 256, length = 256, height;
+	cc_uint8 block;
+	cc_uint32 i = 0;
+	height = (int)(len / (width * length)) + 1;
+
+	for (y = 0; y < height; y++) {
+		for (z = 0; z < length; z++) {
+			for (x = 0; x < width; x++) {
+				if (i >= len) return;
+
+				if (y > height / 2) {
+					block = 0; /* air */
+				} else if (y == height / 2) {
+					block = 2; /* grass */
+				} else if (y > height / 2 - 4) {
+					block = 3; /* dirt */
+				} else {
+					/* stone, with the occasional ore or cave */
+					block = Random_Next(rnd, 64) ? 1 : (cc_uint8)Random_Range(rnd, 14, 17);
+					if (Random_Next(rnd, 200) == 0) block = 0;
+				}
+				data[i++] = block;
+			}
+		}
+	}
+}
+
+static void TestData_MakeText(cc_uint8* data, cc_uint32 len, RNGState* rnd) {
+	static const char* const words[] = {
+		"the", "player", "joined", "game", "&ewelcome", "to", "server", "build", "block", "map",
+		"hello", "lol", "is", "anyone", "here", "&cwarning:", "griefing", "not", "allowed", "ok"
+	};
+	const char* word;
+	cc_uint32 i = 0;
+
+	while (i < len) {
+		word = words[Random_Next(rnd, Array_Elems(words))];
+		while (*word && i < len) data[i++] = *word++;
+		if (i < len) data[i++] = Random_Next(rnd, 10) ? ' ' : '\n';
+	}
+}
+
+void TestData_Make(int type, cc_uint8* data, cc_uint32 len) {
+	RNGState rnd;
+	cc_uint32 i;
+	Random_Seed(&rnd, 1234 + type);
+
+	if (type == TEST_DATA_MAP) {
+		TestData_MakeMap(data, len, &rnd);
+	} else if (type == TEST_DATA_TEXT) {
+		TestData_MakeText(data, len, &rnd);
+	} else {
+		for (i = 0; i < len; i++) data[i] = (cc_uint8)Random_Next(&rnd, 256);
+	}
+}
+
+static void TestData_MakeTerrain(struct Bitmap* bmp, RNGState* rnd) {
+	int x, y, tileX, tileY, seed, r, g, b, a;
+	RNGState tileRnd;
+
+	for (y = 0; y < bmp->height; y++) {
+		for (x = 0; x < bmp->width; x++) {
+			tileX = x / 16; tileY = y / 16;
+			/* every few tiles are repeats of each other */
+			seed  = (tileX + tileY * 16) % 37;
+			Random_Seed(&tileRnd, seed);
+
+			r = Random_Next(&tileRnd, 256); g = Random_Next(&tileRnd, 256); b = Random_Next(&tileRnd, 256);
+			a = (seed % 5) == 0 && ((x ^ y) & 4) ? 0 : 255;
+			/* slight noise makes each pixel of a tile a bit different */
+			r = min(255, r + Random_Next(rnd, 8)); g = min(255, g + Random_Next(rnd, 8));
+			b = min(255, b + Random_Next(rnd, 8));
+
+			Bitmap_GetPixel(bmp, x, y) = BitmapCol_Make(r, g, b, a);
+		}
+	}
+}
+
+static void TestData_MakeScreenshot(struct Bitmap* bmp, RNGState* rnd) {
+	int x, y, horizon = bmp->height / 2, shade;
+	BitmapCol col;
+
+	for (y = 0; y < bmp->height; y++) {
+		for (x = 0; x < bmp->width; x++) {
+			if (y < horizon) {
+				shade = 255 - (y * 96) / horizon;
+				col   = BitmapCol_Make(shade / 2, shade * 3 / 4, shade, 255);
+			} else {
+				/* blocks get smaller towards the horizon */
+				shade = (((x * 16) / (y - horizon + 8)) + ((y - horizon) / 8)) & 1 ? 40 : 0;
+				col   = BitmapCol_Make(80 + shade, 140 + shade, 40 + Random_Next(rnd, 12), 255);
+			}
+			Bitmap_GetPixel(bmp, x, y) = col;
+		}
+	}
+}
+
+void TestData_MakeBitmap(struct Bitmap* bmp, int width, int height, int type) {
+	RNGState rnd;
+	Random_Seed(&rnd, 5678 + type);
+
+	bmp->width  = width;
+	bmp->height = height;
+	bmp->scan0  = (BitmapCol*)Mem_Alloc(width * height, 4, "test bitmap");
+
+	if (type == TEST_BITMAP_TERRAIN) {
+		TestData_MakeTerrain(bmp, &rnd);
+	} else {
+		TestData_MakeScreenshot(bmp, &rnd);
+	}
+}
+
+
+/*########################################################################################################################*
+*--------------------------------------------------------Benchmarks-------------------------------------------------------*
+*#########################################################################################################################*/
+void Bench_Report(const char* name, cc_uint64 beg, cc_uint64 bytes) {
+	cc_uint64 elapsed = Stopwatch_ElapsedMicroseconds(beg, Stopwatch_Measure());
+	double mbPerSec   = elapsed ? (bytes / (1024.0 * 1024.0)) / (elapsed / 1000000.0) : 0.0;
+	printf("%-40s %9.2f ms %9.1f MB/s\n", name, elapsed / 1000.0, mbPerSec);
+}
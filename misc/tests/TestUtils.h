@@ -0,0 +1,48 @@
+#ifndef CC_TESTUTILS_H
+#define CC_TESTUTILS_H
+#include "../../src/Stream.h"
+#include "../../src/Bitmap.h"
+/* Helpers shared by the tests and benchmarks.
+   Copyright 2014-2021 ClassiCube | Licensed under BSD-3
+*/
+
+extern int Test_Failures;
+/* Logs and counts a failure if the given condition is false. */
+#define Test_Assert(cond) if (!(cond)) { Test_Fail(#cond, __FILE__, __LINE__); }
+void Test_Fail(const char* cond, const char* file, int line);
+/* Prints whether the test program passed, returning the exit code for main to return. */
+int Test_Finish(const char* name);
+
+/* Makes a stream that writes into a growable buffer in memory, and supports Seek/Position/Length. */
+/* Written data can be read back through Meta.Mem.Base, with Meta.Mem.Length bytes in total. */
+/* NOTE: You MUST call Close on the stream afterwards to free the buffer. */
+void MemStream_Create(struct Stream* s);
+/* Discards all written data, so the stream can be reused. */
+void MemStream_Reset(struct Stream* s);
+
+/* Reads the entire contents of a file into memory allocated with Mem_Alloc. */
+cc_result Test_ReadFile(const char* path, cc_uint8** data, cc_uint32* len);
+/* If the data is GZIP compressed (e.g. a .cw map), replaces it with the decompressed data. */
+cc_result Test_GUnzip(cc_uint8** data, cc_uint32* len);
+
+enum TEST_DATA_ {
+	TEST_DATA_MAP,    /* Blocks of a small generated world, similar to a saved map */
+	TEST_DATA_TEXT,   /* Lines of chat-like text made from a small vocabulary */
+	TEST_DATA_RANDOM, /* Incompressible random bytes */
+	TEST_DATA_COUNT
+};
+extern const char* const TestData_Names[TEST_DATA_COUNT];
+/* Fills the given buffer with deterministic data of the given type. */
+void TestData_Make(int type, cc_uint8* data, cc_uint32 len);
+
+enum TEST_BITMAP_ {
+	TEST_BITMAP_TERRAIN,   /* Atlas of noisy 16x16 tiles, some repeated and some transparent */
+	TEST_BITMAP_SCREENSHOT /* Sky gradient above flat coloured blocks, with no transparency */
+};
+/* Allocates and fills a bitmap with deterministic contents of the given type. */
+/* NOTE: Free bmp->scan0 with Mem_Free afterwards. */
+void TestData_MakeBitmap(struct Bitmap* bmp, int width, int height, int type);
+
+/* Prints the throughput of processing the given number of bytes, starting from the given time. */
+void Bench_Report(const char* name, cc_uint64 beg, cc_uint64 bytes);
+#endif
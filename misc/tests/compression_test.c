@@ -0,0 +1,480 @@
+/* Tests GZipHeader_Read, ZLibHeader_Read, Inflate, the Deflate streams and Zip_Extract */
+/* Data compressed by zlib is in compression_vectors.h (see make_vectors.py) */
+/* Usage: compression_test */
+#include "TestUtils.h"
+#include "../../src/Deflate.h"
+#include "../../src/Platform.h"
+#include "../../src/String.h"
+#include "../../src/Errors.h"
+#include "../../src/Utils.h"
+#include "../../src/Funcs.h"
+#include <stdio.h>
+
+enum CONTAINER_ { CONTAINER_RAW, CONTAINER_GZIP, CONTAINER_ZLIB };
+#include "compression_vectors.h"
+static struct InflateState inflate;
+
+/* NOTE: Must match generate in make_vectors.py */
+static void Vector_Generate(int kind, cc_uint8* data, cc_uint32 len) {
+	static const char* const words[] = { "the", "player", "joined", "game", "welcome", "to", "server", "build" };
+	cc_uint32 i = 0, state = 12345, value;
+	const char* word;
+
+	while (i < len) {
+		state = state * 1103515245 + 12345;
+		value = state >> 16;
+
+		if (kind == 0) {
+			data[i++] = (cc_uint8)value;
+		} else if (kind == 1) {
+			for (word = words[value % Array_Elems(words)]; *word && i < len; word++) data[i++] = *word;
+			if (i < len) data[i++] = value % 10 == 0 ? '\n' : ' ';
+		} else {
+			data[i] = (cc_uint8)((i % 251) ^ (i >> 10)); i++;
+		}
+	}
+}
+
+static cc_uint32 Test_Adler32(const cc_uint8* data, cc_uint32 len) {
+	cc_uint32 i, s1 = 1, s2 = 0;
+	for (i = 0; i < len; i++) {
+		s1 = (s1 + data[i]) % 65521;
+		s2 = (s2 + s1)      % 65521;
+	}
+	return (s2 << 16) | s1;
+}
+
+
+/*########################################################################################################################*
+*---------------------------------------------------------Helpers---------------------------------------------------------*
+*#########################################################################################################################*/
+/* Stream that only ever returns 1 byte per read, to test resuming partway through */
+static cc_result TrickleStream_Read(struct Stream* s, cc_uint8* data, cc_uint32 count, cc_uint32* modified) {
+	return s->Meta.Portion.Source->Read(s->Meta.Portion.Source, data, min(count, 1), modified);
+}
+
+static void TrickleStream_Make(struct Stream* s, struct Stream* source) {
+	Stream_Init(s);
+	s->Read = TrickleStream_Read;
+	s->Meta.Portion.Source = source;
+}
+
+/* Skips past the container header, then decompresses the data in src */
+/* Returns number of bytes decompressed, which may be less than len if there was an error */
+static cc_uint32 Test_Decompress(struct Stream* src, int container, cc_uint8* dst, cc_uint32 len, cc_result* res) {
+	struct GZipHeader gzHeader;
+	struct ZLibHeader zlHeader;
+	struct Stream stream;
+	cc_uint32 total = 0, read;
+	*res = 0;
+
+	if (container == CONTAINER_GZIP) {
+		GZipHeader_Init(&gzHeader);
+		while (!gzHeader.done && !(*res = GZipHeader_Read(src, &gzHeader))) { }
+	} else if (container == CONTAINER_ZLIB) {
+		ZLibHeader_Init(&zlHeader);
+		while (!zlHeader.done && !(*res = ZLibHeader_Read(src, &zlHeader))) { }
+	}
+	if (*res) return 0;
+
+	Inflate_MakeStream2(&stream, &inflate, src);
+	/* Read one byte past the end, to check that the data ends where it should */
+	while (total <= len) {
+		*res = stream.Read(&stream, dst + total, len + 1 - total, &read);
+		if (*res || !read) break;
+		total += read;
+	}
+	return total;
+}
+
+
+/*########################################################################################################################*
+*------------------------------------------------------Known vectors------------------------------------------------------*
+*#########################################################################################################################*/
+static void Test_Vectors(void) {
+	const struct CompressionVector* v;
+	struct Stream src, trickle;
+	cc_uint8* expected;
+	cc_uint8* actual;
+	cc_uint32 len;
+	cc_result res;
+	int i;
+
+	for (i = 0; i < Array_Elems(vectors); i++) {
+		v = &vectors[i];
+		expected = (cc_uint8*)Mem_Alloc(v->length + 1, 1, "expected data");
+		actual   = (cc_uint8*)Mem_Alloc(v->length + 1, 1, "actual data");
+		Vector_Generate(v->generator, expected, v->length);
+
+		Stream_ReadonlyMemory(&src, (void*)v->data, v->size);
+		len = Test_Decompress(&src, v->container, actual, v->length, &res);
+		Test_Assert(!res && len == v->length);
+		Test_Assert(Mem_Equal(expected, actual, min(len, v->length)));
+
+		/* Also check decompressing works when input is only given 1 byte at a time */
+		Stream_ReadonlyMemory(&src, (void*)v->data, v->size);
+		TrickleStream_Make(&trickle, &src);
+		len = Test_Decompress(&trickle, v->container, actual, v->length, &res);
+		Test_Assert(!res && len == v->length);
+		Test_Assert(Mem_Equal(expected, actual, min(len, v->length)));
+
+		if (Test_Failures) printf("  (in vector %s)\n", v->name);
+		Mem_Free(expected);
+		Mem_Free(actual);
+	}
+}
+
+/* Truncated or corrupted data must never crash, or produce data that wasn't in the original */
+static void Test_CorruptVectors(void) {
+	const struct CompressionVector* v;
+	struct Stream src;
+	cc_uint8* expected;
+	cc_uint8* actual;
+	cc_uint8* data;
+	cc_uint32 cut, len, pos;
+	cc_result res;
+	int i, bit;
+
+	for (i = 0; i < Array_Elems(vectors); i++) {
+		v = &vectors[i];
+		expected = (cc_uint8*)Mem_Alloc(v->length + 1, 1, "expected data");
+		actual   = (cc_uint8*)Mem_Alloc(v->length + 1, 1, "actual data");
+		data     = (cc_uint8*)Mem_Alloc(v->size, 1, "corrupt data");
+		Vector_Generate(v->generator, expected, v->length);
+
+		for (cut = 0; cut < v->size; cut += 1 + v->size / 64) {
+			Stream_ReadonlyMemory(&src, (void*)v->data, cut);
+			len = Test_Decompress(&src, v->container, actual, v->length, &res);
+			Test_Assert(len <= v->length && Mem_Equal(expected, actual, len));
+		}
+
+		for (bit = 0; bit < 64; bit++) {
+			Mem_Copy(data, v->data, v->size);
+			pos = (bit * 2654435761U) % v->size;
+			data[pos] ^= 1 << (bit & 7);
+
+			Stream_ReadonlyMemory(&src, data, v->size);
+			Test_Decompress(&src, v->container, actual, v->length, &res);
+		}
+
+		Mem_Free(expected);
+		Mem_Free(actual);
+		Mem_Free(data);
+	}
+}
+
+
+/*########################################################################################################################*
+*-------------------------------------------------------Headers-----------------------------------------------------------*
+*#########################################################################################################################*/
+static void Test_GZipHeader(void) {
+	/* FHCRC, FNAME and FCOMMENT flags set */
+	static const cc_uint8 header[] = {
+		0x1F, 0x8B, 0x08, 0x1A, 0,0,0,0, 0x00, 0x03, 'a','.','t','x','t',0, 'h','i',0, 0x12,0x34, 0xAB
+	};
+	static const cc_uint8 badMagic[]  = { 0x1F, 0x8C, 0x08, 0x00 };
+	static const cc_uint8 badMethod[] = { 0x1F, 0x8B, 0x07, 0x00 };
+	static const cc_uint8 extra[]     = { 0x1F, 0x8B, 0x08, 0x04 };
+	struct GZipHeader gz;
+	struct Stream src;
+	cc_result res = 0;
+	cc_uint8 next;
+	int i;
+
+	/* Header is read incrementally, as data arrives */
+	GZipHeader_Init(&gz);
+	for (i = 0; i < sizeof(header) - 1 && !gz.done; i++) {
+		Stream_ReadonlyMemory(&src, (void*)&header[i], 1);
+		res = GZipHeader_Read(&src, &gz);
+		if (!gz.done) Test_Assert(res == ERR_END_OF_STREAM);
+	}
+	Test_Assert(gz.done && i == sizeof(header) - 1);
+	Stream_ReadonlyMemory(&src, (void*)&header[i], 1);
+	Test_Assert(!Stream_Read(&src, &next, 1) && next == 0xAB);
+
+	Stream_ReadonlyMemory(&src, (void*)badMagic, sizeof(badMagic));
+	GZipHeader_Init(&gz);
+	Test_Assert(GZipHeader_Read(&src, &gz) == GZIP_ERR_HEADER2);
+
+	Stream_ReadonlyMemory(&src, (void*)badMethod, sizeof(badMethod));
+	GZipHeader_Init(&gz);
+	Test_Assert(GZipHeader_Read(&src, &gz) == GZIP_ERR_METHOD);
+
+	/* FEXTRA isn't supported */
+	Stream_ReadonlyMemory(&src, (void*)extra, sizeof(extra));
+	GZipHeader_Init(&gz);
+	Test_Assert(GZipHeader_Read(&src, &gz) == GZIP_ERR_FLAGS);
+}
+
+static void Test_ZLibHeader(void) {
+	static const cc_uint8 valid[]     = { 0x78, 0x9C };
+	static const cc_uint8 badMethod[] = { 0x79, 0x9C };
+	static const cc_uint8 dict[]      = { 0x78, 0xBB };
+	struct ZLibHeader zl;
+	struct Stream src;
+
+	Stream_ReadonlyMemory(&src, (void*)valid, sizeof(valid));
+	ZLibHeader_Init(&zl);
+	Test_Assert(!ZLibHeader_Read(&src, &zl) && zl.done);
+
+	Stream_ReadonlyMemory(&src, (void*)badMethod, sizeof(badMethod));
+	ZLibHeader_Init(&zl);
+	Test_Assert(ZLibHeader_Read(&src, &zl) == ZLIB_ERR_METHOD);
+
+	/* Preset dictionaries aren't supported */
+	Stream_ReadonlyMemory(&src, (void*)dict, sizeof(dict));
+	ZLibHeader_Init(&zl);
+	Test_Assert(ZLibHeader_Read(&src, &zl) == ZLIB_ERR_FLAGS);
+}
+
+
+/*########################################################################################################################*
+*-------------------------------------------------------Round trip--------------------------------------------------------*
+*#########################################################################################################################*/
+static union { struct DeflateState deflate; struct GZipState gzip; struct ZLibState zlib; } compressor;
+
+/* Compresses then decompresses the data, checking the output is the same as the input */
+static void Test_RoundTripOnce(const cc_uint8* data, cc_uint32 len, int container, int level, cc_uint32 chunk) {
+	struct Stream dst, stream, src;
+	cc_uint32 i, count, out;
+	cc_uint8* actual;
+	cc_uint8* footer;
+	cc_result res = 0;
+
+	MemStream_Create(&dst);
+	if (container == CONTAINER_GZIP) {
+		GZip_MakeStream(&stream, &compressor.gzip, &dst);
+	} else if (container == CONTAINER_ZLIB) {
+		ZLib_MakeStream(&stream, &compressor.zlib, &dst);
+	} else {
+		Deflate_MakeStream(&stream, &compressor.deflate, &dst);
+	}
+	compressor.deflate.Level = level;
+
+	for (i = 0; i < len && !res; i += count) {
+		count = min(chunk, len - i);
+		res   = Stream_Write(&stream, data + i, count);
+	}
+	if (!res) res = stream.Close(&stream);
+	Test_Assert(!res);
+
+	actual = (cc_uint8*)Mem_Alloc(len + 1, 1, "actual data");
+	Stream_ReadonlyMemory(&src, dst.Meta.Mem.Base, dst.Meta.Mem.Length);
+	out = Test_Decompress(&src, container, actual, len, &res);
+	Test_Assert(!res && out == len && Mem_Equal(data, actual, len));
+
+	/* Check the footer as well */
+	footer = dst.Meta.Mem.Base + dst.Meta.Mem.Length;
+	if (container == CONTAINER_GZIP) {
+		Test_Assert(Stream_GetU32_LE(footer - 8) == Utils_CRC32(data, len));
+		Test_Assert(Stream_GetU32_LE(footer - 4) == len);
+	} else if (container == CONTAINER_ZLIB) {
+		Test_Assert(Stream_GetU32_BE(footer - 4) == Test_Adler32(data, len));
+	}
+
+	if (Test_Failures) printf("  (round trip of %u bytes, container %d, level %d, chunk %u)\n", len, container, level, chunk);
+	Mem_Free(actual);
+	dst.Close(&dst);
+}
+
+static void Test_RoundTrip(void) {
+	static const cc_uint8 levels[]  = { DEFLATE_LEVEL_FAST, DEFLATE_LEVEL_DEFAULT, DEFLATE_LEVEL_MAX, DEFLATE_LEVEL_LIGHT };
+	/* Sizes around the boundaries of the compressor's input buffer and blocks */
+	static const cc_uint32 sizes[]  = { 0, 1, 2, 3, 257, 16383, 16384, 16385, 32768, 65536 + 7, 300000 };
+	static const cc_uint32 chunks[] = { 7, 70000 };
+	int type, level, size, container, chunk;
+	cc_uint8* data = (cc_uint8*)Mem_Alloc(300000, 1, "test data");
+
+	for (type = 0; type < TEST_DATA_COUNT; type++) {
+		TestData_Make(type, data, 300000);
+
+		for (size = 0; size < Array_Elems(sizes); size++) {
+			for (level = 0; level < Array_Elems(levels); level++) {
+				for (container = CONTAINER_RAW; container <= CONTAINER_ZLIB; container++) {
+					for (chunk = 0; chunk < Array_Elems(chunks); chunk++) {
+						Test_RoundTripOnce(data, sizes[size], container, levels[level], chunks[chunk]);
+					}
+				}
+			}
+		}
+	}
+	Mem_Free(data);
+}
+
+static void Test_ParallelRoundTrip(void) {
+	cc_uint32 len = 1024 * 1024 + 13, out;
+	struct Stream dst, stream, src;
+	cc_uint8* data;
+	cc_uint8* actual;
+	cc_result res;
+	int workers;
+
+	data   = (cc_uint8*)Mem_Alloc(len,     1, "test data");
+	actual = (cc_uint8*)Mem_Alloc(len + 1, 1, "actual data");
+	TestData_Make(TEST_DATA_MAP, data, len);
+
+	for (workers = 1; workers <= 4; workers *= 2) {
+		MemStream_Create(&dst);
+		res = GZip_MakeParallelStream(&stream, &dst, workers);
+		Test_Assert(!res);
+		if (res) { dst.Close(&dst); break; }
+
+		res = Stream_Write(&stream, data, len);
+		Test_Assert(!stream.Close(&stream) && !res);
+
+		Stream_ReadonlyMemory(&src, dst.Meta.Mem.Base, dst.Meta.Mem.Length);
+		out = Test_Decompress(&src, CONTAINER_GZIP, actual, len, &res);
+		Test_Assert(!res && out == len && Mem_Equal(data, actual, len));
+		dst.Close(&dst);
+	}
+	Mem_Free(data);
+	Mem_Free(actual);
+}
+
+
+/*########################################################################################################################*
+*----------------------------------------------------------Zip------------------------------------------------------------*
+*#########################################################################################################################*/
+static int zipEntries;
+static cc_result Test_ProcessEntry(const cc_string* path, struct Stream* data, struct ZipState* state) {
+	cc_uint8 expected[5000], actual[5001];
+	cc_uint32 len = 0, read;
+	cc_result res;
+
+	for (;;) {
+		res = data->Read(data, actual + len, sizeof(actual) - len, &read);
+		if (res || !read) break;
+		len += read;
+	}
+	Test_Assert(!res);
+
+	if (String_CaselessEqualsConst(path, "textures/terrain.png")) {
+		Vector_Generate(2, expected, 5000);
+		Test_Assert(len == 5000 && Mem_Equal(expected, actual, len));
+	} else if (String_CaselessEqualsConst(path, "readme.txt")) {
+		Vector_Generate(1, expected, 200);
+		Test_Assert(len == 200 && Mem_Equal(expected, actual, len));
+	} else {
+		Test_Assert(len == 0);
+	}
+	zipEntries++;
+	return 0;
+}
+
+static cc_bool Test_SelectTextures(const cc_string* path) {
+	return String_CaselessStarts(path, &(cc_string)String_FromConst("textures/"));
+}
+
+static void Test_ZipExtract(void) {
+	static struct ZipState state;
+	struct Stream src;
+	cc_uint32 cut;
+	cc_result res;
+
+	Stream_ReadonlyMemory(&src, (void*)vec_zip, sizeof(vec_zip));
+	Zip_Init(&state, &src);
+	state.ProcessEntry = Test_ProcessEntry;
+	zipEntries = 0;
+	Test_Assert(!Zip_Extract(&state) && zipEntries == 4);
+
+	Stream_ReadonlyMemory(&src, (void*)vec_zip, sizeof(vec_zip));
+	Zip_Init(&state, &src);
+	state.ProcessEntry = Test_ProcessEntry;
+	state.SelectEntry  = Test_SelectTextures;
+	zipEntries = 0;
+	Test_Assert(!Zip_Extract(&state) && zipEntries == 2);
+
+	/* Truncated archives must fail cleanly */
+	for (cut = 0; cut < sizeof(vec_zip); cut += 37) {
+		Stream_ReadonlyMemory(&src, (void*)vec_zip, cut);
+		Zip_Init(&state, &src);
+		state.ProcessEntry = Test_ProcessEntry;
+		res = Zip_Extract(&state);
+		Test_Assert(res != 0);
+	}
+}
+
+static void Test_ZipIndex(void) {
+	static const cc_string terrain = String_FromConst("textures/terrain.png");
+	static const cc_string missing = String_FromConst("textures/missing.png");
+	struct ZipIndexEntry* entry;
+	struct ZipIndex index;
+	struct Stream src;
+	cc_uint8 expected[5000];
+	cc_uint8* raw;
+	cc_uint8* data;
+	int i;
+
+	Stream_ReadonlyMemory(&src, (void*)vec_zip, sizeof(vec_zip));
+	Test_Assert(!ZipIndex_Load(&index, &src) && index.count == 4);
+	Test_Assert(ZipIndex_Find(&index, &missing) == -1);
+
+	i = ZipIndex_Find(&index, &terrain);
+	Test_Assert(i >= 0);
+	if (i >= 0) {
+		entry = &index.entries[i];
+		raw   = (cc_uint8*)Mem_Alloc(entry->Base.CompressedSize   + 1, 1, "raw entry");
+		data  = (cc_uint8*)Mem_Alloc(entry->Base.UncompressedSize + 1, 1, "entry data");
+
+		Test_Assert(!ZipIndex_ReadRaw(&index, i, raw));
+		Test_Assert(!ZipIndex_Decompress(entry, raw, data));
+		Vector_Generate(2, expected, 5000);
+		Test_Assert(entry->Base.UncompressedSize == 5000 && Mem_Equal(expected, data, 5000));
+		Test_Assert(Utils_CRC32(data, 5000) == entry->Base.CRC32);
+
+		Mem_Free(raw);
+		Mem_Free(data);
+	}
+	ZipIndex_Free(&index);
+}
+
+
+/*########################################################################################################################*
+*----------------------------------------------------------Main-----------------------------------------------------------*
+*#########################################################################################################################*/
+/* Reports overall throughput, so that large speed regressions are noticeable */
+static void Test_Throughput(void) {
+	cc_uint32 len = 8 * 1024 * 1024, out;
+	struct Stream dst, stream, src;
+	cc_uint8* data;
+	cc_uint8* actual;
+	cc_uint64 beg;
+	cc_result res;
+
+	data   = (cc_uint8*)Mem_Alloc(len,     1, "test data");
+	actual = (cc_uint8*)Mem_Alloc(len + 1, 1, "actual data");
+	TestData_Make(TEST_DATA_MAP, data, len);
+	MemStream_Create(&dst);
+
+	beg = Stopwatch_Measure();
+	GZip_MakeStream(&stream, &compressor.gzip, &dst);
+	res = Stream_Write(&stream, data, len);
+	Test_Assert(!stream.Close(&stream) && !res);
+	Bench_Report("GZip compress map data", beg, len);
+
+	beg = Stopwatch_Measure();
+	Stream_ReadonlyMemory(&src, dst.Meta.Mem.Base, dst.Meta.Mem.Length);
+	out = Test_Decompress(&src, CONTAINER_GZIP, actual, len, &res);
+	Bench_Report("GZip decompress map data", beg, len);
+	Test_Assert(!res && out == len && Mem_Equal(data, actual, len));
+
+	dst.Close(&dst);
+	Mem_Free(data);
+	Mem_Free(actual);
+}
+
+int main(int argc, char** argv) {
+	Platform_Init();
+	Deflate_Init();
+
+	Test_Vectors();
+	Test_CorruptVectors();
+	Test_GZipHeader();
+	Test_ZLibHeader();
+	Test_RoundTrip();
+	Test_ParallelRoundTrip();
+	Test_ZipExtract();
+	Test_ZipIndex();
+	Test_Throughput();
+	return Test_Finish("compression_test");
+}
@@ -0,0 +1,715 @@
+/* Generated by make_vectors.py - do not edit */
+static const cc_uint8 vec_gzip_empty[20] = {
+	0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00,
+};
+static const cc_uint8 vec_gzip_named[691] = {
+	0x1F, 0x8B, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x63, 0x68, 0x61, 0x74, 0x2E, 0x74,
+	0x78, 0x74, 0x00, 0x85, 0x57, 0x59, 0x52, 0xC5, 0x30, 0x0C, 0xFB, 0xCF, 0x29, 0x7A, 0x35, 0x96,
+	0x0E, 0x81, 0x79, 0x50, 0x86, 0xED, 0x0D, 0xB7, 0xA7, 0x8B, 0xE3, 0x48, 0x8A, 0xCA, 0xFB, 0xE9,
+	0x96, 0xC4, 0xB1, 0x65, 0x59, 0x71, 0xAF, 0xF3, 0xE5, 0x61, 0x79, 0x9D, 0xA7, 0x6B, 0xDC, 0xBF,
+	0x96, 0xE9, 0x65, 0x79, 0x7E, 0x9B, 0x1F, 0xA7, 0xFB, 0xEF, 0xE7, 0xCB, 0xE3, 0xF6, 0x9E, 0x9F,
+	0x4A, 0xDC, 0xD6, 0x0F, 0x6D, 0xFA, 0xD3, 0xDD, 0x7A, 0xF9, 0x9C, 0x3F, 0x7E, 0xE6, 0x8F, 0x58,
+	0xB0, 0x7F, 0xF9, 0xAA, 0xF3, 0xF4, 0x7E, 0xB9, 0xFB, 0x5D, 0xBF, 0xC6, 0xCC, 0x6D, 0xD1, 0xF6,
+	0xF5, 0x98, 0x14, 0x63, 0xB1, 0x45, 0xDD, 0xB7, 0xBD, 0xB2, 0x27, 0x65, 0xF4, 0x08, 0x36, 0x2B,
+	0xDB, 0xA2, 0xFD, 0x3D, 0xC6, 0xC2, 0xB5, 0xC3, 0xE2, 0x71, 0x25, 0xB7, 0xC0, 0xA3, 0xB8, 0x85,
+	0xA1, 0x78, 0x5B, 0xC7, 0x4B, 0xBA, 0x7E, 0x04, 0xDD, 0x1C, 0xE0, 0x65, 0xE4, 0x7A, 0x6C, 0x11,
+	0xB7, 0x70, 0x25, 0x0C, 0x1F, 0x33, 0xC4, 0xC8, 0x61, 0x79, 0xDF, 0x28, 0x81, 0xA9, 0x19, 0x04,
+	0x43, 0xC6, 0x20, 0x93, 0x71, 0x03, 0x79, 0x8C, 0x1B, 0x20, 0xD7, 0x4F, 0x14, 0xF2, 0x80, 0x7E,
+	0x21, 0x6B, 0xBA, 0x7B, 0xBB, 0x1F, 0xA3, 0xEC, 0x06, 0xEC, 0x06, 0x00, 0xC7, 0x1C, 0x09, 0x9D,
+	0x3D, 0xCF, 0xFC, 0x21, 0x83, 0x9A, 0xC7, 0x94, 0x53, 0xC4, 0x6C, 0xBF, 0x24, 0x31, 0x39, 0xF5,
+	0x6D, 0x76, 0x55, 0xAC, 0x10, 0xED, 0x7D, 0x98, 0x3D, 0x41, 0x07, 0x08, 0xC9, 0x7A, 0xE4, 0x26,
+	0x88, 0x9B, 0xE4, 0x40, 0x1C, 0x92, 0xA4, 0xEC, 0x31, 0x6E, 0x06, 0x29, 0xB2, 0x48, 0x8E, 0x34,
+	0x28, 0x14, 0x6D, 0x6C, 0xCF, 0x6B, 0x21, 0x0A, 0x32, 0x16, 0x93, 0x2D, 0x63, 0x83, 0x96, 0xCD,
+	0xA8, 0x90, 0x06, 0xF9, 0x5C, 0x3C, 0x1D, 0x21, 0x73, 0x54, 0xC5, 0x96, 0xAE, 0x4C, 0xB5, 0x4E,
+	0x41, 0xC1, 0x4D, 0x4C, 0x08, 0x7E, 0xEC, 0xC7, 0x96, 0x10, 0x10, 0x05, 0xA5, 0x01, 0x24, 0x3E,
+	0x87, 0xA8, 0xD0, 0x2C, 0x3B, 0x13, 0x0F, 0x55, 0x0B, 0xE4, 0x93, 0x48, 0x52, 0xB9, 0x55, 0x84,
+	0xD6, 0x66, 0x4F, 0xA9, 0x44, 0x89, 0x9A, 0x25, 0xCE, 0xA1, 0xA4, 0xA6, 0x0A, 0xB7, 0xD7, 0x2E,
+	0xD0, 0xB5, 0xCD, 0x1C, 0x8B, 0xD0, 0x18, 0xB7, 0xD5, 0x2E, 0x6A, 0x0D, 0xC1, 0xF7, 0x38, 0x80,
+	0x8F, 0x05, 0x65, 0x7D, 0xC1, 0x08, 0x25, 0xA3, 0xB4, 0xF3, 0xCD, 0x2A, 0x18, 0xE4, 0xB2, 0x12,
+	0xED, 0x70, 0x63, 0x12, 0x31, 0x96, 0x98, 0xBE, 0xAA, 0xF0, 0x00, 0x44, 0x95, 0xE5, 0xCC, 0xEA,
+	0xC1, 0xB4, 0x1D, 0x18, 0x9F, 0xA1, 0x9E, 0xB8, 0x4D, 0x95, 0x0B, 0x31, 0xD0, 0x69, 0x01, 0xEE,
+	0xE9, 0x61, 0x89, 0x8F, 0x52, 0x32, 0x16, 0x43, 0x8A, 0x4B, 0x64, 0xD3, 0x8B, 0xB1, 0x47, 0x93,
+	0x45, 0xAD, 0x73, 0x09, 0xE2, 0x0A, 0x8F, 0x05, 0xC9, 0xE5, 0x24, 0x53, 0x2E, 0x3B, 0xE4, 0x39,
+	0x23, 0xCC, 0x0C, 0x9F, 0xFE, 0x57, 0x55, 0x2E, 0x8E, 0xF3, 0xEA, 0xB9, 0xA5, 0xF3, 0xF8, 0xDC,
+	0x43, 0xE6, 0xB2, 0xF0, 0x5A, 0xA6, 0x60, 0x2E, 0x18, 0x3E, 0x90, 0xCC, 0x95, 0x22, 0x21, 0x03,
+	0x7B, 0x8F, 0xED, 0x0E, 0x9C, 0xCC, 0x6C, 0xBA, 0x3B, 0x8B, 0x9C, 0x20, 0xC3, 0xA6, 0xFA, 0xBB,
+	0xFB, 0x24, 0x00, 0x34, 0xC8, 0x0E, 0xF7, 0x7E, 0xA8, 0x1A, 0x2D, 0x6E, 0x4A, 0x10, 0xD1, 0x77,
+	0xBB, 0xD9, 0x4A, 0x59, 0x22, 0xDA, 0xA3, 0x83, 0xE3, 0x03, 0x28, 0x06, 0x2E, 0x0D, 0xA7, 0x0F,
+	0x9D, 0x67, 0x3D, 0xC6, 0xD4, 0xAA, 0xB3, 0x3E, 0x4E, 0x35, 0x1D, 0xE9, 0x6E, 0x72, 0xA1, 0x3D,
+	0xB0, 0xEC, 0x04, 0x89, 0xE4, 0x58, 0x04, 0xB6, 0x84, 0x6C, 0xCC, 0x3C, 0x36, 0x82, 0x6D, 0x5E,
+	0x25, 0xCB, 0xC3, 0xD9, 0xDF, 0xFA, 0x05, 0xEE, 0x85, 0x0B, 0x22, 0x63, 0x9B, 0x51, 0x54, 0x1F,
+	0x7C, 0xD6, 0x23, 0xD5, 0x76, 0x6E, 0x08, 0x34, 0x77, 0x60, 0x52, 0x27, 0xD4, 0xD0, 0x50, 0xB6,
+	0xAA, 0x17, 0x9C, 0x05, 0x29, 0x6F, 0xCE, 0x8A, 0xFF, 0x9B, 0x06, 0xC5, 0xE8, 0xFC, 0xCC, 0x01,
+	0x9D, 0x92, 0x4E, 0x93, 0x32, 0xE0, 0xDA, 0xA7, 0x1B, 0x3D, 0xF2, 0x88, 0xFC, 0x99, 0xD3, 0x66,
+	0xA6, 0xFE, 0xD2, 0x48, 0x93, 0x36, 0x16, 0x79, 0x67, 0x9E, 0xC0, 0x4A, 0xBE, 0x82, 0x48, 0x51,
+	0x59, 0xD0, 0xA8, 0x73, 0x2B, 0xE7, 0xF8, 0xEE, 0xAC, 0x60, 0x97, 0x6B, 0x8E, 0x17, 0x5F, 0x6E,
+	0xEA, 0x79, 0x94, 0x83, 0xAC, 0x1F, 0xBA, 0x19, 0xA3, 0xF2, 0xDA, 0xBB, 0xA2, 0x1B, 0xA6, 0xBA,
+	0xF4, 0xEC, 0x67, 0xEA, 0x4A, 0xAF, 0xA8, 0xD9, 0x1A, 0xFF, 0x1A, 0xEC, 0x4F, 0xA4, 0xD5, 0x36,
+	0x3C, 0x19, 0x87, 0x9F, 0xB3, 0x51, 0x5F, 0xE4, 0x6F, 0xF8, 0x0F, 0x3D, 0xEA, 0xA9, 0x13, 0xA0,
+	0x0F, 0x00, 0x00,
+};
+static const cc_uint8 vec_zlib_fast[815] = {
+	0x78, 0x01, 0xED, 0xD2, 0x43, 0x92, 0x24, 0x00, 0x00, 0x00, 0xC1, 0xB1, 0x6D, 0xDB, 0xB6, 0x6D,
+	0xDB, 0xB6, 0x6D, 0xDB, 0xB6, 0x6D, 0xDB, 0xB6, 0x6D, 0xDB, 0x36, 0x2F, 0xFB, 0x8E, 0x8D, 0xE9,
+	0x27, 0x54, 0x64, 0x01, 0x01, 0x83, 0x80, 0x82, 0x81, 0x43, 0x40, 0x42, 0x41, 0xC3, 0xC0, 0xC2,
+	0xC1, 0x23, 0x20, 0x22, 0x21, 0xA3, 0xA0, 0xA2, 0xA1, 0x63, 0x60, 0x62, 0x61, 0xE3, 0xE0, 0xE2,
+	0xE1, 0x13, 0x10, 0x12, 0x11, 0x93, 0x90, 0x92, 0x91, 0x53, 0x50, 0x52, 0x51, 0xD3, 0xD0, 0xD2,
+	0xD1, 0x33, 0x30, 0x32, 0x31, 0xB3, 0xB0, 0xB2, 0xB1, 0x73, 0x70, 0x72, 0x71, 0xF3, 0xF0, 0xF2,
+	0xF1, 0x0B, 0x08, 0x0A, 0x09, 0x8B, 0x88, 0x8A, 0x89, 0x4B, 0x48, 0x4A, 0x49, 0xCB, 0xC8, 0xCA,
+	0xC9, 0x2B, 0x28, 0x2A, 0x29, 0xAB, 0xA8, 0xAA, 0xA9, 0x6B, 0x68, 0x6A, 0x69, 0xEB, 0xE8, 0xEA,
+	0xE9, 0x1B, 0x18, 0x1A, 0x19, 0x9B, 0x98, 0x9A, 0x99, 0x5B, 0x58, 0x5A, 0x59, 0xDB, 0xD8, 0xDA,
+	0xD9, 0x3B, 0x38, 0x3A, 0x39, 0xBB, 0xB8, 0xBA, 0xB9, 0x7B, 0x78, 0x7A, 0x79, 0xFB, 0xF8, 0xFA,
+	0xF9, 0x07, 0x04, 0x06, 0x05, 0x87, 0x84, 0x86, 0x85, 0x47, 0x44, 0x46, 0x45, 0xC7, 0xC4, 0xC6,
+	0xC5, 0x27, 0x24, 0x26, 0x25, 0xA7, 0xA4, 0xA6, 0xA5, 0x67, 0x64, 0x66, 0x65, 0xE7, 0xE4, 0xE6,
+	0xE5, 0x17, 0x14, 0x16, 0x15, 0x97, 0x94, 0x96, 0x95, 0x57, 0x54, 0x56, 0x55, 0xD7, 0xD4, 0xD6,
+	0xD5, 0x37, 0x34, 0x36, 0x35, 0xB7, 0xB4, 0xB6, 0xB5, 0x77, 0x74, 0x76, 0x75, 0xF7, 0xF4, 0xF6,
+	0xF5, 0x0F, 0x0C, 0x0E, 0x0D, 0x8F, 0x8C, 0x8E, 0x8D, 0x4F, 0x4C, 0x4E, 0x4D, 0xCF, 0xCC, 0xCE,
+	0xCD, 0x2F, 0x2C, 0x2E, 0x2D, 0xAF, 0xAC, 0xAE, 0xAD, 0x6F, 0x6C, 0x6E, 0x6D, 0xEF, 0xEC, 0xEE,
+	0xED, 0x1F, 0x1C, 0x1E, 0x1D, 0x9F, 0x9C, 0x9E, 0x9D, 0x5F, 0x5C, 0x5E, 0x5D, 0xDF, 0xDC, 0xDE,
+	0xDD, 0x3F, 0x3C, 0x3E, 0x3D, 0xBF, 0xBC, 0xBE, 0xBD, 0x7F, 0x7C, 0x7E, 0x7D, 0xFF, 0x00, 0x01,
+	0xD2, 0x01, 0xEA, 0x7F, 0x7D, 0x78, 0x74, 0x34, 0x4C, 0x0C, 0x6C, 0x2C, 0x5C, 0x1C, 0x7C, 0x3C,
+	0x42, 0x02, 0x62, 0x22, 0x52, 0x12, 0x72, 0x32, 0x4A, 0x0A, 0x6A, 0x2A, 0x5A, 0x1A, 0x7A, 0x3A,
+	0x46, 0x06, 0x66, 0x26, 0x56, 0x16, 0x76, 0x36, 0x4E, 0x0E, 0x6E, 0x2E, 0x5E, 0x1E, 0x7E, 0x3E,
+	0x41, 0x01, 0x61, 0x21, 0x51, 0x11, 0x71, 0x31, 0x49, 0x09, 0x69, 0x29, 0x59, 0x19, 0x79, 0x39,
+	0x45, 0x05, 0x65, 0x25, 0x55, 0x15, 0x75, 0x35, 0x4D, 0x0D, 0x6D, 0x2D, 0x5D, 0x1D, 0x7D, 0x3D,
+	0x43, 0x03, 0x63, 0x23, 0x53, 0x13, 0x73, 0x33, 0x4B, 0x0B, 0x6B, 0x2B, 0x5B, 0x1B, 0x7B, 0x3B,
+	0x47, 0x07, 0x67, 0x27, 0x57, 0x17, 0x77, 0x37, 0x4F, 0x0F, 0x6F, 0x2F, 0x5F, 0x1F, 0x7F, 0xBF,
+	0xC0, 0x80, 0xE0, 0xA0, 0xD0, 0x90, 0xF0, 0xB0, 0xC8, 0x88, 0xE8, 0xA8, 0xD8, 0x98, 0xF8, 0xB8,
+	0xC4, 0x84, 0xE4, 0xA4, 0xD4, 0x94, 0xF4, 0xB4, 0xCC, 0x8C, 0xEC, 0xAC, 0xDC, 0x9C, 0xFC, 0xBC,
+	0xC2, 0x82, 0xE2, 0xA2, 0xD2, 0x92, 0xF2, 0xB2, 0xCA, 0x8A, 0xEA, 0xAA, 0xDA, 0x9A, 0xFA, 0xBA,
+	0xC6, 0x86, 0xE6, 0xA6, 0xD6, 0x96, 0xF6, 0xB6, 0xCE, 0x8E, 0xEE, 0xAE, 0xDE, 0x9E, 0xFE, 0xBE,
+	0xC1, 0x81, 0xE1, 0xA1, 0xD1, 0x91, 0xF1, 0xB1, 0xC9, 0x89, 0xE9, 0xA9, 0xD9, 0x99, 0xF9, 0xB9,
+	0xC5, 0x85, 0xE5, 0xA5, 0xD5, 0x95, 0xF5, 0xB5, 0xCD, 0x8D, 0xED, 0xAD, 0xDD, 0x9D, 0xFD, 0xBD,
+	0xC3, 0x83, 0xE3, 0xA3, 0xD3, 0x93, 0xF3, 0xB3, 0xCB, 0x8B, 0xEB, 0xAB, 0xDB, 0x9B, 0xFB, 0xBB,
+	0xC7, 0x87, 0xE7, 0xA7, 0xD7, 0x97, 0xF7, 0xB7, 0xCF, 0x8F, 0xEF, 0xAF, 0x5F, 0x60, 0x20, 0x50,
+	0x10, 0x70, 0x30, 0x48, 0x08, 0x68, 0x28, 0x58, 0x18, 0x78, 0x38, 0x44, 0x04, 0x64, 0x24, 0x54,
+	0x14, 0x40, 0x3A, 0x40, 0xFD, 0xCF, 0x0F, 0x4F, 0x43, 0x4B, 0x45, 0xCD, 0xC0, 0x48, 0x47, 0xCF,
+	0xC2, 0xCA, 0xC4, 0xCC, 0xC1, 0xC9, 0xC6, 0xCE, 0xC3, 0xCB, 0xC5, 0x2D, 0x20, 0xC8, 0xC7, 0x2F,
+	0x22, 0x2A, 0x24, 0x2C, 0x21, 0x29, 0x26, 0x2E, 0x23, 0x2B, 0x25, 0xAD, 0xA0, 0x28, 0x27, 0xAF,
+	0xA2, 0xAA, 0xA4, 0xAC, 0xA1, 0xA9, 0xA6, 0xAE, 0xA3, 0xAB, 0xA5, 0x6D, 0x60, 0xA8, 0xA7, 0x6F,
+	0x62, 0x6A, 0x64, 0x6C, 0x61, 0x69, 0x66, 0x6E, 0x63, 0x6B, 0x65, 0xED, 0xE0, 0x68, 0x67, 0xEF,
+	0xE2, 0xEA, 0xE4, 0xEC, 0xE1, 0xE9, 0xE6, 0xEE, 0xE3, 0xEB, 0xE5, 0x1D, 0x10, 0xE8, 0xE7, 0x1F,
+	0x12, 0x1A, 0x14, 0x1C, 0x11, 0x19, 0x16, 0x1E, 0x13, 0x1B, 0x15, 0x9D, 0x90, 0x18, 0x17, 0x9F,
+	0x92, 0x9A, 0x94, 0x9C, 0x91, 0x99, 0x96, 0x9E, 0x93, 0x9B, 0x95, 0x5D, 0x50, 0x98, 0x97, 0x5F,
+	0x52, 0x5A, 0x54, 0x5C, 0x51, 0x59, 0x56, 0x5E, 0x53, 0x5B, 0x55, 0xDD, 0xD0, 0x58, 0x57, 0xDF,
+	0xD2, 0xDA, 0xD4, 0xDC, 0xD1, 0xD9, 0xD6, 0xDE, 0xD3, 0xDB, 0xD5, 0x3D, 0x30, 0xD8, 0xD7, 0x3F,
+	0x32, 0x3A, 0x34, 0x3C, 0x31, 0x39, 0x36, 0x3E, 0x33, 0x3B, 0x35, 0xBD, 0xB0, 0x38, 0x37, 0xBF,
+	0xB2, 0xBA, 0xB4, 0xBC, 0xB1, 0xB9, 0xB6, 0xBE, 0xB3, 0xBB, 0xB5, 0x7D, 0x70, 0xB8, 0xB7, 0x7F,
+	0x72, 0x7A, 0x74, 0x7C, 0x71, 0x79, 0x76, 0x7E, 0x73, 0x7B, 0x75, 0xFD, 0xF0, 0x78, 0x77, 0xFF,
+	0xF2, 0xFA, 0xF4, 0xFC, 0xF1, 0xF9, 0xF6, 0xFE, 0xF3, 0xFB, 0x05, 0x02, 0x0A, 0x04, 0x0C, 0x01,
+	0x09, 0x06, 0x0E, 0x03, 0x0B, 0x05, 0x8D, 0x80, 0x08, 0x07, 0x8F, 0x82, 0x8A, 0x84, 0x8C, 0x81,
+	0x89, 0x86, 0x8E, 0x83, 0x8B, 0x85, 0x4D, 0x40, 0x88, 0x87, 0x4F, 0x42, 0x4A, 0x44, 0x4C, 0x41,
+	0x49, 0x46, 0x0E, 0x48, 0x07, 0xA8, 0xFF, 0xB7, 0xC3, 0xFF, 0x03, 0xE2, 0xF8, 0xB3, 0x96,
+};
+static const cc_uint8 vec_raw_stored[305] = {
+	0x01, 0x2C, 0x01, 0xD3, 0xFE, 0xDC, 0x04, 0x65, 0xAA, 0x1F, 0xAD, 0x1D, 0x5A, 0xDA, 0xE5, 0xAC,
+	0x1B, 0x1E, 0x5F, 0x13, 0x70, 0x79, 0x6C, 0xFD, 0x10, 0xFF, 0x19, 0xAF, 0x60, 0x1D, 0x04, 0xAC,
+	0xB4, 0x1D, 0x02, 0x2B, 0x46, 0x78, 0x73, 0x3A, 0xF2, 0xDF, 0x5F, 0xAE, 0xB7, 0x08, 0x59, 0xD1,
+	0xEE, 0x39, 0x10, 0xCB, 0x48, 0x95, 0xB5, 0xCC, 0x89, 0x29, 0x11, 0xFF, 0x06, 0xB6, 0x62, 0x2E,
+	0xDF, 0x3C, 0xF9, 0x35, 0xFD, 0x4B, 0x94, 0x28, 0xCA, 0x09, 0x7C, 0x44, 0xB3, 0x02, 0x5E, 0x96,
+	0x5F, 0xB3, 0xEA, 0x6D, 0xAC, 0xD4, 0x2D, 0x81, 0x6E, 0x69, 0xAF, 0xE0, 0xE6, 0x87, 0x4C, 0x9C,
+	0x04, 0xE7, 0xD2, 0x36, 0x5D, 0x2C, 0x60, 0xC9, 0xEA, 0xF4, 0x79, 0xF6, 0x86, 0xA0, 0xEB, 0x93,
+	0x26, 0xE4, 0x62, 0x12, 0xD5, 0x0D, 0xCB, 0xB3, 0x77, 0x15, 0x6A, 0x6A, 0x3A, 0x68, 0xBA, 0x8E,
+	0xDB, 0x74, 0x08, 0x46, 0x9E, 0xF3, 0xCE, 0xB3, 0x0A, 0xF8, 0xD0, 0xDD, 0x68, 0xBB, 0xF8, 0x5F,
+	0xFA, 0x24, 0xF2, 0xD2, 0xFC, 0x18, 0x87, 0xFB, 0x5C, 0x87, 0xBA, 0xB4, 0x38, 0x32, 0xA5, 0x9B,
+	0x1B, 0x3D, 0x10, 0x7C, 0xF7, 0x78, 0xD6, 0x7F, 0xE2, 0x6D, 0xF8, 0x11, 0x91, 0x29, 0x7E, 0x93,
+	0x95, 0xCB, 0x12, 0xC5, 0x57, 0xCE, 0x5A, 0xF1, 0xD4, 0x16, 0x18, 0xD7, 0x19, 0xBC, 0x04, 0x5B,
+	0x7E, 0x99, 0x65, 0xF1, 0xA2, 0x94, 0x71, 0xC4, 0x2A, 0xAC, 0x6A, 0xA9, 0x38, 0xC4, 0x75, 0xC7,
+	0xAD, 0x32, 0x38, 0x02, 0x1F, 0x05, 0x3B, 0x2C, 0x99, 0x1A, 0xFC, 0xEB, 0x15, 0xDE, 0xCF, 0x68,
+	0xBA, 0xE0, 0x7C, 0xBC, 0xD6, 0x1E, 0x97, 0x1B, 0x9A, 0x0B, 0x9D, 0xBE, 0x97, 0x63, 0xD3, 0x92,
+	0xFC, 0xAF, 0xDF, 0xA2, 0x8C, 0x97, 0x23, 0x45, 0x62, 0xEB, 0xDD, 0x07, 0x65, 0x70, 0xFF, 0x58,
+	0x89, 0x6A, 0xCF, 0xF7, 0xCA, 0xEE, 0x3F, 0x1C, 0xE9, 0xE4, 0x0A, 0x68, 0xE5, 0xDE, 0x93, 0x8D,
+	0x38, 0x9C, 0x7D, 0xBD, 0xD7, 0x5B, 0x09, 0xD4, 0xE7, 0xE2, 0x33, 0x44, 0x3F, 0x4A, 0x8C, 0xC4,
+	0xA1, 0x90, 0xD6, 0xB8, 0xB8, 0xDC, 0x61, 0x5F, 0xD1, 0x8E, 0x28, 0xBE, 0x59, 0x0E, 0xAA, 0x50,
+	0x1B,
+};
+static const cc_uint8 vec_raw_fixed[267] = {
+	0x2B, 0x4F, 0xCD, 0x49, 0xCE, 0xCF, 0x4D, 0x55, 0x28, 0x87, 0xD2, 0x25, 0xF9, 0x0A, 0x59, 0xF9,
+	0x99, 0x79, 0xA9, 0x29, 0x0A, 0x49, 0xA5, 0x99, 0x39, 0x29, 0x20, 0x3E, 0x5C, 0x88, 0x0B, 0x4A,
+	0x01, 0x05, 0x60, 0xCA, 0xD3, 0x13, 0x81, 0x44, 0x71, 0x6A, 0x51, 0x59, 0x6A, 0x11, 0x54, 0x03,
+	0x58, 0xA4, 0x24, 0x23, 0x55, 0xA1, 0x20, 0x27, 0xB1, 0x12, 0x28, 0x0A, 0x55, 0x09, 0xD2, 0x04,
+	0x12, 0x85, 0x28, 0x82, 0xCA, 0x41, 0xAD, 0xC8, 0x00, 0x5B, 0x5B, 0x8E, 0xEA, 0x12, 0x2E, 0x4C,
+	0x17, 0x21, 0x59, 0xC6, 0x05, 0xD2, 0x04, 0xE6, 0x43, 0xE5, 0xA0, 0x4E, 0x83, 0x98, 0x08, 0x21,
+	0x51, 0x9C, 0x85, 0xE4, 0x22, 0x28, 0x05, 0x35, 0x08, 0xCA, 0x03, 0xCA, 0x73, 0xC1, 0x9D, 0x0E,
+	0xF1, 0x34, 0xCC, 0x01, 0xA8, 0xDA, 0x50, 0x9C, 0x0E, 0xB5, 0x02, 0x4A, 0x41, 0x9D, 0x02, 0x35,
+	0x18, 0xA2, 0x02, 0xCD, 0x10, 0x88, 0xC9, 0x60, 0x8B, 0xE0, 0x01, 0x93, 0x01, 0xF7, 0x04, 0x6A,
+	0x90, 0xA1, 0x06, 0x32, 0x8A, 0xE1, 0x58, 0x82, 0x1C, 0x2A, 0x8F, 0x25, 0x20, 0x81, 0x42, 0x28,
+	0x5E, 0xC6, 0x08, 0x7D, 0x2E, 0x14, 0xD3, 0xD0, 0x6D, 0x87, 0xD1, 0x10, 0x59, 0x54, 0x67, 0x20,
+	0xD9, 0x86, 0x14, 0xC0, 0x50, 0x35, 0x68, 0x5E, 0x47, 0x75, 0x39, 0x3C, 0xFE, 0x90, 0x53, 0x10,
+	0xCC, 0xC5, 0x28, 0x71, 0x8A, 0x1C, 0x66, 0x60, 0x02, 0x9E, 0x30, 0x51, 0xA3, 0x1E, 0xA6, 0x3A,
+	0x03, 0x3D, 0xAC, 0x90, 0x43, 0x1B, 0x2C, 0x8D, 0xEA, 0x12, 0x64, 0x07, 0xA0, 0x84, 0x64, 0x06,
+	0x24, 0x6E, 0xA0, 0x09, 0x17, 0x9E, 0x38, 0x90, 0xC3, 0x01, 0x9E, 0x48, 0x51, 0x5D, 0x8C, 0x6C,
+	0x19, 0x52, 0x14, 0x61, 0x0D, 0x49, 0xCC, 0x64, 0xC0, 0x85, 0xE2, 0x5B, 0xA8, 0xF5, 0xA8, 0x7A,
+	0x91, 0x7C, 0x81, 0x62, 0x18, 0x54, 0x31, 0x96, 0x14, 0x0B, 0x00,
+};
+static const cc_uint8 vec_raw_far[4321] = {
+	0xED, 0x9D, 0xD3, 0xB6, 0x60, 0x5B, 0x12, 0x05, 0xCB, 0xB6, 0x6D, 0xDB, 0xB6, 0x6D, 0xDB, 0xB6,
+	0x6D, 0xDB, 0xB6, 0x6D, 0xDB, 0xB6, 0x6D, 0x1B, 0xC7, 0xA7, 0xD0, 0x67, 0xEE, 0x5B, 0xD9, 0x77,
+	0x57, 0x76, 0xD5, 0xCA, 0xA7, 0x7E, 0x5A, 0xF9, 0x09, 0xF3, 0x71, 0x8E, 0x18, 0x31, 0x22, 0x50,
+	0xE0, 0x20, 0x41, 0x83, 0x05, 0x0F, 0x11, 0x32, 0x54, 0xE8, 0x30, 0x61, 0xC3, 0x85, 0x8F, 0x10,
+	0x31, 0x52, 0xE4, 0x28, 0x51, 0xA3, 0x45, 0x8F, 0x11, 0x33, 0x56, 0xEC, 0x38, 0x71, 0xE3, 0xC5,
+	0x4F, 0x90, 0x30, 0x51, 0xE2, 0x24, 0x49, 0x93, 0x25, 0x4F, 0x91, 0x32, 0x55, 0xEA, 0x34, 0x69,
+	0xD3, 0xA5, 0xCF, 0x90, 0x31, 0x53, 0xE6, 0x2C, 0x59, 0xB3, 0x65, 0xCF, 0x91, 0x33, 0x57, 0xEE,
+	0x3C, 0x79, 0xF3, 0xE5, 0x2F, 0x50, 0xB0, 0x50, 0xE1, 0x22, 0x45, 0x8B, 0x15, 0x2F, 0x51, 0xB2,
+	0x54, 0xE9, 0x32, 0x65, 0xCB, 0x95, 0xAF, 0x50, 0xB1, 0x52, 0xE5, 0x2A, 0x55, 0xAB, 0x55, 0xAF,
+	0x51, 0xB3, 0x56, 0xED, 0x3A, 0x75, 0xEB, 0xD5, 0x6F, 0xD0, 0xB0, 0x51, 0xE3, 0x26, 0x4D, 0x9B,
+	0x35, 0x6F, 0xD1, 0xB2, 0x55, 0xEB, 0x36, 0x6D, 0xDB, 0xB5, 0xEF, 0xD0, 0xB1, 0x53, 0xE7, 0x2E,
+	0x5D, 0xBB, 0x75, 0xEF, 0xD1, 0xB3, 0x57, 0xEF, 0x3E, 0x7D, 0xFB, 0xF5, 0x1F, 0x30, 0x70, 0xD0,
+	0xE0, 0x21, 0x43, 0x87, 0x0D, 0x1F, 0x31, 0x72, 0xD4, 0xE8, 0x31, 0x63, 0xC7, 0x8D, 0x9F, 0x30,
+	0x71, 0xD2, 0xE4, 0x29, 0x53, 0xA7, 0x4D, 0x9F, 0x31, 0x73, 0xD6, 0xEC, 0x39, 0x73, 0xE7, 0xCD,
+	0x5F, 0xB0, 0x70, 0xD1, 0xE2, 0x25, 0x4B, 0x97, 0x2D, 0x5F, 0xB1, 0x72, 0xD5, 0xEA, 0x35, 0x6B,
+	0xD7, 0xAD, 0xDF, 0xB0, 0x71, 0xD3, 0xE6, 0x2D, 0x5B, 0xB7, 0x6D, 0xDF, 0xB1, 0x73, 0xD7, 0xEE,
+	0x3D, 0x7B, 0xF7, 0xED, 0x3F, 0x70, 0xF0, 0xD0, 0xE1, 0x23, 0x47, 0x8F, 0x1D, 0x3F, 0x71, 0xF2,
+	0xD4, 0xE9, 0x33, 0x67, 0xCF, 0x9D, 0xBF, 0x70, 0xF1, 0xD2, 0xE5, 0x2B, 0x57, 0xAF, 0x5D, 0xBF,
+	0x71, 0xF3, 0xD6, 0xED, 0x3B, 0x77, 0xEF, 0xDD, 0x7F, 0xF0, 0xF0, 0xD1, 0xE3, 0x27, 0x4F, 0x9F,
+	0x3D, 0x7F, 0xF1, 0xF2, 0xD5, 0xEB, 0x37, 0x6F, 0xDF, 0xBD, 0xFF, 0xF0, 0xF1, 0xD3, 0xE7, 0x2F,
+	0x5F, 0x3D, 0x3C, 0xBD, 0xBC, 0x7D, 0x7C, 0xFD, 0x02, 0xE9, 0x74, 0x9D, 0x6E, 0xFB, 0xF4, 0xE8,
+	0xD1, 0x62, 0xC6, 0x88, 0x1D, 0x2B, 0x6E, 0x9C, 0xF8, 0xF1, 0x12, 0x26, 0x48, 0x9C, 0x28, 0x69,
+	0x92, 0xE4, 0xC9, 0x52, 0xA6, 0x48, 0x9D, 0x2A, 0x6D, 0x9A, 0xF4, 0xE9, 0x32, 0x66, 0xC8, 0x9C,
+	0x29, 0x6B, 0x96, 0xEC, 0xD9, 0x72, 0xE6, 0xC8, 0x9D, 0x2B, 0x6F, 0x9E, 0xFC, 0xF9, 0x0A, 0x16,
+	0x28, 0x5C, 0xA8, 0x68, 0x91, 0xE2, 0xC5, 0x4A, 0x96, 0x28, 0x5D, 0xAA, 0x6C, 0x99, 0xF2, 0xE5,
+	0x2A, 0x56, 0xA8, 0x5C, 0xA9, 0x6A, 0x95, 0xEA, 0xD5, 0x6A, 0xD6, 0xA8, 0x5D, 0xAB, 0x6E, 0x9D,
+	0xFA, 0xF5, 0x1A, 0x36, 0x68, 0xDC, 0xA8, 0x69, 0x93, 0xE6, 0xCD, 0x5A, 0xB6, 0x68, 0xDD, 0xAA,
+	0x6D, 0x9B, 0xF6, 0xED, 0x3A, 0x76, 0xE8, 0xDC, 0xA9, 0x6B, 0x97, 0xEE, 0xDD, 0x7A, 0xF6, 0xE8,
+	0xDD, 0xAB, 0x6F, 0x9F, 0xFE, 0xFD, 0x06, 0x0E, 0x18, 0x3C, 0x68, 0xE8, 0x90, 0xE1, 0xC3, 0x46,
+	0x8E, 0x18, 0x3D, 0x6A, 0xEC, 0x98, 0xF1, 0xE3, 0x26, 0x4E, 0x98, 0x3C, 0x69, 0xEA, 0x94, 0xE9,
+	0xD3, 0x66, 0xCE, 0x98, 0x3D, 0x6B, 0xEE, 0x9C, 0xF9, 0xF3, 0x16, 0x2E, 0x58, 0xBC, 0x68, 0xE9,
+	0x92, 0xE5, 0xCB, 0x56, 0xAE, 0x58, 0xBD, 0x6A, 0xED, 0x9A, 0xF5, 0xEB, 0x36, 0x6E, 0xD8, 0xBC,
+	0x69, 0xEB, 0x96, 0xED, 0xDB, 0x76, 0xEE, 0xD8, 0xBD, 0x6B, 0xEF, 0x9E, 0xFD, 0xFB, 0x0E, 0x1E,
+	0x38, 0x7C, 0xE8, 0xE8, 0x91, 0xE3, 0xC7, 0x4E, 0x9E, 0x38, 0x7D, 0xEA, 0xEC, 0x99, 0xF3, 0xE7,
+	0x2E, 0x5E, 0xB8, 0x7C, 0xE9, 0xEA, 0x95, 0xEB, 0xD7, 0x6E, 0xDE, 0xB8, 0x7D, 0xEB, 0xEE, 0x9D,
+	0xFB, 0xF7, 0x1E, 0x3E, 0x78, 0xFC, 0xE8, 0xE9, 0x93, 0xE7, 0xCF, 0x5E, 0xBE, 0x78, 0xFD, 0xEA,
+	0xED, 0x9B, 0xF7, 0xEF, 0x3E, 0x7E, 0xF8, 0xFC, 0xE9, 0xEB, 0x17, 0x4F, 0x0F, 0x6F, 0x2F, 0x5F,
+	0x1F, 0xFF, 0xC0, 0x81, 0x82, 0x06, 0x09, 0x1E, 0x2C, 0x64, 0x88, 0xD0, 0xA1, 0xC2, 0x86, 0x09,
+	0x1F, 0x2E, 0x62, 0x84, 0xC8, 0x91, 0xA2, 0x46, 0xD1, 0xE9, 0x3A, 0xDD, 0xFA, 0xE9, 0x69, 0xD2,
+	0xA6, 0x4A, 0x9D, 0x21, 0x63, 0xBA, 0xF4, 0x59, 0xB2, 0x66, 0xCA, 0x9C, 0x23, 0x67, 0xB6, 0xEC,
+	0x79, 0xF2, 0xE6, 0xCA, 0x5D, 0xA0, 0x60, 0xBE, 0xFC, 0x45, 0x8A, 0x16, 0x2A, 0x5C, 0xA2, 0x64,
+	0xB1, 0xE2, 0x65, 0xCA, 0x96, 0x2A, 0x5D, 0xA1, 0x62, 0xB9, 0xF2, 0x55, 0xAA, 0x56, 0xAA, 0x5C,
+	0xA3, 0x66, 0xB5, 0xEA, 0x75, 0xEA, 0xD6, 0xAA, 0xDD, 0xA0, 0x61, 0xBD, 0xFA, 0x4D, 0x9A, 0x36,
+	0x6A, 0xDC, 0xA2, 0x65, 0xB3, 0xE6, 0x6D, 0xDA, 0xB6, 0x6A, 0xDD, 0xA1, 0x63, 0xBB, 0xF6, 0x5D,
+	0xBA, 0x76, 0xEA, 0xDC, 0xA3, 0x67, 0xB7, 0xEE, 0x7D, 0xFA, 0xF6, 0xEA, 0x3D, 0x60, 0x60, 0xBF,
+	0xFE, 0x43, 0x86, 0x0E, 0x1A, 0x3C, 0x62, 0xE4, 0xB0, 0xE1, 0x63, 0xC6, 0x8E, 0x1A, 0x3D, 0x61,
+	0xE2, 0xB8, 0xF1, 0x53, 0xA6, 0x4E, 0x9A, 0x3C, 0x63, 0xE6, 0xB4, 0xE9, 0x73, 0xE6, 0xCE, 0x9A,
+	0xBD, 0x60, 0xE1, 0xBC, 0xF9, 0x4B, 0x96, 0x2E, 0x5A, 0xBC, 0x62, 0xE5, 0xB2, 0xE5, 0x6B, 0xD6,
+	0xAE, 0x5A, 0xBD, 0x61, 0xE3, 0xBA, 0xF5, 0x5B, 0xB6, 0x6E, 0xDA, 0xBC, 0x63, 0xE7, 0xB6, 0xED,
+	0x7B, 0xF6, 0xEE, 0xDA, 0x7D, 0xE0, 0xE0, 0xBE, 0xFD, 0x47, 0x8E, 0x1E, 0x3A, 0x7C, 0xE2, 0xE4,
+	0xB1, 0xE3, 0x67, 0xCE, 0x9E, 0x3A, 0x7D, 0xE1, 0xE2, 0xB9, 0xF3, 0x57, 0xAE, 0x5E, 0xBA, 0x7C,
+	0xE3, 0xE6, 0xB5, 0xEB, 0x77, 0xEE, 0xDE, 0xBA, 0xFD, 0xE0, 0xE1, 0xBD, 0xFB, 0x4F, 0x9E, 0x3E,
+	0x7A, 0xFC, 0xE2, 0xE5, 0xB3, 0xE7, 0x6F, 0xDE, 0xBE, 0x7A, 0xFD, 0xE1, 0xE3, 0xBB, 0xF7, 0x5F,
+	0xBE, 0x7E, 0xFA, 0xEC, 0xE5, 0xED, 0xE1, 0xE9, 0xE7, 0xEF, 0x13, 0x24, 0x68, 0xA0, 0xC0, 0x21,
+	0x42, 0x06, 0x0B, 0x1E, 0x26, 0x6C, 0xA8, 0xD0, 0x11, 0x22, 0x86, 0x0B, 0x1F, 0x25, 0x6A, 0xA4,
+	0xC8, 0x31, 0x62, 0x46, 0x8B, 0x1E, 0x27, 0x6E, 0xAC, 0xD8, 0x09, 0x12, 0xC6, 0x8B, 0x9F, 0x24,
+	0x69, 0xA2, 0xC4, 0x29, 0x52, 0x26, 0x4B, 0xAE, 0xD3, 0x75, 0xBA, 0xF5, 0xD3, 0x0B, 0x16, 0xC8,
+	0x9F, 0xAF, 0x68, 0x91, 0xC2, 0x85, 0x4A, 0x96, 0x28, 0x5E, 0xAC, 0x6C, 0x99, 0xD2, 0xA5, 0x2A,
+	0x56, 0x28, 0x5F, 0xAE, 0x6A, 0x95, 0xCA, 0x95, 0x6A, 0xD6, 0xA8, 0x5E, 0xAD, 0x6E, 0x9D, 0xDA,
+	0xB5, 0x1A, 0x36, 0xA8, 0x5F, 0xAF, 0x69, 0x93, 0xC6, 0x8D, 0x5A, 0xB6, 0x68, 0xDE, 0xAC, 0x6D,
+	0x9B, 0xD6, 0xAD, 0x3A, 0x76, 0x68, 0xDF, 0xAE, 0x6B, 0x97, 0xCE, 0x9D, 0x7A, 0xF6, 0xE8, 0xDE,
+	0xAD, 0x6F, 0x9F, 0xDE, 0xBD, 0x06, 0x0E, 0xE8, 0xDF, 0x6F, 0xE8, 0x90, 0xC1, 0x83, 0x46, 0x8E,
+	0x18, 0x3E, 0x6C, 0xEC, 0x98, 0xD1, 0xA3, 0x26, 0x4E, 0x18, 0x3F, 0x6E, 0xEA, 0x94, 0xC9, 0x93,
+	0x66, 0xCE, 0x98, 0x3E, 0x6D, 0xEE, 0x9C, 0xD9, 0xB3, 0x16, 0x2E, 0x98, 0x3F, 0x6F, 0xE9, 0x92,
+	0xC5, 0x8B, 0x56, 0xAE, 0x58, 0xBE, 0x6C, 0xED, 0x9A, 0xD5, 0xAB, 0x36, 0x6E, 0x58, 0xBF, 0x6E,
+	0xEB, 0x96, 0xCD, 0x9B, 0x76, 0xEE, 0xD8, 0xBE, 0x6D, 0xEF, 0x9E, 0xDD, 0xBB, 0x0E, 0x1E, 0xD8,
+	0xBF, 0xEF, 0xE8, 0x91, 0xC3, 0x87, 0x4E, 0x9E, 0x38, 0x7E, 0xEC, 0xEC, 0x99, 0xD3, 0xA7, 0x2E,
+	0x5E, 0x38, 0x7F, 0xEE, 0xEA, 0x95, 0xCB, 0x97, 0x6E, 0xDE, 0xB8, 0x7E, 0xED, 0xEE, 0x9D, 0xDB,
+	0xB7, 0x1E, 0x3E, 0xB8, 0x7F, 0xEF, 0xE9, 0x93, 0xC7, 0x8F, 0x5E, 0xBE, 0x78, 0xFE, 0xEC, 0xED,
+	0x9B, 0xD7, 0xAF, 0x3E, 0x7E, 0x78, 0xFF, 0xEE, 0xEB, 0x97, 0xCF, 0x9F, 0xBC, 0xBD, 0x3C, 0x3D,
+	0xFC, 0xFD, 0x7C, 0x83, 0x06, 0x09, 0x1C, 0x28, 0x64, 0x88, 0xE0, 0xC1, 0xC2, 0x86, 0x09, 0x1D,
+	0x2A, 0x62, 0x84, 0xF0, 0xE1, 0xA2, 0x46, 0x89, 0x1C, 0x29, 0x66, 0x8C, 0xE8, 0xD1, 0xE2, 0xC6,
+	0x89, 0x1D, 0x2B, 0x61, 0x82, 0xF8, 0xF1, 0x92, 0x26, 0x49, 0x9C, 0x28, 0x65, 0x8A, 0xE4, 0xC9,
+	0xD2, 0xA6, 0x49, 0x9D, 0x2A, 0x63, 0x86, 0xF4, 0xE9, 0xB2, 0x66, 0xC9, 0x9C, 0x29, 0x67, 0x8E,
+	0xEC, 0xD9, 0xF2, 0xE6, 0xC9, 0x9D, 0x4B, 0xA7, 0xEB, 0x74, 0xEB, 0xA7, 0xE3, 0xBA, 0xE0, 0xC2,
+	0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2,
+	0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2,
+	0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2,
+	0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2,
+	0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2,
+	0x7C, 0xFB, 0xFE, 0x03, 0xD7, 0x05, 0x17, 0x06, 0xD7, 0x05, 0x17, 0x06, 0xAF, 0x0D, 0x17, 0x06,
+	0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D,
+	0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x4D, 0xA7, 0xEB, 0x74, 0xEB,
+	0xA7, 0xE3, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0,
+	0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0,
+	0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0,
+	0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0,
+	0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0x7C, 0xFF, 0xF6, 0x13, 0xD7,
+	0x05, 0x17, 0x06, 0xD7, 0x05, 0x17, 0x06, 0xD7, 0x05, 0x17, 0x06, 0xD7, 0x05, 0x17, 0x06, 0xD7,
+	0x05, 0x17, 0x06, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF,
+	0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF,
+	0x4D, 0xA7, 0xEB, 0x74, 0xEB, 0xA7, 0xE3, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA,
+	0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA,
+	0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA,
+	0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA,
+	0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xFC, 0xF8, 0xF9, 0x0D, 0xD7, 0x05, 0x17, 0x06, 0xD7, 0x05,
+	0x17, 0x06, 0xD7, 0x05, 0x17, 0x06, 0xD7, 0x05, 0x17, 0x06, 0xD7, 0x05, 0x17, 0x06, 0xD7, 0x05,
+	0x17, 0x06, 0xD7, 0x05, 0x17, 0x06, 0xAF, 0x0D, 0x17, 0x06, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D,
+	0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D,
+	0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x4D, 0xA7, 0xEB, 0x74, 0xEB, 0xA7, 0xE3, 0xC2, 0xE0, 0xBA, 0xE0,
+	0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0,
+	0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0,
+	0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0, 0xC2, 0xE0, 0xBA, 0xE0,
+	0xC2, 0xFC, 0xFC, 0xF1, 0x1D, 0xD7, 0x05, 0x17, 0x06, 0xD7, 0x05, 0x17, 0x06, 0xD7, 0x05, 0x17,
+	0x06, 0xD7, 0x05, 0x17, 0x06, 0xD7, 0x05, 0x17, 0x06, 0xD7, 0x05, 0x17, 0x06, 0xD7, 0x05, 0x17,
+	0x06, 0xD7, 0x05, 0x17, 0x06, 0xD7, 0x05, 0x17, 0x06, 0xD7, 0x05, 0x17, 0x06, 0xAF, 0x0D, 0xEF,
+	0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF,
+	0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x0D, 0xEF, 0x0D, 0xAF, 0x4D, 0xA7, 0xEB, 0x74, 0xEB, 0xA7,
+	0x13, 0x66, 0x24, 0xEC, 0x48, 0x98, 0x91, 0xB0, 0x23, 0x61, 0x46, 0xC2, 0x8E, 0x84, 0x19, 0x09,
+	0x3B, 0x12, 0x66, 0x24, 0xEC, 0xE8, 0xE3, 0xEB, 0xE7, 0x1F, 0x70, 0x5D, 0x7E, 0x06, 0x5C, 0x18,
+	0xC2, 0x8C, 0x84, 0x1D, 0x89, 0xB0, 0x12, 0x71, 0x25, 0xC2, 0x4A, 0xC4, 0x95, 0x08, 0x2B, 0x11,
+	0x57, 0x22, 0xAC, 0x44, 0x5C, 0x89, 0xB0, 0x12, 0x71, 0x25, 0xC2, 0x4A, 0xC4, 0x95, 0x08, 0x2B,
+	0x11, 0x57, 0x22, 0xAC, 0x44, 0x5C, 0x89, 0xB0, 0x12, 0x71, 0xD5, 0xE9, 0x3A, 0xDD, 0xFA, 0xE9,
+	0xB8, 0x2E, 0x84, 0x1D, 0x09, 0x33, 0x12, 0x76, 0x24, 0xCC, 0x48, 0xD8, 0x91, 0x30, 0x23, 0x61,
+	0x47, 0x5F, 0x1F, 0x7F, 0xBF, 0x80, 0xEB, 0xF2, 0x23, 0xE0, 0xC2, 0x10, 0x66, 0x24, 0xEC, 0x48,
+	0x98, 0x91, 0xB0, 0x23, 0x11, 0x56, 0xC2, 0x8E, 0x44, 0x58, 0x89, 0xB8, 0x12, 0x61, 0x25, 0xE2,
+	0x4A, 0x84, 0x95, 0x88, 0x2B, 0x11, 0x56, 0x22, 0xAE, 0x44, 0x58, 0x89, 0xB8, 0x12, 0x61, 0x25,
+	0xE2, 0x4A, 0x84, 0x95, 0x88, 0x2B, 0x11, 0x56, 0x22, 0xAE, 0x44, 0x58, 0x75, 0xBA, 0x4E, 0xB7,
+	0x7A, 0x3A, 0x61, 0x47, 0xC2, 0x8C, 0x84, 0x1D, 0x09, 0x33, 0x12, 0x76, 0xF4, 0xF3, 0xF7, 0xF1,
+	0x0D, 0xB8, 0x2E, 0xDF, 0x03, 0x2E, 0x0C, 0x61, 0x46, 0xC2, 0x8E, 0x84, 0x19, 0x09, 0x3B, 0x12,
+	0x66, 0x24, 0xEC, 0x48, 0x84, 0x95, 0xB0, 0x23, 0x11, 0x56, 0x22, 0xAE, 0x44, 0x58, 0x89, 0xB8,
+	0x12, 0x61, 0x25, 0xE2, 0x4A, 0x84, 0x95, 0x88, 0x2B, 0x11, 0x56, 0x22, 0xAE, 0x44, 0x58, 0x89,
+	0xB8, 0x12, 0x61, 0x25, 0xE2, 0x4A, 0x84, 0x95, 0x88, 0x2B, 0x11, 0x56, 0x9D, 0xAE, 0xD3, 0xAD,
+	0x9F, 0x8E, 0x2B, 0x43, 0x98, 0x91, 0xB0, 0xA3, 0xBF, 0x9F, 0xAF, 0x4F, 0xC0, 0x75, 0xF9, 0x16,
+	0x70, 0x61, 0x08, 0x33, 0x12, 0x76, 0x24, 0xCC, 0x48, 0xD8, 0x91, 0x30, 0x23, 0x61, 0x47, 0xC2,
+	0x8C, 0x84, 0x1D, 0x09, 0x33, 0x12, 0x76, 0x24, 0xC2, 0x4A, 0xC4, 0x95, 0x08, 0x2B, 0x11, 0x57,
+	0x22, 0xAC, 0x44, 0x5C, 0x89, 0xB0, 0x12, 0x71, 0x25, 0xC2, 0x4A, 0xC4, 0x95, 0x08, 0x2B, 0x11,
+	0x57, 0x22, 0xAC, 0x44, 0x5C, 0x89, 0xB0, 0x12, 0x71, 0x25, 0xC2, 0x4A, 0xC4, 0x55, 0xA7, 0xEB,
+	0x74, 0xAB, 0xA7, 0xE3, 0xBA, 0xE0, 0xC2, 0x78, 0x78, 0x7A, 0x11, 0x66, 0x24, 0xEC, 0x48, 0x98,
+	0x91, 0xB0, 0x23, 0x61, 0x46, 0xC2, 0x8E, 0x84, 0x19, 0x09, 0x3B, 0x12, 0x66, 0x24, 0xEC, 0x48,
+	0x98, 0x91, 0xB0, 0x23, 0x11, 0x56, 0x22, 0xAE, 0x44, 0x58, 0x89, 0xB8, 0x12, 0x61, 0x25, 0xE2,
+	0x4A, 0x84, 0x95, 0x88, 0x2B, 0x11, 0x56, 0x22, 0xAE, 0x44, 0x58, 0x89, 0xB8, 0x12, 0x61, 0x25,
+	0xE2, 0x4A, 0x84, 0x95, 0x88, 0x2B, 0x11, 0x56, 0x22, 0xAE, 0x3A, 0x5D, 0xA7, 0x5B, 0x3F, 0xFD,
+	0x17, 0x76, 0x24, 0xCC, 0x48, 0xD8, 0x91, 0x30, 0x23, 0x61, 0x47, 0xC2, 0x8C, 0x84, 0x1D, 0x09,
+	0x33, 0x12, 0x76, 0x24, 0xCC, 0x48, 0xD8, 0x91, 0x30, 0x23, 0x61, 0x47, 0x22, 0xAC, 0x84, 0x1D,
+	0x89, 0xB0, 0x12, 0x71, 0x25, 0xC2, 0x4A, 0xC4, 0x95, 0x08, 0x2B, 0x11, 0x57, 0x22, 0xAC, 0x44,
+	0x5C, 0x89, 0xB0, 0x12, 0x71, 0x25, 0xC2, 0x4A, 0xC4, 0x95, 0x08, 0x2B, 0x11, 0x57, 0xBC, 0x36,
+	0xBC, 0x37, 0x4F, 0x0F, 0x6F, 0x22, 0xAC, 0xC1, 0x75, 0xBA, 0x4E, 0xB7, 0x7E, 0x7A, 0xC0, 0x85,
+	0x21, 0xCC, 0x48, 0xD8, 0x91, 0x30, 0x23, 0x61, 0x47, 0xC2, 0x8C, 0x84, 0x1D, 0x09, 0x33, 0x12,
+	0x76, 0x24, 0xCC, 0x48, 0xD8, 0x91, 0x30, 0x23, 0x61, 0x47, 0x22, 0xAC, 0x84, 0x1D, 0x89, 0xB0,
+	0x12, 0x71, 0x25, 0xC2, 0x4A, 0xC4, 0x95, 0x08, 0x2B, 0x11, 0x57, 0x22, 0xAC, 0x44, 0x5C, 0x89,
+	0xB0, 0x12, 0x71, 0x25, 0xC2, 0x4A, 0xC4, 0x15, 0xAF, 0x0D, 0xEF, 0xCD, 0xCB, 0xDB, 0x83, 0x08,
+	0x2B, 0x11, 0x57, 0x22, 0xAC, 0x44, 0x5C, 0x75, 0xBA, 0x4E, 0xB7, 0x7B, 0xFA, 0x2F, 0xCC, 0x48,
+	0xD8, 0x91, 0x30, 0x23, 0x61, 0x47, 0xC2, 0x8C, 0x84, 0x1D, 0x09, 0x33, 0x12, 0x76, 0x24, 0xCC,
+	0x48, 0xD8, 0x91, 0x30, 0x23, 0x61, 0x47, 0xC2, 0x8C, 0x84, 0x1D, 0x89, 0xB0, 0x12, 0x71, 0x25,
+	0xC2, 0x4A, 0xC4, 0x95, 0x08, 0x2B, 0x11, 0x57, 0x22, 0xAC, 0x44, 0x5C, 0x89, 0xB0, 0x12, 0x71,
+	0xC5, 0x6B, 0xC3, 0x7B, 0xF3, 0xF6, 0xF2, 0x24, 0xC2, 0x4A, 0xC4, 0x95, 0x08, 0x2B, 0x11, 0x57,
+	0x22, 0xAC, 0x44, 0x5C, 0x0B, 0xEA, 0x74, 0x9D, 0x6E, 0xFD, 0x74, 0x97, 0xB9, 0xCC, 0xCD, 0x66,
+	0x6E, 0x2E, 0x73, 0xB3, 0x99, 0x9B, 0xCB, 0xDC, 0x6C, 0xE6, 0xE6, 0x32, 0x37, 0x9B, 0xB9, 0xB9,
+	0xCC, 0xCD, 0x66, 0x97, 0xB9, 0xEC, 0x10, 0x56, 0x97, 0xD9, 0xCC, 0xA5, 0x6D, 0x6E, 0x36, 0x73,
+	0x69, 0x9B, 0x4B, 0xDD, 0x5C, 0xDA, 0xD6, 0xE9, 0x3A, 0xDD, 0xCE, 0xE9, 0xBF, 0x30, 0x24, 0x37,
+	0x97, 0xB9, 0xD9, 0xCC, 0xCD, 0x65, 0x6E, 0x36, 0x73, 0x73, 0x99, 0x9B, 0xCD, 0xDC, 0x5C, 0xE6,
+	0x66, 0xB3, 0xCB, 0x5C, 0x76, 0x08, 0xAB, 0xCB, 0x6C, 0xE6, 0xE6, 0x32, 0x37, 0x9B, 0xB9, 0xB4,
+	0xCD, 0xA5, 0x6E, 0x2E, 0x6D, 0x73, 0xA9, 0x5B, 0xA7, 0xEB, 0x74, 0x7B, 0xA7, 0x07, 0x5C, 0x17,
+	0x6E, 0x36, 0x73, 0x73, 0x99, 0x9B, 0xCD, 0xDC, 0x5C, 0xE6, 0x66, 0x33, 0x37, 0x97, 0xB9, 0xD9,
+	0xEC, 0x32, 0x97, 0x1D, 0xC2, 0xEA, 0x32, 0x9B, 0xB9, 0xB9, 0xCC, 0xCD, 0x66, 0x2E, 0x6D, 0x73,
+	0xB3, 0x99, 0x4B, 0xDB, 0x5C, 0xEA, 0xE6, 0xD2, 0xB6, 0x4E, 0xD7, 0xE9, 0x76, 0x4F, 0x67, 0xE6,
+	0x32, 0x37, 0x9B, 0xB9, 0xB9, 0xCC, 0xCD, 0x66, 0x6E, 0x2E, 0x73, 0xB3, 0xD9, 0x65, 0x2E, 0x3B,
+	0x84, 0xD5, 0x65, 0x36, 0x73, 0x73, 0x99, 0x9B, 0xCD, 0xDC, 0x5C, 0xE6, 0x66, 0x33, 0x97, 0xB6,
+	0xB9, 0xD9, 0xCC, 0xA5, 0x6D, 0x2E, 0x75, 0x4F, 0xD5, 0xE9, 0x3A, 0xDD, 0xFA, 0xE9, 0x2E, 0xB3,
+	0x99, 0x9B, 0xCB, 0xDC, 0x6C, 0xE6, 0xE6, 0x32, 0x37, 0x9B, 0x5D, 0xE6, 0xB2, 0x83, 0x19, 0x5D,
+	0x66, 0x33, 0x37, 0x97, 0xB9, 0xD9, 0xCC, 0xCD, 0x65, 0x6E, 0x36, 0x73, 0x73, 0x99, 0x9B, 0xCD,
+	0x5C, 0xDA, 0xE6, 0x52, 0x37, 0x97, 0xB6, 0xB9, 0xD4, 0xAD, 0xD3, 0x75, 0xBA, 0x9D, 0xD3, 0x7F,
+	0x61, 0x46, 0x6E, 0x36, 0x73, 0x73, 0x99, 0x9B, 0xCD, 0x2E, 0x73, 0xD9, 0xC1, 0x8C, 0x2E, 0xB3,
+	0x99, 0x9B, 0xCB, 0xDC, 0x6C, 0xE6, 0xE6, 0x32, 0x37, 0x9B, 0xB9, 0xB9, 0xCC, 0xCD, 0x66, 0x2E,
+	0x6D, 0x73, 0xB3, 0x99, 0x4B, 0xDB, 0x5C, 0xEA, 0xE6, 0xD2, 0xB6, 0x4E, 0xD7, 0xE9, 0xF6, 0x4E,
+	0x0F, 0xB8, 0x30, 0xDC, 0x5C, 0xE6, 0x66, 0xB3, 0xCB, 0x5C, 0x76, 0x30, 0xA3, 0xCB, 0x6C, 0xE6,
+	0xE6, 0x32, 0x37, 0x9B, 0xB9, 0xB9, 0xCC, 0xCD, 0x66, 0x6E, 0x2E, 0x73, 0xB3, 0x99, 0x9B, 0xCB,
+	0xDC, 0x6C, 0xE6, 0xD2, 0x36, 0x97, 0xBA, 0xB9, 0xB4, 0xCD, 0xA5, 0x6E, 0x9D, 0xAE, 0xD3, 0xED,
+	0x9E, 0xCE, 0xCC, 0x66, 0x97, 0xB9, 0xEC, 0x60, 0x46, 0x97, 0xD9, 0xCC, 0xCD, 0x65, 0x6E, 0x36,
+	0x73, 0x73, 0x99, 0x9B, 0xCD, 0xDC, 0x5C, 0xE6, 0x66, 0x33, 0x37, 0x97, 0xB9, 0xD9, 0xCC, 0xCD,
+	0x65, 0x6E, 0x36, 0x73, 0x69, 0x9B, 0x4B, 0xDD, 0x5C, 0xDA, 0x3E, 0xA9, 0xD3, 0x75, 0xBA, 0xF5,
+	0xD3, 0xFF, 0x31, 0x97, 0x1D, 0xEC, 0xE8, 0x32, 0x9B, 0xB9, 0xB9, 0xCC, 0xCD, 0x66, 0x6E, 0x2E,
+	0x73, 0xB3, 0x99, 0x9B, 0xCB, 0xDC, 0x6C, 0xE6, 0xE6, 0x32, 0x37, 0x9B, 0xB9, 0xB9, 0xCC, 0xCD,
+	0x66, 0x2E, 0x6D, 0x73, 0xB3, 0x99, 0x4B, 0xDB, 0x5C, 0xEA, 0x76, 0x49, 0xDB, 0x3A, 0x5D, 0xA7,
+	0x5B, 0x3C, 0xFD, 0xD1, 0x53, 0x6E, 0x2E, 0x73, 0xB3, 0x99, 0x9B, 0xCB, 0xDC, 0x6C, 0xE6, 0xE6,
+	0x32, 0x37, 0x9B, 0xB9, 0xB9, 0xCC, 0xCD, 0x66, 0x6E, 0x2E, 0x73, 0xB3, 0x99, 0x9B, 0xCB, 0xDC,
+	0x6C, 0xE6, 0xD2, 0x36, 0x97, 0xBA, 0x5D, 0xD2, 0xB6, 0x43, 0x5C, 0x5D, 0x52, 0xB7, 0x4E, 0xD7,
+	0xE9, 0x96, 0x4F, 0xFF, 0xDD, 0x6C, 0xE6, 0xE6, 0x32, 0x37, 0x9B, 0xB9, 0xB9, 0xCC, 0xCD, 0x66,
+	0x6E, 0x2E, 0x73, 0xB3, 0x99, 0x9B, 0xCB, 0xDC, 0x6C, 0xE6, 0xE6, 0x32, 0x37, 0x9B, 0xB9, 0xB4,
+	0xCD, 0xCD, 0x66, 0x97, 0xB4, 0xED, 0x10, 0x57, 0x97, 0xD4, 0xCD, 0xA5, 0x6D, 0x2E, 0x75, 0xEB,
+	0x74, 0x9D, 0x6E, 0xE1, 0xF4, 0x7F, 0xCD, 0x65, 0x6E, 0x36, 0x73, 0x73, 0x99, 0x9B, 0xCD, 0xDC,
+	0x5C, 0xE6, 0x66, 0x33, 0x37, 0x97, 0xB9, 0xD9, 0xCC, 0xCD, 0x65, 0x6E, 0x36, 0x73, 0x73, 0x99,
+	0x9B, 0xCD, 0x2E, 0x69, 0xDB, 0x21, 0xAE, 0x2E, 0xB3, 0x99, 0x4B, 0xDB, 0x5C, 0xEA, 0xE6, 0xD2,
+	0xB6, 0x4E, 0xD7, 0xE9, 0x96, 0x4E, 0xFF, 0x07, 0x3B, 0x72, 0x73, 0x99, 0x9B, 0xCD, 0xDC, 0x5C,
+	0xE6, 0x66, 0x33, 0x37, 0x97, 0xB9, 0xD9, 0xCC, 0xCD, 0x65, 0x6E, 0x36, 0x73, 0x73, 0x99, 0x9B,
+	0xCD, 0x2E, 0x73, 0xD9, 0x21, 0xAE, 0x2E, 0xB3, 0x99, 0x4B, 0xDB, 0x5C, 0xEA, 0xE6, 0xD2, 0x36,
+	0x97, 0xBA, 0x75, 0xBA, 0x4E, 0xB7, 0x78, 0x7A, 0xD5, 0x2A, 0xDC, 0x6C, 0xE6, 0xE6, 0x32, 0x37,
+	0x9B, 0xB9, 0xB9, 0xCC, 0xCD, 0x66, 0x6E, 0x2E, 0x73, 0xB3, 0x99, 0x9B, 0xCB, 0xDC, 0x6C, 0x76,
+	0x99, 0xCB, 0x0E, 0x71, 0x75, 0x99, 0xCD, 0x5C, 0xDA, 0xE6, 0x66, 0x33, 0x97, 0xB6, 0xB9, 0xD4,
+	0xCD, 0xA5, 0x6D, 0x9D, 0xAE, 0xD3, 0x2D, 0x9F, 0xFE, 0xBB, 0xB9, 0xCC, 0xCD, 0x66, 0x6E, 0x2E,
+	0x73, 0xB3, 0x99, 0x9B, 0xCB, 0xDC, 0x6C, 0xE6, 0xE6, 0x32, 0x37, 0x9B, 0x5D, 0xE6, 0xB2, 0x43,
+	0x5C, 0x5D, 0x66, 0x33, 0x37, 0x97, 0xB9, 0xD9, 0xCC, 0xA5, 0x6D, 0x6E, 0x36, 0x73, 0x69, 0x9B,
+	0x4B, 0xDD, 0x5C, 0xDA, 0xD6, 0xE9, 0x3A, 0xDD, 0xC2, 0xE9, 0xFF, 0x9A, 0xCD, 0xDC, 0x5C, 0xE6,
+	0x66, 0x33, 0x37, 0x97, 0xB9, 0xD9, 0xCC, 0xCD, 0x65, 0x6E, 0x36, 0xBB, 0xCC, 0x65, 0x87, 0xB8,
+	0xBA, 0xCC, 0x66, 0x6E, 0x2E, 0x73, 0xB3, 0x99, 0x9B, 0xCB, 0xDC, 0x6C, 0xE6, 0xD2, 0x36, 0x97,
+	0xBA, 0xB9, 0xB4, 0xCD, 0xA5, 0x6E, 0x9D, 0xAE, 0xD3, 0x2D, 0x9D, 0xFE, 0xE7, 0xC8, 0xB8, 0x14,
+	0x29, 0x37, 0x44, 0xC6, 0x1D, 0xCC, 0x68, 0x88, 0x94, 0x4B, 0x7D, 0x75, 0xA9, 0xCF, 0x2E, 0xF5,
+	0xD5, 0xA5, 0x3E, 0xBB, 0xD4, 0x57, 0xD7, 0xE9, 0x3A, 0xDD, 0xA2, 0xE9, 0x07, 0x0F, 0x48, 0x91,
+	0x72, 0x43, 0x64, 0xDC, 0xC1, 0x8C, 0x86, 0x48, 0xB9, 0xD4, 0x57, 0x97, 0x22, 0xE5, 0x52, 0x5F,
+	0x5D, 0xEA, 0xB3, 0x4B, 0x7D, 0x75, 0x9D, 0xAE, 0xD3, 0x2D, 0x9F, 0xFE, 0xBB, 0xF9, 0x6C, 0x88,
+	0x8C, 0x3B, 0x98, 0xD1, 0x10, 0x29, 0x97, 0xFA, 0xEA, 0x52, 0xA4, 0x5C, 0xEA, 0xAB, 0x4B, 0x7D,
+	0x76, 0xA9, 0xAF, 0x2E, 0xF5, 0xD9, 0x75, 0xBA, 0x4E, 0xB7, 0x70, 0xFA, 0x1F, 0x23, 0xE3, 0x0E,
+	0x66, 0x34, 0x44, 0xCA, 0xA5, 0xC8, 0xB8, 0x14, 0x29, 0x97, 0xFA, 0xEA, 0x52, 0x9F, 0x5D, 0xEA,
+	0xAB, 0x4B, 0x7D, 0x76, 0x43, 0x5F, 0x5D, 0xA7, 0xEB, 0x74, 0x9B, 0xA6, 0xFF, 0x83, 0x19, 0x0D,
+	0x91, 0x72, 0x29, 0x32, 0x2E, 0x45, 0xCA, 0xA5, 0xBE, 0xBA, 0x14, 0x29, 0x97, 0xFA, 0xEA, 0x52,
+	0x9F, 0xDD, 0xD0, 0x57, 0xD7, 0xE9, 0x3A, 0xDD, 0xF6, 0xE9, 0xBF, 0x45, 0xCA, 0xA5, 0xC8, 0xB8,
+	0x14, 0x29, 0x97, 0xFA, 0xEA, 0x52, 0xA4, 0x5C, 0xEA, 0xAB, 0x4B, 0x7D, 0x76, 0x43, 0x5F, 0xDD,
+	0x21, 0xAC, 0x86, 0x3E, 0xBB, 0x4E, 0xD7, 0xE9, 0x36, 0x4E, 0xFF, 0x6B, 0x64, 0x5C, 0x8A, 0x94,
+	0x4B, 0x91, 0x71, 0x29, 0x52, 0x2E, 0xF5, 0xD5, 0xA5, 0x3E, 0xBB, 0xA1, 0xAF, 0xEE, 0x10, 0x56,
+	0x43, 0x9F, 0x5D, 0xEA, 0xAB, 0xEB, 0x74, 0x9D, 0x6E, 0xCB, 0x74, 0x07, 0x33, 0x4A, 0x91, 0x72,
+	0x29, 0x32, 0x2E, 0x45, 0xCA, 0xA5, 0xBE, 0xBA, 0x14, 0x29, 0x37, 0xF4, 0xD5, 0x1D, 0xC2, 0x6A,
+	0xE8, 0xB3, 0x4B, 0x7D, 0x75, 0x9D, 0xAE, 0xD3, 0x6D, 0x9E, 0xFE, 0x3F, 0x91, 0x72, 0x29, 0x32,
+	0x2E, 0x45, 0xCA, 0xA5, 0xBE, 0xBA, 0x14, 0x29, 0x37, 0xF4, 0xD5, 0x1D, 0xE2, 0x6A, 0xE8, 0xB3,
+	0x4B, 0x7D, 0x75, 0xA9, 0xCF, 0xAE, 0xD3, 0x75, 0xBA, 0x6D, 0xD3, 0x8D, 0x91, 0x71, 0x29, 0x52,
+	0x2E, 0x45, 0xC6, 0xA5, 0x48, 0xB9, 0xA1, 0xAF, 0xEE, 0x10, 0x57, 0x43, 0x9F, 0x5D, 0xEA, 0xAB,
+	0x4B, 0x7D, 0x76, 0xA9, 0xAF, 0xAE, 0xD3, 0x75, 0xBA, 0x0D, 0xD3, 0xFF, 0x6B, 0x2E, 0x4B, 0x91,
+	0x72, 0x29, 0x32, 0x2E, 0x45, 0xCA, 0x0D, 0x7D, 0x75, 0x87, 0xB8, 0x1A, 0x22, 0xE5, 0x52, 0x5F,
+	0x5D, 0xEA, 0xB3, 0x4B, 0x7D, 0x75, 0x9D, 0xAE, 0xD3, 0x6D, 0x9D, 0xFE, 0xC7, 0x48, 0xB9, 0x14,
+	0x19, 0x97, 0x22, 0xE5, 0x86, 0xBE, 0xBA, 0x83, 0x1D, 0x0D, 0x91, 0x72, 0xA9, 0xAF, 0x2E, 0xF5,
+	0xD9, 0xA5, 0xBE, 0xBA, 0xD4, 0x67, 0xD7, 0xE9, 0x3A, 0xDD, 0xA6, 0xE9, 0x55, 0xA5, 0xC8, 0xB8,
+	0x14, 0x29, 0x37, 0x44, 0xC6, 0x1D, 0xEC, 0x68, 0x88, 0x94, 0x4B, 0x7D, 0x75, 0xA9, 0xCF, 0x2E,
+	0xF5, 0xD5, 0xA5, 0x3E, 0xBB, 0x4E, 0xD7, 0xE9, 0xB6, 0x4F, 0xFF, 0xCD, 0x5C, 0x96, 0x22, 0xE5,
+	0x86, 0xC8, 0xB8, 0x83, 0x1D, 0x0D, 0x91, 0x72, 0xA9, 0xAF, 0x2E, 0xF5, 0xD9, 0xA5, 0xBE, 0xBA,
+	0xD4, 0x67, 0x97, 0xFA, 0xEA, 0x3A, 0x5D, 0xA7, 0xDB, 0x38, 0xFD, 0xAF, 0x91, 0x72, 0x43, 0x64,
+	0xDC, 0xC1, 0x8E, 0x86, 0x48, 0xB9, 0xD4, 0x57, 0x97, 0x22, 0xE5, 0x52, 0x5F, 0x5D, 0xEA, 0xB3,
+	0x4B, 0x7D, 0x75, 0xA9, 0xCF, 0xAE, 0xD3, 0x75, 0xBA, 0x2D, 0xD3, 0x1D, 0xEC, 0x68, 0x88, 0x8C,
+	0x3B, 0xD8, 0xD1, 0x10, 0x29, 0x97, 0x22, 0xE3, 0x52, 0xA4, 0x5C, 0xEA, 0xAB, 0x4B, 0x7D, 0x76,
+	0xA9, 0xAF, 0x2E, 0xF5, 0xD9, 0x75, 0xBA, 0x4E, 0xB7, 0x79, 0xFA, 0x4F, 0x6E, 0x36, 0x1B, 0x22,
+	0xE5, 0x52, 0x64, 0x5C, 0x8A, 0x94, 0x4B, 0x7D, 0x75, 0xA9, 0xCF, 0x2E, 0xF5, 0xD5, 0xA5, 0x3E,
+	0xBB, 0xA1, 0xAF, 0xAE, 0xD3, 0x75, 0xBA, 0x95, 0xD3, 0xFF, 0x16, 0x29, 0x97, 0x22, 0xE3, 0x52,
+	0xA4, 0x5C, 0xEA, 0xAB, 0x4B, 0x91, 0x72, 0xA9, 0xAF, 0x2E, 0xF5, 0xD9, 0x0D, 0x7D, 0x75, 0x87,
+	0xC0, 0x1A, 0xFA, 0xEC, 0x3A, 0x5D, 0xA7, 0x5B, 0x33, 0x1D, 0x66, 0xB3, 0x14, 0x19, 0x97, 0x22,
+	0xE5, 0x52, 0x64, 0x5C, 0x8A, 0x94, 0x4B, 0x7D, 0x75, 0xA9, 0xCF, 0x6E, 0xE8, 0xAB, 0x3B, 0x04,
+	0xD6, 0xD0, 0x67, 0xD7, 0xE9, 0x3A, 0xDD, 0xEA, 0xE9, 0xDC, 0x6C, 0x96, 0x22, 0xE5, 0x52, 0x64,
+	0x5C, 0x8A, 0x94, 0x4B, 0x7D, 0x75, 0xA9, 0xCF, 0x6E, 0xE8, 0xAB, 0x3B, 0x04, 0xD6, 0xD0, 0x67,
+	0x97, 0xFA, 0xEA, 0x3A, 0x5D, 0xA7, 0x5B, 0x37, 0xDD, 0x14, 0x29, 0x97, 0x22, 0xE3, 0x52, 0xA4,
+	0x5C, 0xEA, 0xAB, 0x4B, 0x91, 0x72, 0x43, 0x5F, 0xDD, 0x21, 0xB0, 0x86, 0x3E, 0xBB, 0xD4, 0x57,
+	0x97, 0xFA, 0xEC, 0x3A, 0x5D, 0xA7, 0x5B, 0x31, 0x9D, 0x30, 0xA4, 0x14, 0x19, 0x97, 0x22, 0xE5,
+	0x52, 0x5F, 0x5D, 0x8A, 0x94, 0x1B, 0xFA, 0xEA, 0x0E, 0x81, 0x35, 0xF4, 0xD9, 0xA5, 0xBE, 0xBA,
+	0xD4, 0x67, 0xD7, 0xE9, 0x3A, 0xDD, 0xDA, 0xE9, 0x7F, 0x8A, 0x8C, 0x4B, 0x91, 0x72, 0x29, 0x32,
+	0x2E, 0x45, 0xCA, 0x0D, 0x7D, 0x75, 0x87, 0xC0, 0x1A, 0xFA, 0xEC, 0x52, 0x5F, 0x5D, 0xEA, 0xB3,
+	0x4B, 0x7D, 0x75, 0x9D, 0xAE, 0xD3, 0xAD, 0x9A, 0x2E, 0x45, 0xCA, 0xA5, 0xC8, 0xB8, 0x14, 0x29,
+	0x37, 0xF4, 0xD5, 0x1D, 0x0C, 0x69, 0x88, 0x94, 0x4B, 0x7D, 0x75, 0xA9, 0xCF, 0x2E, 0xF5, 0xD5,
+	0x75, 0xBA, 0x4E, 0xB7, 0x7E, 0xBA, 0xDB, 0x6C, 0x96, 0x22, 0xE3, 0x52, 0xA4, 0xDC, 0xD0, 0x57,
+	0x77, 0xB0, 0xA3, 0x21, 0x52, 0x2E, 0xF5, 0xD5, 0xA5, 0x3E, 0xBB, 0xD4, 0x57, 0x97, 0xFA, 0xEC,
+	0x3A, 0x5D, 0xA7, 0x5B, 0x39, 0xFD, 0x6F, 0x91, 0x71, 0x29, 0x52, 0x6E, 0x88, 0x8C, 0x3B, 0xD8,
+	0xD1, 0x10, 0x29, 0x97, 0xFA, 0xEA, 0x52, 0x9F, 0x5D, 0xEA, 0xAB, 0x4B, 0x7D, 0x76, 0xA9, 0xAF,
+	0xAE, 0xD3, 0x75, 0xBA, 0x35, 0xD3, 0x71, 0x65, 0xA4, 0x48, 0xB9, 0x21, 0x32, 0xEE, 0x60, 0x47,
+	0x43, 0xA4, 0x5C, 0xEA, 0xAB, 0x4B, 0x91, 0x72, 0xA9, 0xAF, 0x2E, 0xF5, 0xD9, 0xA5, 0xBE, 0xBA,
+	0x4E, 0xD7, 0xE9, 0x56, 0x4F, 0xE7, 0x66, 0xB3, 0x21, 0x32, 0xEE, 0x60, 0x47, 0x43, 0xA4, 0x5C,
+	0xEA, 0xAB, 0x4B, 0x91, 0x72, 0xA9, 0xAF, 0x2E, 0xF5, 0xD9, 0xA5, 0xBE, 0xBA, 0xD4, 0x67, 0xD7,
+	0xE9, 0x3A, 0xDD, 0xBA, 0xE9, 0x7F, 0x89, 0x8C, 0x3B, 0xD8, 0xD1, 0x10, 0x29, 0x97, 0x22, 0xE3,
+	0x52, 0xA4, 0x5C, 0xEA, 0xAB, 0x4B, 0x7D, 0x76, 0xA9, 0xAF, 0x2E, 0xF5, 0xD9, 0x0D, 0x7D, 0x75,
+	0x9D, 0xAE, 0xD3, 0xED, 0x99, 0x4E, 0xD8, 0xD1, 0x10, 0x29, 0x97, 0x22, 0xE3, 0x52, 0xA4, 0x5C,
+	0xEA, 0xAB, 0x4B, 0x91, 0x72, 0xA9, 0xAF, 0x2E, 0xF5, 0xD9, 0x0D, 0x7D, 0x75, 0x9D, 0xAE, 0xD3,
+	0xED, 0x9E, 0xCE, 0x22, 0xE5, 0x52, 0x64, 0x5C, 0x8A, 0x94, 0x4B, 0x7D, 0x75, 0x29, 0x52, 0x2E,
+	0xF5, 0xD5, 0xA5, 0x3E, 0xBB, 0xA1, 0xAF, 0xEE, 0x10, 0x57, 0x43, 0x9F, 0x5D, 0xA7, 0xEB, 0x74,
+	0xFB, 0xA6, 0x1B, 0x22, 0xE3, 0x52, 0xA4, 0x5C, 0x8A, 0x8C, 0x4B, 0x91, 0x72, 0xA9, 0xAF, 0x2E,
+	0xF5, 0xD9, 0x0D, 0x7D, 0x75, 0x87, 0xB8, 0x1A, 0xFA, 0xEC, 0x52, 0x5F, 0x5D, 0xA7, 0xEB, 0x74,
+	0x3B, 0xA6, 0xFF, 0xC2, 0x84, 0x52, 0x64, 0x5C, 0x8A, 0x94, 0x4B, 0x91, 0x73, 0x43, 0x1F, 0xDD,
+	0x21, 0xA4, 0x52, 0x5F, 0x5D, 0xEA, 0xB3, 0x1B, 0x22, 0xE7, 0x52, 0x1F, 0x5D, 0xA7, 0xEB, 0x74,
+	0x7B, 0xA7, 0xFF, 0x21, 0x32, 0x2E, 0x45, 0xCA, 0xA5, 0xC8, 0xB9, 0xA1, 0x8F, 0xEE, 0x10, 0x52,
+	0xA9, 0xAF, 0x2E, 0xF5, 0xD9, 0x0D, 0x91, 0x73, 0xA9, 0x8F, 0x2E, 0xF5, 0xD5, 0x75, 0xBA, 0x4E,
+	0xB7, 0x6B, 0xBA, 0x10, 0x29, 0x97, 0x22, 0xE7, 0x86, 0x3E, 0xBA, 0x43, 0x48, 0xA5, 0xBE, 0xBA,
+	0x14, 0x29, 0x37, 0x44, 0xCE, 0xA5, 0x3E, 0xBA, 0xD4, 0x57, 0x0F, 0xA2, 0xD3, 0x75, 0xBA, 0xF5,
+	0xD3, 0x5D, 0xE6, 0xB3, 0x14, 0x39, 0x37, 0xF4, 0xD1, 0x1D, 0x42, 0x2A, 0xF5, 0xD5, 0xA5, 0x48,
+	0xB9, 0x21, 0x72, 0x2E, 0xF5, 0xD1, 0xA5, 0xBE, 0xBA, 0xD4, 0x67, 0xD7, 0xE9, 0x3A, 0xDD, 0xCE,
+	0xE9, 0x7F, 0x89, 0x9C, 0x1B, 0xFA, 0xE8, 0x0E, 0x21, 0x95, 0x22, 0xE3, 0x52, 0xA4, 0xDC, 0x10,
+	0x39, 0x97, 0xFA, 0xE8, 0x52, 0x5F, 0x5D, 0xEA, 0xB3, 0x4B, 0x7D, 0xF7, 0xFF, 0xEF, 0xF4, 0xFF,
+	0x00,
+};
+static const cc_uint8 vec_raw_rle[2631] = {
+	0x05, 0xC1, 0x51, 0x0E, 0x84, 0x30, 0x08, 0x05, 0xC0, 0xFF, 0x3D, 0xC5, 0xBB, 0x5A, 0x2D, 0x2F,
+	0x96, 0x06, 0x8A, 0x41, 0xB4, 0xF1, 0xF6, 0x3B, 0xB3, 0x69, 0x3D, 0x9C, 0xD8, 0xB4, 0x1E, 0x4E,
+	0x54, 0x60, 0x86, 0x2E, 0x0A, 0x8E, 0x47, 0x4D, 0x50, 0x81, 0x0A, 0xCC, 0xD0, 0x45, 0xF9, 0xCD,
+	0xD0, 0x45, 0xF9, 0x55, 0x60, 0xD3, 0x7A, 0x38, 0x71, 0x36, 0x27, 0x6E, 0xE6, 0xCB, 0xC4, 0xF1,
+	0xA8, 0x09, 0xCE, 0xE6, 0x44, 0x0D, 0xE2, 0xB2, 0xF6, 0x31, 0xB1, 0x69, 0x3D, 0x9C, 0xBF, 0x0A,
+	0xD4, 0x20, 0x8E, 0x47, 0x4D, 0x70, 0x59, 0xFB, 0x98, 0x38, 0x1E, 0x35, 0x41, 0x0D, 0xA2, 0x02,
+	0x9B, 0xD6, 0xC3, 0x89, 0x4D, 0xEB, 0xE1, 0xFC, 0x6D, 0x5A, 0x0F, 0x27, 0x2A, 0x30, 0x43, 0x17,
+	0x05, 0x67, 0x73, 0xE2, 0x66, 0xBE, 0xCC, 0x5F, 0x0D, 0xE2, 0x6C, 0x4E, 0xCC, 0xD0, 0x45, 0xC1,
+	0x0C, 0x5D, 0x94, 0xDF, 0xF1, 0xA8, 0x09, 0x8E, 0x47, 0x4D, 0x70, 0x33, 0x5F, 0x26, 0x8E, 0x47,
+	0x4D, 0x50, 0x83, 0xB8, 0xAC, 0x7D, 0x4C, 0x5C, 0xD6, 0x3E, 0x26, 0x6E, 0xE6, 0xCB, 0xFC, 0x5D,
+	0xD6, 0x3E, 0x26, 0x6A, 0xF0, 0x77, 0x36, 0x27, 0x6A, 0x10, 0x15, 0xA8, 0xC0, 0xA6, 0xF5, 0x70,
+	0xE2, 0xB2, 0xF6, 0x31, 0x71, 0x59, 0xFB, 0x98, 0xB8, 0xAC, 0x7D, 0x4C, 0x1C, 0x8F, 0x9A, 0xE0,
+	0x66, 0xBE, 0x4C, 0xDC, 0xCC, 0x97, 0x89, 0x19, 0xBA, 0x28, 0xB8, 0x99, 0x2F, 0xF3, 0x77, 0x3C,
+	0x6A, 0x82, 0x4D, 0xEB, 0xE1, 0xC4, 0x65, 0xED, 0x63, 0xA2, 0x02, 0x15, 0x38, 0x9B, 0x13, 0x9B,
+	0xD6, 0xC3, 0xF9, 0xAB, 0x41, 0xCC, 0xD0, 0x45, 0xC1, 0x65, 0xED, 0x63, 0x62, 0xD3, 0x7A, 0x38,
+	0xB1, 0x69, 0x3D, 0x9C, 0x38, 0x9B, 0x13, 0x33, 0x74, 0x51, 0x70, 0x33, 0x5F, 0x26, 0x6E, 0xE6,
+	0xCB, 0xC4, 0xF1, 0xA8, 0x09, 0xCE, 0xE6, 0xC4, 0x0C, 0x5D, 0x14, 0x54, 0x60, 0xD3, 0x7A, 0x38,
+	0xB1, 0x69, 0x3D, 0x9C, 0xBF, 0x0A, 0x5C, 0xD6, 0x3E, 0x26, 0x6E, 0xE6, 0xCB, 0xC4, 0x65, 0xED,
+	0x63, 0xE2, 0x78, 0xD4, 0x04, 0x35, 0xF8, 0xBB, 0x99, 0x2F, 0x13, 0xC7, 0xA3, 0x26, 0xD8, 0xB4,
+	0x1E, 0x4E, 0x6C, 0x5A, 0x0F, 0x27, 0x36, 0xAD, 0x87, 0x13, 0xC7, 0xA3, 0x26, 0x98, 0xA1, 0x8B,
+	0x82, 0x9B, 0xF9, 0x32, 0x51, 0x81, 0x4D, 0xEB, 0xE1, 0x44, 0x0D, 0xE2, 0xB2, 0xF6, 0x31, 0x31,
+	0x43, 0x17, 0x05, 0x9B, 0xD6, 0xC3, 0x89, 0xCB, 0xDA, 0xC7, 0xC4, 0xCD, 0x7C, 0x99, 0xB8, 0x99,
+	0x2F, 0x13, 0x35, 0x88, 0xB3, 0x39, 0x71, 0x36, 0x27, 0x6E, 0xE6, 0xCB, 0xC4, 0xA6, 0xF5, 0x70,
+	0xFE, 0x66, 0xE8, 0xA2, 0x60, 0x86, 0x2E, 0x0A, 0x2A, 0x50, 0x81, 0xB3, 0x39, 0x71, 0x36, 0x27,
+	0x8E, 0x47, 0x4D, 0x50, 0x81, 0x19, 0xBA, 0x28, 0x98, 0xA1, 0x8B, 0xF2, 0x9B, 0xA1, 0x8B, 0x82,
+	0x1A, 0xC4, 0x0C, 0x5D, 0x14, 0xDC, 0xCC, 0x97, 0x89, 0xB3, 0x39, 0xB1, 0x69, 0x3D, 0x9C, 0xA8,
+	0x41, 0xDC, 0xCC, 0x97, 0x89, 0x9B, 0xF9, 0x32, 0x71, 0x36, 0x27, 0x6E, 0xE6, 0xCB, 0xC4, 0xD9,
+	0x9C, 0x98, 0xA1, 0x8B, 0x82, 0x1A, 0xFC, 0xD5, 0x20, 0x2A, 0x50, 0x83, 0x38, 0x9B, 0x13, 0x35,
+	0x88, 0xE3, 0x51, 0x13, 0xCC, 0xD0, 0x45, 0xF9, 0x6D, 0x5A, 0x0F, 0x27, 0x66, 0xE8, 0xA2, 0x60,
+	0x86, 0x2E, 0x0A, 0x36, 0xAD, 0x87, 0x13, 0x35, 0x88, 0xE3, 0x51, 0x13, 0x9C, 0xCD, 0x89, 0x4D,
+	0xEB, 0xE1, 0xC4, 0xF1, 0xA8, 0x09, 0x66, 0xE8, 0xA2, 0x60, 0xD3, 0x7A, 0x38, 0x7F, 0x35, 0x88,
+	0x19, 0xBA, 0x28, 0xBF, 0x0A, 0x9C, 0xCD, 0x89, 0xB3, 0x39, 0x51, 0x81, 0x1A, 0xC4, 0xA6, 0xF5,
+	0x70, 0xE2, 0x78, 0xD4, 0x04, 0x35, 0x88, 0x9B, 0xF9, 0x32, 0x71, 0x3C, 0x6A, 0x82, 0x19, 0xBA,
+	0x28, 0xA8, 0x40, 0x0D, 0xE2, 0xB2, 0xF6, 0x31, 0x71, 0x59, 0xFB, 0x98, 0xB8, 0xAC, 0x7D, 0x4C,
+	0xDC, 0xCC, 0x97, 0xF9, 0x3B, 0x9B, 0x13, 0x15, 0x38, 0x9B, 0x13, 0x33, 0x74, 0x51, 0x50, 0x81,
+	0xE3, 0x51, 0x13, 0xDC, 0xCC, 0x97, 0xF9, 0x9B, 0xA1, 0x8B, 0x82, 0xCB, 0xDA, 0xC7, 0xC4, 0xA6,
+	0xF5, 0x70, 0xE2, 0x66, 0xBE, 0x4C, 0xD4, 0x20, 0x8E, 0x47, 0x4D, 0x70, 0x59, 0xFB, 0x98, 0xD8,
+	0xB4, 0x1E, 0x4E, 0x6C, 0x5A, 0x0F, 0x27, 0xCE, 0xE6, 0xC4, 0xCD, 0x7C, 0x99, 0xB8, 0xAC, 0x7D,
+	0x4C, 0x54, 0xE0, 0xB2, 0xF6, 0x31, 0x31, 0x43, 0x17, 0xE5, 0xB7, 0x69, 0x3D, 0x9C, 0xB8, 0xAC,
+	0x7D, 0x4C, 0x6C, 0x5A, 0x0F, 0x27, 0x66, 0xE8, 0xA2, 0x60, 0xD3, 0x7A, 0x38, 0x31, 0x43, 0x17,
+	0x05, 0x97, 0xB5, 0x8F, 0x89, 0x1A, 0xFC, 0x6D, 0x5A, 0x0F, 0x27, 0x2A, 0x70, 0x3C, 0x6A, 0x82,
+	0x0A, 0xCC, 0xD0, 0x45, 0x41, 0x0D, 0x62, 0x86, 0x2E, 0x0A, 0x8E, 0x47, 0x4D, 0x50, 0x81, 0xB3,
+	0x39, 0xB1, 0x69, 0x3D, 0x9C, 0xBF, 0xCB, 0xDA, 0xC7, 0xC4, 0x0C, 0x5D, 0x14, 0x6C, 0x5A, 0x0F,
+	0xE7, 0xEF, 0x6C, 0x4E, 0x54, 0xE0, 0x66, 0xBE, 0x4C, 0x1C, 0x8F, 0x9A, 0xA0, 0x06, 0x7F, 0x33,
+	0x74, 0x51, 0x50, 0x83, 0xD8, 0xB4, 0x1E, 0xCE, 0xDF, 0xA6, 0xF5, 0x70, 0xFE, 0x6E, 0xE6, 0xCB,
+	0xC4, 0xCD, 0x7C, 0x99, 0x38, 0x1E, 0x35, 0xC1, 0xD9, 0x9C, 0x98, 0xA1, 0x8B, 0x82, 0xB3, 0x39,
+	0x51, 0x81, 0x9B, 0xF9, 0x32, 0x71, 0x3C, 0x6A, 0x82, 0xB3, 0x39, 0x71, 0x36, 0x27, 0x66, 0xE8,
+	0xA2, 0x60, 0xD3, 0x7A, 0x38, 0x71, 0x3C, 0x6A, 0x82, 0xE3, 0x51, 0x13, 0xCC, 0xD0, 0x45, 0xC1,
+	0xA6, 0xF5, 0x70, 0xFE, 0x8E, 0x47, 0x4D, 0x70, 0x36, 0x27, 0x2A, 0x30, 0x43, 0x17, 0xE5, 0x77,
+	0x36, 0x27, 0x2A, 0x70, 0x3C, 0x6A, 0x82, 0x0A, 0xD4, 0xE0, 0xEF, 0x78, 0xD4, 0x04, 0x35, 0x88,
+	0xCB, 0xDA, 0xC7, 0xC4, 0x0C, 0x5D, 0x14, 0x1C, 0x8F, 0x9A, 0xE0, 0x78, 0xD4, 0x04, 0x33, 0x74,
+	0x51, 0x70, 0x33, 0x5F, 0x26, 0x8E, 0x47, 0x4D, 0xB0, 0x69, 0x3D, 0x9C, 0xB8, 0xAC, 0x7D, 0x4C,
+	0x6C, 0x5A, 0x0F, 0xE7, 0x6F, 0x86, 0x2E, 0x0A, 0x6A, 0x10, 0x15, 0xB8, 0x99, 0x2F, 0x13, 0x67,
+	0x73, 0xA2, 0x02, 0x35, 0xF8, 0xDB, 0xB4, 0x1E, 0xCE, 0x5F, 0x05, 0x2A, 0x70, 0x3C, 0x6A, 0x82,
+	0xB3, 0x39, 0x71, 0x59, 0xFB, 0x98, 0xD8, 0xB4, 0x1E, 0x4E, 0x1C, 0x8F, 0x9A, 0x60, 0x86, 0x2E,
+	0x0A, 0xCE, 0xE6, 0xC4, 0xA6, 0xF5, 0x70, 0xE2, 0x78, 0xD4, 0x04, 0x33, 0x74, 0x51, 0xB0, 0x69,
+	0x3D, 0x9C, 0xD8, 0xB4, 0x1E, 0x4E, 0x5C, 0xD6, 0x3E, 0x26, 0x6A, 0x10, 0x37, 0xF3, 0x65, 0xA2,
+	0x06, 0x51, 0x83, 0xBF, 0x4D, 0xEB, 0xE1, 0xFC, 0x5D, 0xD6, 0x3E, 0x26, 0x8E, 0x47, 0x4D, 0x70,
+	0x59, 0xFB, 0x98, 0xB8, 0x99, 0x2F, 0x13, 0x35, 0x88, 0x9B, 0xF9, 0x32, 0x7F, 0x97, 0xB5, 0x8F,
+	0x89, 0x9B, 0xF9, 0x32, 0x31, 0x43, 0x17, 0x05, 0x35, 0x88, 0xB3, 0x39, 0x51, 0x83, 0x98, 0xA1,
+	0x8B, 0xF2, 0x9B, 0xA1, 0x8B, 0x82, 0x9B, 0xF9, 0x32, 0x71, 0x59, 0xFB, 0x98, 0xB8, 0x99, 0x2F,
+	0x13, 0x35, 0x88, 0xE3, 0x51, 0x13, 0x54, 0xE0, 0x78, 0xD4, 0x04, 0x33, 0x74, 0x51, 0xB0, 0x69,
+	0x3D, 0x9C, 0xD8, 0xB4, 0x1E, 0x4E, 0x54, 0xE0, 0x6C, 0x4E, 0x9C, 0xCD, 0x89, 0xCB, 0xDA, 0xC7,
+	0x44, 0x0D, 0xE2, 0x78, 0xD4, 0x04, 0x37, 0xF3, 0x65, 0xA2, 0x06, 0x71, 0x33, 0x5F, 0xE6, 0xEF,
+	0x6C, 0x4E, 0xD4, 0x20, 0x2E, 0x6B, 0x1F, 0x13, 0x35, 0x88, 0xCB, 0xDA, 0xC7, 0x44, 0x05, 0x2E,
+	0x6B, 0x1F, 0x13, 0x33, 0x74, 0x51, 0x30, 0x43, 0x17, 0x05, 0x67, 0x73, 0x62, 0xD3, 0x7A, 0x38,
+	0x71, 0x33, 0x5F, 0x26, 0x66, 0xE8, 0xA2, 0xFC, 0x66, 0xE8, 0xA2, 0x60, 0x86, 0x2E, 0x0A, 0x2E,
+	0x6B, 0x1F, 0x13, 0x33, 0x74, 0x51, 0xB0, 0x69, 0x3D, 0x9C, 0xB8, 0x99, 0x2F, 0x13, 0x35, 0x88,
+	0x1A, 0xFC, 0x6D, 0x5A, 0x0F, 0x27, 0x8E, 0x47, 0x4D, 0x30, 0x43, 0x17, 0xE5, 0x77, 0x3C, 0x6A,
+	0x82, 0x1A, 0xC4, 0xA6, 0xF5, 0x70, 0xA2, 0x02, 0x37, 0xF3, 0x65, 0xFE, 0x6E, 0xE6, 0xCB, 0xC4,
+	0x0C, 0x5D, 0x14, 0x54, 0xE0, 0xB2, 0xF6, 0x31, 0x51, 0x83, 0xB8, 0x99, 0x2F, 0x13, 0x35, 0x88,
+	0xCB, 0xDA, 0xC7, 0xC4, 0xF1, 0xA8, 0x09, 0x2E, 0x6B, 0x1F, 0x13, 0x67, 0x73, 0x62, 0xD3, 0x7A,
+	0x38, 0x71, 0x59, 0xFB, 0x98, 0xB8, 0x99, 0x2F, 0x13, 0x67, 0x73, 0xA2, 0x02, 0x33, 0x74, 0x51,
+	0xB0, 0x69, 0x3D, 0x9C, 0x98, 0xA1, 0x8B, 0x82, 0x19, 0xBA, 0x28, 0xD8, 0xB4, 0x1E, 0x4E, 0x6C,
+	0x5A, 0x0F, 0xE7, 0xEF, 0x78, 0xD4, 0x04, 0xC7, 0xA3, 0x26, 0x38, 0x1E, 0x35, 0xC1, 0x0C, 0x5D,
+	0x14, 0x6C, 0x5A, 0x0F, 0x27, 0x6E, 0xE6, 0xCB, 0xC4, 0xCD, 0x7C, 0x99, 0x38, 0x9B, 0x13, 0x37,
+	0xF3, 0x65, 0xE2, 0x6C, 0x4E, 0xDC, 0xCC, 0x97, 0x89, 0xB3, 0x39, 0x71, 0x3C, 0x6A, 0x82, 0x1A,
+	0xC4, 0xF1, 0xA8, 0x09, 0x36, 0xAD, 0x87, 0x13, 0x67, 0x73, 0xE2, 0x66, 0xBE, 0x4C, 0x5C, 0xD6,
+	0x3E, 0x26, 0x2A, 0xB0, 0x69, 0x3D, 0x9C, 0xB8, 0x99, 0x2F, 0x13, 0x15, 0xA8, 0x41, 0xDC, 0xCC,
+	0x97, 0x89, 0x19, 0xBA, 0x28, 0xA8, 0x41, 0x5C, 0xD6, 0x3E, 0x26, 0x66, 0xE8, 0xA2, 0xE0, 0x78,
+	0xD4, 0x04, 0x97, 0xB5, 0x8F, 0x89, 0xE3, 0x51, 0x13, 0x9C, 0xCD, 0x89, 0xE3, 0x51, 0x13, 0x6C,
+	0x5A, 0x0F, 0x27, 0x2A, 0x30, 0x43, 0x17, 0x05, 0x35, 0xF8, 0xBB, 0x99, 0x2F, 0x13, 0x37, 0xF3,
+	0x65, 0x62, 0x86, 0x2E, 0x0A, 0x8E, 0x47, 0x4D, 0x50, 0x83, 0x98, 0xA1, 0x8B, 0x82, 0xB3, 0x39,
+	0x71, 0x59, 0xFB, 0x98, 0x38, 0x1E, 0x35, 0xC1, 0x0C, 0x5D, 0x14, 0x1C, 0x8F, 0x9A, 0xE0, 0x78,
+	0xD4, 0x04, 0x97, 0xB5, 0x8F, 0x89, 0x0A, 0xDC, 0xCC, 0x97, 0x89, 0xE3, 0x51, 0x13, 0x1C, 0x8F,
+	0x9A, 0xE0, 0xB2, 0xF6, 0x31, 0x71, 0x59, 0xFB, 0x98, 0x98, 0xA1, 0x8B, 0x82, 0xB3, 0x39, 0x51,
+	0x83, 0xA8, 0x41, 0xCC, 0xD0, 0x45, 0xC1, 0x65, 0xED, 0x63, 0xA2, 0x06, 0x51, 0x81, 0x1A, 0xFC,
+	0x55, 0xA0, 0x06, 0x51, 0x81, 0x9B, 0xF9, 0x32, 0x51, 0x83, 0xBF, 0xB3, 0x39, 0x31, 0x43, 0x17,
+	0x05, 0x97, 0xB5, 0x8F, 0x89, 0x19, 0xBA, 0x28, 0x38, 0x1E, 0x35, 0xC1, 0x65, 0xED, 0x63, 0x62,
+	0xD3, 0x7A, 0x38, 0x71, 0x33, 0x5F, 0x26, 0x66, 0xE8, 0xA2, 0x60, 0xD3, 0x7A, 0x38, 0x51, 0x81,
+	0x1A, 0xC4, 0x65, 0xED, 0x63, 0xE2, 0x78, 0xD4, 0x04, 0x35, 0x88, 0xE3, 0x51, 0x13, 0x5C, 0xD6,
+	0x3E, 0x26, 0xCE, 0xE6, 0x44, 0x05, 0xCE, 0xE6, 0xC4, 0x65, 0xED, 0x63, 0xA2, 0x02, 0x67, 0x73,
+	0xA2, 0x02, 0x15, 0xD8, 0xB4, 0x1E, 0x4E, 0x5C, 0xD6, 0x3E, 0x26, 0x2E, 0x6B, 0x1F, 0x13, 0x9B,
+	0xD6, 0xC3, 0xF9, 0xDB, 0xB4, 0x1E, 0xCE, 0x5F, 0x0D, 0x62, 0xD3, 0x7A, 0x38, 0xB1, 0x69, 0x3D,
+	0x9C, 0xA8, 0xC0, 0x0C, 0x5D, 0x14, 0x54, 0x60, 0x86, 0x2E, 0xCA, 0x6F, 0x86, 0x2E, 0xCA, 0xEF,
+	0xB2, 0xF6, 0x31, 0x51, 0x81, 0xB3, 0x39, 0x71, 0x36, 0x27, 0x8E, 0x47, 0x4D, 0x70, 0x33, 0x5F,
+	0x26, 0x66, 0xE8, 0xA2, 0x60, 0x86, 0x2E, 0x0A, 0x2E, 0x6B, 0x1F, 0x13, 0x15, 0xA8, 0xC1, 0x5F,
+	0x05, 0xCE, 0xE6, 0xC4, 0xF1, 0xA8, 0x09, 0x36, 0xAD, 0x87, 0xF3, 0x57, 0x83, 0x98, 0xA1, 0x8B,
+	0x82, 0x0A, 0xD4, 0xE0, 0xAF, 0x06, 0x71, 0x36, 0x27, 0x8E, 0x47, 0x4D, 0x70, 0x3C, 0x6A, 0x82,
+	0x1A, 0xC4, 0xCD, 0x7C, 0x99, 0x98, 0xA1, 0x8B, 0xF2, 0xAB, 0x41, 0x9C, 0xCD, 0x89, 0x19, 0xBA,
+	0x28, 0xBF, 0xCB, 0xDA, 0xC7, 0xC4, 0xD9, 0x9C, 0xB8, 0x99, 0x2F, 0xF3, 0x77, 0x3C, 0x6A, 0x82,
+	0x4D, 0xEB, 0xE1, 0xC4, 0xCD, 0x7C, 0x99, 0xBF, 0xB3, 0x39, 0x71, 0x33, 0x5F, 0xE6, 0xEF, 0x6C,
+	0x4E, 0x1C, 0x8F, 0x9A, 0xA0, 0x02, 0x33, 0x74, 0x51, 0x70, 0x59, 0xFB, 0x98, 0xB8, 0x99, 0x2F,
+	0x13, 0x37, 0xF3, 0x65, 0xE2, 0x6C, 0x4E, 0x5C, 0xD6, 0x3E, 0x26, 0x66, 0xE8, 0xA2, 0x60, 0x86,
+	0x2E, 0xCA, 0xEF, 0x66, 0xBE, 0x4C, 0x5C, 0xD6, 0x3E, 0x26, 0x6A, 0x10, 0x33, 0x74, 0x51, 0x7E,
+	0x15, 0xB8, 0xAC, 0x7D, 0x4C, 0x9C, 0xCD, 0x89, 0x1A, 0xC4, 0xF1, 0xA8, 0x09, 0x66, 0xE8, 0xA2,
+	0xFC, 0x8E, 0x47, 0x4D, 0x50, 0x81, 0x1A, 0xFC, 0xDD, 0xCC, 0x97, 0x89, 0xB3, 0x39, 0xB1, 0x69,
+	0x3D, 0x9C, 0x38, 0x1E, 0x35, 0xC1, 0xA6, 0xF5, 0x70, 0xE2, 0xB2, 0xF6, 0x31, 0xB1, 0x69, 0x3D,
+	0x9C, 0x98, 0xA1, 0x8B, 0x82, 0xE3, 0x51, 0x13, 0x1C, 0x8F, 0x9A, 0xA0, 0x06, 0x31, 0x43, 0x17,
+	0x05, 0x67, 0x73, 0x62, 0xD3, 0x7A, 0x38, 0x71, 0x3C, 0x6A, 0x82, 0x9B, 0xF9, 0x32, 0x51, 0x83,
+	0x98, 0xA1, 0x8B, 0x82, 0x19, 0xBA, 0x28, 0xA8, 0x41, 0xCC, 0xD0, 0x45, 0x41, 0x05, 0x2E, 0x6B,
+	0x1F, 0x13, 0x97, 0xB5, 0x8F, 0x89, 0x9B, 0xF9, 0x32, 0x71, 0x3C, 0x6A, 0x82, 0x4D, 0xEB, 0xE1,
+	0xC4, 0xA6, 0xF5, 0x70, 0x62, 0xD3, 0x7A, 0x38, 0x71, 0x59, 0xFB, 0x98, 0x38, 0x9B, 0x13, 0x37,
+	0xF3, 0x65, 0x62, 0xD3, 0x7A, 0x38, 0x71, 0x59, 0xFB, 0x98, 0xD8, 0xB4, 0x1E, 0x4E, 0x5C, 0xD6,
+	0x3E, 0x26, 0xCE, 0xE6, 0xC4, 0xCD, 0x7C, 0x99, 0xA8, 0x41, 0x9C, 0xCD, 0x89, 0x19, 0xBA, 0x28,
+	0xA8, 0xC0, 0xD9, 0x9C, 0x98, 0xA1, 0x8B, 0x82, 0xB3, 0x39, 0x71, 0x59, 0xFB, 0x98, 0x38, 0x1E,
+	0x35, 0xC1, 0xD9, 0x9C, 0x38, 0x9B, 0x13, 0x67, 0x73, 0xA2, 0x06, 0x71, 0x3C, 0x6A, 0x82, 0x9B,
+	0xF9, 0x32, 0x71, 0x3C, 0x6A, 0x82, 0x9B, 0xF9, 0x32, 0x51, 0x81, 0x0A, 0x9C, 0xCD, 0x89, 0x0A,
+	0x54, 0xE0, 0x78, 0xD4, 0x04, 0x37, 0xF3, 0x65, 0x62, 0xD3, 0x7A, 0x38, 0x71, 0x59, 0xFB, 0x98,
+	0x38, 0x9B, 0x13, 0x15, 0x38, 0x1E, 0x35, 0xC1, 0xA6, 0xF5, 0x70, 0x62, 0x86, 0x2E, 0x0A, 0x36,
+	0xAD, 0x87, 0xF3, 0xB7, 0x69, 0x3D, 0x9C, 0xA8, 0x41, 0x6C, 0x5A, 0x0F, 0x27, 0x6E, 0xE6, 0xCB,
+	0x44, 0x0D, 0xE2, 0xB2, 0xF6, 0x31, 0x71, 0x59, 0xFB, 0x98, 0xD8, 0xB4, 0x1E, 0xCE, 0xDF, 0xF1,
+	0xA8, 0x09, 0xCE, 0xE6, 0xC4, 0xD9, 0x9C, 0xA8, 0xC1, 0x5F, 0x05, 0x36, 0xAD, 0x87, 0x13, 0x37,
+	0xF3, 0x65, 0xE2, 0x78, 0xD4, 0x04, 0x35, 0x88, 0xCB, 0xDA, 0xC7, 0xC4, 0xF1, 0xA8, 0x09, 0x8E,
+	0x47, 0x4D, 0x30, 0x43, 0x17, 0x05, 0x33, 0x74, 0x51, 0x50, 0x81, 0xE3, 0x51, 0x13, 0xD4, 0x20,
+	0x36, 0xAD, 0x87, 0x13, 0x67, 0x73, 0xE2, 0x78, 0xD4, 0x04, 0x9B, 0xD6, 0xC3, 0xF9, 0x9B, 0xA1,
+	0x8B, 0x82, 0x1A, 0xC4, 0xD9, 0x9C, 0x98, 0xA1, 0x8B, 0x82, 0x19, 0xBA, 0x28, 0xBF, 0x0A, 0x9C,
+	0xCD, 0x89, 0x4D, 0xEB, 0xE1, 0xC4, 0x65, 0xED, 0x63, 0x62, 0xD3, 0x7A, 0x38, 0x51, 0x83, 0xB8,
+	0x99, 0x2F, 0x13, 0x37, 0xF3, 0x65, 0xE2, 0xB2, 0xF6, 0x31, 0x71, 0x33, 0x5F, 0xE6, 0xEF, 0xB2,
+	0xF6, 0x31, 0x71, 0x3C, 0x6A, 0x82, 0xCB, 0xDA, 0xC7, 0xC4, 0xA6, 0xF5, 0x70, 0xA2, 0x06, 0x71,
+	0x33, 0x5F, 0x26, 0x2A, 0xB0, 0x69, 0x3D, 0x9C, 0xD8, 0xB4, 0x1E, 0x4E, 0xCC, 0xD0, 0x45, 0x41,
+	0x05, 0x66, 0xE8, 0xA2, 0xFC, 0x6A, 0x10, 0x15, 0xD8, 0xB4, 0x1E, 0x4E, 0x1C, 0x8F, 0x9A, 0xE0,
+	0x6C, 0x4E, 0xD4, 0xE0, 0xEF, 0x78, 0xD4, 0x04, 0x67, 0x73, 0xE2, 0xB2, 0xF6, 0x31, 0x71, 0x59,
+	0xFB, 0x98, 0xA8, 0x40, 0x05, 0x2E, 0x6B, 0x1F, 0x13, 0x35, 0xF8, 0xBB, 0x99, 0x2F, 0x13, 0x33,
+	0x74, 0x51, 0xB0, 0x69, 0x3D, 0x9C, 0xBF, 0x4D, 0xEB, 0xE1, 0xC4, 0xD9, 0x9C, 0xB8, 0x99, 0x2F,
+	0xF3, 0x77, 0x36, 0x27, 0x6A, 0x10, 0x97, 0xB5, 0x8F, 0x89, 0x9B, 0xF9, 0x32, 0x51, 0x81, 0x0A,
+	0x54, 0xE0, 0xB2, 0xF6, 0x31, 0x31, 0x43, 0x17, 0x05, 0x15, 0xB8, 0x99, 0x2F, 0x13, 0x97, 0xB5,
+	0x8F, 0x89, 0xB3, 0x39, 0x51, 0x81, 0x9B, 0xF9, 0x32, 0x71, 0x33, 0x5F, 0x26, 0x2A, 0x70, 0x59,
+	0xFB, 0x98, 0xB8, 0x99, 0x2F, 0x13, 0x15, 0x98, 0xA1, 0x8B, 0x82, 0x4D, 0xEB, 0xE1, 0xC4, 0xA6,
+	0xF5, 0x70, 0xFE, 0xCE, 0xE6, 0xC4, 0xCD, 0x7C, 0x99, 0xB8, 0x99, 0x2F, 0x13, 0x15, 0xD8, 0xB4,
+	0x1E, 0x4E, 0xCC, 0xD0, 0x45, 0xC1, 0xA6, 0xF5, 0x70, 0x62, 0x86, 0x2E, 0x0A, 0x2E, 0x6B, 0x1F,
+	0x13, 0x67, 0x73, 0xE2, 0x66, 0xBE, 0x4C, 0x54, 0xA0, 0x02, 0xC7, 0xA3, 0x26, 0x38, 0x9B, 0x13,
+	0x35, 0x88, 0x9B, 0xF9, 0x32, 0x7F, 0x15, 0xA8, 0xC0, 0x0C, 0x5D, 0x14, 0x9C, 0xCD, 0x89, 0xCB,
+	0xDA, 0xC7, 0xC4, 0xA6, 0xF5, 0x70, 0xA2, 0x06, 0x31, 0x43, 0x17, 0xE5, 0x37, 0x43, 0x17, 0xE5,
+	0x77, 0x36, 0x27, 0x2A, 0x50, 0x83, 0xBF, 0x4D, 0xEB, 0xE1, 0xC4, 0xA6, 0xF5, 0x70, 0xE2, 0xB2,
+	0xF6, 0x31, 0x51, 0x81, 0x4D, 0xEB, 0xE1, 0x44, 0x05, 0xCE, 0xE6, 0xC4, 0xA6, 0xF5, 0x70, 0xA2,
+	0x06, 0x7F, 0xC7, 0xA3, 0x26, 0xB8, 0x99, 0x2F, 0xF3, 0x77, 0x33, 0x5F, 0x26, 0x66, 0xE8, 0xA2,
+	0x60, 0x86, 0x2E, 0x0A, 0x2A, 0x70, 0x59, 0xFB, 0x98, 0x38, 0x1E, 0x35, 0xC1, 0xD9, 0x9C, 0xB8,
+	0x99, 0x2F, 0x13, 0x67, 0x73, 0x62, 0xD3, 0x7A, 0x38, 0x51, 0x83, 0x38, 0x1E, 0x35, 0xC1, 0x65,
+	0xED, 0x63, 0x62, 0xD3, 0x7A, 0x38, 0x71, 0x59, 0xFB, 0x98, 0xD8, 0xB4, 0x1E, 0xCE, 0x5F, 0x05,
+	0x2E, 0x6B, 0x1F, 0x13, 0xC7, 0xA3, 0x26, 0xD8, 0xB4, 0x1E, 0x4E, 0x9C, 0xCD, 0x89, 0x1A, 0xC4,
+	0x65, 0xED, 0x63, 0xE2, 0x66, 0xBE, 0x4C, 0x9C, 0xCD, 0x89, 0xB3, 0x39, 0x71, 0x36, 0x27, 0x6E,
+	0xE6, 0xCB, 0xC4, 0xA6, 0xF5, 0x70, 0x62, 0xD3, 0x7A, 0x38, 0x51, 0x81, 0xE3, 0x51, 0x13, 0x54,
+	0xE0, 0x78, 0xD4, 0x04, 0x9B, 0xD6, 0xC3, 0xF9, 0xAB, 0x41, 0xCC, 0xD0, 0x45, 0x41, 0x05, 0xCE,
+	0xE6, 0xC4, 0xF1, 0xA8, 0x09, 0x6A, 0xF0, 0x77, 0x3C, 0x6A, 0x82, 0xE3, 0x51, 0x13, 0x1C, 0x8F,
+	0x9A, 0xE0, 0xB2, 0xF6, 0x31, 0x71, 0x59, 0xFB, 0x98, 0xA8, 0x40, 0x0D, 0xE2, 0x66, 0xBE, 0x4C,
+	0xCC, 0xD0, 0x45, 0xC1, 0xA6, 0xF5, 0x70, 0x62, 0x86, 0x2E, 0x0A, 0x6A, 0xF0, 0x57, 0x81, 0x19,
+	0xBA, 0x28, 0xB8, 0xAC, 0x7D, 0x4C, 0x54, 0xE0, 0xB2, 0xF6, 0x31, 0x51, 0x83, 0xA8, 0x41, 0x9C,
+	0xCD, 0x89, 0xCB, 0xDA, 0xC7, 0x44, 0x05, 0x6E, 0xE6, 0xCB, 0xFC, 0xDD, 0xCC, 0x97, 0x89, 0x19,
+	0xBA, 0x28, 0x38, 0x9B, 0x13, 0x35, 0x88, 0xCB, 0xDA, 0xC7, 0x44, 0x0D, 0xFE, 0xCE, 0xE6, 0xC4,
+	0xD9, 0x9C, 0xA8, 0xC0, 0xF1, 0xA8, 0x09, 0x2E, 0x6B, 0x1F, 0x13, 0x35, 0x88, 0x0A, 0xCC, 0xD0,
+	0x45, 0xF9, 0xD5, 0xE0, 0xEF, 0x66, 0xBE, 0x4C, 0xDC, 0xCC, 0x97, 0x89, 0x9B, 0xF9, 0x32, 0x71,
+	0x36, 0x27, 0x2E, 0x6B, 0x1F, 0x13, 0xC7, 0xA3, 0x26, 0x38, 0x9B, 0x13, 0x97, 0xB5, 0x8F, 0x89,
+	0x4D, 0xEB, 0xE1, 0xC4, 0xA6, 0xF5, 0x70, 0xA2, 0x06, 0x71, 0x33, 0x5F, 0x26, 0x8E, 0x47, 0x4D,
+	0x30, 0x43, 0x17, 0x05, 0x9B, 0xD6, 0xFF,
+};
+static const cc_uint8 vec_zip[1838] = {
+	0x50, 0x4B, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x74, 0x65,
+	0x78, 0x74, 0x75, 0x72, 0x65, 0x73, 0x2F, 0x50, 0x4B, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x21, 0x00, 0x2D, 0x02, 0x8C, 0x3D, 0xC0, 0x04, 0x00, 0x00, 0x88, 0x13, 0x00,
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x73, 0x2F, 0x74, 0x65,
+	0x72, 0x72, 0x61, 0x69, 0x6E, 0x2E, 0x70, 0x6E, 0x67, 0xED, 0xD7, 0xE3, 0x72, 0x1D, 0xEA, 0x02,
+	0x00, 0xD0, 0xD8, 0x6A, 0x6C, 0xB5, 0xB1, 0x6D, 0xA3, 0x88, 0x6D, 0xDB, 0xB6, 0xED, 0xA4, 0x41,
+	0x1B, 0xB6, 0xB1, 0x6D, 0xDB, 0xB6, 0x6D, 0x5B, 0xC5, 0xB9, 0x77, 0xCE, 0x7C, 0x6F, 0x71, 0x66,
+	0xB2, 0x1F, 0x61, 0xFD, 0x5C, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0, 0x08, 0x88, 0x48, 0xC8, 0x28,
+	0xA8, 0x68, 0xE8, 0x18, 0x98, 0x58, 0xEF, 0xB0, 0x71, 0x70, 0xF1, 0xF0, 0x09, 0x08, 0x89, 0x88,
+	0x49, 0x48, 0xC9, 0xC8, 0x29, 0x28, 0xA9, 0xA8, 0xDF, 0x7F, 0xA0, 0xA1, 0xA5, 0xA3, 0x67, 0x60,
+	0x64, 0x62, 0x66, 0x61, 0x65, 0x63, 0xE7, 0xE0, 0xE4, 0xE2, 0xE6, 0xE1, 0xE5, 0xE3, 0x17, 0x10,
+	0x14, 0x12, 0x16, 0x11, 0x15, 0x13, 0x97, 0x90, 0x94, 0x92, 0x96, 0x91, 0xFD, 0xF8, 0xE9, 0xF3,
+	0x17, 0x39, 0x79, 0x05, 0x45, 0x25, 0x65, 0x15, 0x55, 0x35, 0x75, 0x0D, 0x4D, 0x2D, 0x6D, 0x1D,
+	0x5D, 0x3D, 0x7D, 0x03, 0x43, 0x23, 0x63, 0x13, 0x53, 0x33, 0x73, 0x0B, 0x4B, 0x2B, 0x6B, 0x1B,
+	0x5B, 0x3B, 0x7B, 0x07, 0x47, 0x27, 0x67, 0x17, 0x57, 0x37, 0x77, 0x0F, 0x4F, 0x2F, 0x6F, 0x1F,
+	0x5F, 0x3F, 0xFF, 0x80, 0xC0, 0xA0, 0xE0, 0x90, 0xD0, 0xB0, 0xF0, 0x88, 0xC8, 0xA8, 0xE8, 0x98,
+	0xD8, 0xB8, 0xF8, 0x84, 0xC4, 0xA4, 0xAF, 0xC9, 0x29, 0xA9, 0x69, 0xDF, 0xBE, 0xA7, 0x67, 0x64,
+	0x66, 0x65, 0xE7, 0xFC, 0xF8, 0x99, 0x9B, 0x97, 0x5F, 0x50, 0x58, 0x54, 0x5C, 0x52, 0x5A, 0x56,
+	0x5E, 0x51, 0x59, 0x55, 0x5D, 0x53, 0x5B, 0x57, 0xDF, 0xD0, 0xD8, 0xD4, 0xDC, 0xD2, 0xDA, 0xD6,
+	0xDE, 0xD1, 0xD9, 0xD5, 0xDD, 0xD3, 0xDB, 0xD7, 0x3F, 0x30, 0x38, 0x34, 0x3C, 0x32, 0x3A, 0x36,
+	0x3E, 0x31, 0x39, 0x35, 0x3D, 0x33, 0x3B, 0x37, 0xBF, 0xB0, 0xB8, 0xB4, 0xBC, 0xB2, 0xBA, 0xB6,
+	0xBE, 0xB1, 0xB9, 0xB5, 0xBD, 0xB3, 0xBB, 0xB7, 0x7F, 0x70, 0x78, 0x74, 0x7C, 0x72, 0x7A, 0x76,
+	0x7E, 0x71, 0x79, 0x75, 0x7D, 0x73, 0x7B, 0x77, 0xFF, 0xF0, 0xF8, 0xF4, 0xFC, 0xF2, 0xFA, 0xEB,
+	0xF7, 0x1F, 0x28, 0x08, 0x1D, 0x42, 0x7F, 0xEB, 0x74, 0x3C, 0x5C, 0x02, 0x7C, 0x22, 0x42, 0x12,
+	0x62, 0x32, 0x52, 0x0A, 0x72, 0x2A, 0xCA, 0xF7, 0xD4, 0x34, 0x1F, 0xE8, 0x68, 0x19, 0xE8, 0x99,
+	0x18, 0x59, 0x98, 0xD9, 0x58, 0x39, 0xD8, 0xB9, 0x38, 0x79, 0xB8, 0xF9, 0x78, 0x05, 0xF8, 0x85,
+	0x04, 0x45, 0x84, 0xC5, 0x44, 0x25, 0xC4, 0xA5, 0x24, 0x65, 0xA4, 0x3F, 0xCA, 0x7E, 0xFE, 0x24,
+	0xF7, 0x45, 0x41, 0x5E, 0x49, 0x51, 0x45, 0x59, 0x4D, 0x55, 0x43, 0x5D, 0x4B, 0x53, 0x47, 0x5B,
+	0x4F, 0xD7, 0x40, 0xDF, 0xC8, 0xD0, 0xC4, 0xD8, 0xCC, 0xD4, 0xC2, 0xDC, 0xCA, 0xD2, 0xC6, 0xDA,
+	0xCE, 0xD6, 0xC1, 0xDE, 0xC9, 0xD1, 0xC5, 0xD9, 0xCD, 0xD5, 0xC3, 0xDD, 0xCB, 0xD3, 0xC7, 0xDB,
+	0xCF, 0x37, 0xC0, 0x3F, 0x28, 0x30, 0x24, 0x38, 0x2C, 0x34, 0x22, 0x3C, 0x2A, 0x32, 0x26, 0x3A,
+	0x2E, 0x36, 0x21, 0x3E, 0x29, 0x31, 0xF9, 0x6B, 0x6A, 0xCA, 0xB7, 0xB4, 0xF4, 0xEF, 0x99, 0x19,
+	0xD9, 0x59, 0x3F, 0x72, 0x72, 0x7F, 0xE6, 0xE7, 0x15, 0x16, 0x14, 0x17, 0x95, 0x96, 0x94, 0x97,
+	0x55, 0x56, 0x54, 0x57, 0xD5, 0xD6, 0xD4, 0xD7, 0x35, 0x36, 0x34, 0x37, 0xB5, 0xB6, 0xB4, 0xB7,
+	0x75, 0x76, 0x74, 0x77, 0xF5, 0xF6, 0xF4, 0xF7, 0x0D, 0x0E, 0x0C, 0x0F, 0x8D, 0x8E, 0x8C, 0x8F,
+	0x4D, 0x4E, 0x4C, 0x4F, 0xCD, 0xCE, 0xCC, 0xCF, 0x2D, 0x2E, 0x2C, 0x2F, 0xAD, 0xAE, 0xAC, 0xAF,
+	0x6D, 0x6E, 0x6C, 0x6F, 0xED, 0xEE, 0xEC, 0xEF, 0x1D, 0x1E, 0x1C, 0x1F, 0x9D, 0x9E, 0x9C, 0x9F,
+	0x5D, 0x5E, 0x5C, 0x5F, 0xDD, 0xDE, 0xDC, 0xDF, 0x3D, 0x3E, 0x3C, 0x3F, 0xBD, 0xBE, 0xFC, 0xFE,
+	0xF5, 0x17, 0x1A, 0x0A, 0x16, 0x06, 0x1E, 0x0E, 0x11, 0x01, 0x19, 0x09, 0x15, 0x05, 0x1D, 0x0D,
+	0x13, 0xE3, 0x1D, 0x16, 0x0E, 0x36, 0x84, 0x0E, 0xA1, 0xBF, 0x79, 0x3A, 0x23, 0x13, 0x3D, 0x03,
+	0x2B, 0x1B, 0x33, 0x0B, 0x27, 0x17, 0x3B, 0x07, 0x2F, 0x1F, 0x37, 0x8F, 0xA0, 0x10, 0xBF, 0x80,
+	0xA8, 0x98, 0xB0, 0x88, 0xA4, 0x94, 0xB8, 0x84, 0xEC, 0x47, 0x69, 0x99, 0x2F, 0x72, 0x9F, 0x3E,
+	0x2B, 0x2A, 0xC9, 0x2B, 0xA8, 0xAA, 0x29, 0xAB, 0x68, 0x6A, 0xA9, 0x6B, 0xE8, 0xEA, 0x69, 0xEB,
+	0x18, 0x1A, 0xE9, 0x1B, 0x98, 0x9A, 0x19, 0x9B, 0x58, 0x5A, 0x99, 0x5B, 0xD8, 0xDA, 0x59, 0xDB,
+	0x38, 0x3A, 0xD9, 0x3B, 0xB8, 0xBA, 0x39, 0xBB, 0x78, 0x7A, 0xB9, 0x7B, 0xF8, 0xFA, 0x79, 0xFB,
+	0x04, 0x06, 0xF9, 0x07, 0x84, 0x86, 0x05, 0x87, 0x44, 0x46, 0x85, 0x47, 0xC4, 0xC6, 0x45, 0xC7,
+	0x24, 0x26, 0xC5, 0x27, 0xA4, 0xA4, 0x7E, 0x4D, 0xFE, 0x9E, 0x9E, 0xF6, 0x2D, 0x2B, 0x3B, 0x23,
+	0xF3, 0x67, 0x6E, 0xCE, 0x8F, 0x82, 0xC2, 0xBC, 0xFC, 0x92, 0xD2, 0xA2, 0xE2, 0x8A, 0xCA, 0xB2,
+	0xF2, 0x9A, 0xDA, 0xAA, 0xEA, 0x86, 0xC6, 0xBA, 0xFA, 0x96, 0xD6, 0xA6, 0xE6, 0x8E, 0xCE, 0xB6,
+	0xF6, 0x9E, 0xDE, 0xAE, 0xEE, 0x81, 0xC1, 0xBE, 0xFE, 0x91, 0xD1, 0xA1, 0xE1, 0x89, 0xC9, 0xB1,
+	0xF1, 0x99, 0xD9, 0xA9, 0xE9, 0x85, 0xC5, 0xB9, 0xF9, 0x95, 0xD5, 0xA5, 0xE5, 0x8D, 0xCD, 0xB5,
+	0xF5, 0x9D, 0xDD, 0xAD, 0xED, 0x83, 0xC3, 0xBD, 0xFD, 0x93, 0xD3, 0xA3, 0xE3, 0x8B, 0xCB, 0xB3,
+	0xF3, 0x9B, 0xDB, 0xAB, 0xEB, 0x87, 0xC7, 0xBB, 0xFB, 0x97, 0xD7, 0xA7, 0xE7, 0x3F, 0x7F, 0x7F,
+	0xC1, 0xC0, 0x42, 0x41, 0x23, 0x20, 0xC2, 0xC1, 0xA3, 0xA0, 0x22, 0x21, 0x63, 0x60, 0xA2, 0xA1,
+	0x63, 0xE3, 0x60, 0xBD, 0xC3, 0x27, 0xC0, 0xC5, 0x23, 0x26, 0x21, 0x24, 0x22, 0xA7, 0x20, 0x25,
+	0xA3, 0x7E, 0x4F, 0x49, 0x45, 0x4B, 0xF7, 0x81, 0x06, 0x42, 0x87, 0xD0, 0xDF, 0x3C, 0x5D, 0x4C,
+	0x54, 0x44, 0x58, 0x4A, 0x52, 0x42, 0xFC, 0xA3, 0xAC, 0x8C, 0xB4, 0xDC, 0x97, 0xCF, 0x9F, 0x94,
+	0x14, 0x15, 0xE4, 0xD5, 0x54, 0x55, 0x94, 0xB5, 0x34, 0x35, 0xD4, 0xF5, 0x74, 0x75, 0xB4, 0x8D,
+	0x0C, 0x0D, 0xF4, 0xCD, 0x4C, 0x4D, 0x8C, 0xAD, 0x2C, 0x2D, 0xCC, 0xED, 0x6C, 0x6D, 0xAC, 0x9D,
+	0x1C, 0x1D, 0xEC, 0xDD, 0x5C, 0x5D, 0x9C, 0xBD, 0x3C, 0x3D, 0xDC, 0xFD, 0x7C, 0x7D, 0xBC, 0x83,
+	0x02, 0x03, 0xFC, 0xC3, 0x42, 0x43, 0x82, 0xA3, 0x22, 0x23, 0xC2, 0xE3, 0x62, 0x63, 0xA2, 0x93,
+	0x12, 0x13, 0xE2, 0x53, 0x53, 0x92, 0xBF, 0xA6, 0x7F, 0xFF, 0x96, 0x96, 0x9D, 0x95, 0x99, 0x91,
+	0xFB, 0xF3, 0x47, 0x4E, 0x61, 0x41, 0x7E, 0x5E, 0x69, 0x49, 0x71, 0x51, 0x65, 0x45, 0x79, 0x59,
+	0x6D, 0x4D, 0x75, 0x55, 0x63, 0x43, 0x7D, 0x5D, 0x6B, 0x4B, 0x73, 0x53, 0x67, 0x47, 0x7B, 0x5B,
+	0x6F, 0x4F, 0x77, 0xD7, 0xE0, 0x40, 0x7F, 0xDF, 0xE8, 0xC8, 0xF0, 0xD0, 0xE4, 0xC4, 0xF8, 0xD8,
+	0xEC, 0xCC, 0xF4, 0xD4, 0xE2, 0xC2, 0xFC, 0xDC, 0xEA, 0xCA, 0xF2, 0xD2, 0xE6, 0xC6, 0xFA, 0xDA,
+	0xEE, 0xCE, 0xF6, 0xD6, 0xE1, 0xC1, 0xFE, 0xDE, 0xE9, 0xC9, 0xF1, 0xD1, 0xE5, 0xC5, 0xF9, 0xD9,
+	0xED, 0xCD, 0xF5, 0xD5, 0xE3, 0xC3, 0xFD, 0xDD, 0xEB, 0xCB, 0xF3, 0xD3, 0xDF, 0x3F, 0xBF, 0x61,
+	0x61, 0xA0, 0xA1, 0x10, 0x11, 0xE0, 0xE1, 0x50, 0x51, 0x90, 0x91, 0x30, 0x31, 0xD0, 0xD1, 0x70,
+	0xB0, 0xDF, 0x61, 0x11, 0xE0, 0xE3, 0xE1, 0x92, 0x10, 0x13, 0x11, 0x52, 0x90, 0x93, 0x91, 0xBE,
+	0xA7, 0xA6, 0xA2, 0xA4, 0xA3, 0xA5, 0xF9, 0xC0, 0xC4, 0xC8, 0x40, 0xCF, 0xC6, 0xCA, 0xC2, 0xCC,
+	0xC5, 0xC9, 0xC1, 0xCE, 0xC7, 0xCB, 0xC3, 0x2D, 0x24, 0x28, 0xC0, 0x0F, 0xA1, 0x43, 0xE8, 0x6F,
+	0x9E, 0x0E, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02,
+	0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02,
+	0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02,
+	0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02,
+	0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02,
+	0x0A, 0x03, 0xEA, 0x02, 0x0A, 0xF3, 0xCF, 0xFF, 0xFE, 0x0F, 0xEA, 0x02, 0x0A, 0x03, 0xEA, 0x02,
+	0x0A, 0x03, 0xD6, 0x06, 0x0A, 0x03, 0xD6, 0x06, 0xF6, 0x06, 0xD6, 0x06, 0xF6, 0x06, 0xD6, 0x06,
+	0xF6, 0x06, 0xD6, 0x06, 0xF6, 0x06, 0xD6, 0x06, 0xF6, 0x06, 0xD6, 0x06, 0xF6, 0x06, 0xD6, 0x06,
+	0xF6, 0x06, 0xA1, 0x43, 0xE8, 0xFF, 0x19, 0xFA, 0xBF, 0x50, 0x4B, 0x03, 0x04, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x25, 0x51, 0x38, 0xEA, 0xC8, 0x00, 0x00, 0x00, 0xC8,
+	0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x72, 0x65, 0x61, 0x64, 0x6D, 0x65, 0x2E, 0x74, 0x78,
+	0x74, 0x77, 0x65, 0x6C, 0x63, 0x6F, 0x6D, 0x65, 0x20, 0x77, 0x65, 0x6C, 0x63, 0x6F, 0x6D, 0x65,
+	0x20, 0x74, 0x6F, 0x20, 0x6A, 0x6F, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64,
+	0x20, 0x74, 0x6F, 0x20, 0x74, 0x6F, 0x20, 0x6A, 0x6F, 0x69, 0x6E, 0x65, 0x64, 0x0A, 0x6A, 0x6F,
+	0x69, 0x6E, 0x65, 0x64, 0x0A, 0x74, 0x6F, 0x20, 0x77, 0x65, 0x6C, 0x63, 0x6F, 0x6D, 0x65, 0x20,
+	0x67, 0x61, 0x6D, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x62, 0x75, 0x69, 0x6C,
+	0x64, 0x20, 0x67, 0x61, 0x6D, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6C, 0x61, 0x79, 0x65,
+	0x72, 0x20, 0x77, 0x65, 0x6C, 0x63, 0x6F, 0x6D, 0x65, 0x0A, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+	0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x70, 0x6C, 0x61, 0x79, 0x65, 0x72, 0x20, 0x62, 0x75,
+	0x69, 0x6C, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x77, 0x65, 0x6C, 0x63, 0x6F,
+	0x6D, 0x65, 0x20, 0x77, 0x65, 0x6C, 0x63, 0x6F, 0x6D, 0x65, 0x0A, 0x77, 0x65, 0x6C, 0x63, 0x6F,
+	0x6D, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x6A, 0x6F, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x67, 0x61, 0x6D,
+	0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x0A, 0x74, 0x68, 0x65, 0x20, 0x67, 0x61, 0x6D,
+	0x65, 0x20, 0x6A, 0x6F, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x50, 0x4B, 0x03, 0x04, 0x14, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2E, 0x74, 0x78, 0x74,
+	0x50, 0x4B, 0x01, 0x02, 0x14, 0x03, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x74, 0x65,
+	0x78, 0x74, 0x75, 0x72, 0x65, 0x73, 0x2F, 0x50, 0x4B, 0x01, 0x02, 0x14, 0x03, 0x14, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2D, 0x02, 0x8C, 0x3D, 0xC0, 0x04, 0x00, 0x00, 0x88,
+	0x13, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+	0x01, 0x27, 0x00, 0x00, 0x00, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x73, 0x2F, 0x74, 0x65,
+	0x72, 0x72, 0x61, 0x69, 0x6E, 0x2E, 0x70, 0x6E, 0x67, 0x50, 0x4B, 0x01, 0x02, 0x14, 0x03, 0x14,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x25, 0x51, 0x38, 0xEA, 0xC8, 0x00, 0x00,
+	0x00, 0xC8, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x01, 0x19, 0x05, 0x00, 0x00, 0x72, 0x65, 0x61, 0x64, 0x6D, 0x65, 0x2E, 0x74, 0x78,
+	0x74, 0x50, 0x4B, 0x01, 0x02, 0x14, 0x03, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x09, 0x06, 0x00, 0x00, 0x65,
+	0x6D, 0x70, 0x74, 0x79, 0x2E, 0x74, 0x78, 0x74, 0x50, 0x4B, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x04, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const struct CompressionVector {
+	const char* name; int container, generator; cc_uint32 length;
+	const cc_uint8* data; cc_uint32 size;
+} vectors[] = {
+	{ "gzip_empty", CONTAINER_GZIP, 1, 0, vec_gzip_empty, 20 },
+	{ "gzip_named", CONTAINER_GZIP, 1, 4000, vec_gzip_named, 691 },
+	{ "zlib_fast", CONTAINER_ZLIB, 2, 3000, vec_zlib_fast, 815 },
+	{ "raw_stored", CONTAINER_RAW, 0, 300, vec_raw_stored, 305 },
+	{ "raw_fixed", CONTAINER_RAW, 1, 1000, vec_raw_fixed, 267 },
+	{ "raw_far", CONTAINER_RAW, 2, 70000, vec_raw_far, 4321 },
+	{ "raw_rle", CONTAINER_RAW, 1, 5000, vec_raw_rle, 2631 },
+};
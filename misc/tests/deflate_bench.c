@@ -0,0 +1,68 @@
+/* Measures compression speed and ratio of each DEFLATE compression level */
+/* Usage: deflate_bench [file ...] (uses generated data if no files are given) */
+/* NOTE: GZIP compressed files such as .cw maps are decompressed first */
+#include "TestUtils.h"
+#include "../../src/Deflate.h"
+#include "../../src/Platform.h"
+#include "../../src/Funcs.h"
+#include <stdio.h>
+
+static const struct { const char* name; cc_uint8 level; } levels[] = {
+	{ "fast", DEFLATE_LEVEL_FAST }, { "light", DEFLATE_LEVEL_LIGHT },
+	{ "default", DEFLATE_LEVEL_DEFAULT }, { "max", DEFLATE_LEVEL_MAX }
+};
+static struct DeflateState state;
+
+static void Bench_Deflate(const char* name, cc_uint8* data, cc_uint32 len) {
+	struct Stream dst, stream;
+	char desc[256];
+	cc_uint64 beg;
+	cc_result res;
+	int i;
+	MemStream_Create(&dst);
+
+	for (i = 0; i < Array_Elems(levels); i++) {
+		MemStream_Reset(&dst);
+		beg = Stopwatch_Measure();
+
+		Deflate_MakeStream(&stream, &state, &dst);
+		state.Level = levels[i].level;
+		res = Stream_Write(&stream, data, len);
+		if (!res) res = stream.Close(&stream);
+		if (res) { printf("%s: error %x compressing\n", name, res); break; }
+
+		snprintf(desc, sizeof(desc), "%s %s (%.1f%% of %u)", name, levels[i].name,
+				dst.Meta.Mem.Length * 100.0 / len, len);
+		Bench_Report(desc, beg, len);
+	}
+	dst.Close(&dst);
+}
+
+int main(int argc, char** argv) {
+	cc_uint32 len = 8 * 1024 * 1024;
+	cc_uint8* data;
+	cc_result res;
+	int i;
+	Platform_Init();
+	Deflate_Init();
+
+	if (argc > 1) {
+		for (i = 1; i < argc; i++) {
+			res = Test_ReadFile(argv[i], &data, &len);
+			if (!res) res = Test_GUnzip(&data, &len);
+
+			if (res) { printf("%s: error %x reading\n", argv[i], res); }
+			else     { Bench_Deflate(argv[i], data, len); }
+			Mem_Free(data);
+		}
+		return 0;
+	}
+
+	data = (cc_uint8*)Mem_Alloc(len, 1, "test data");
+	for (i = 0; i < TEST_DATA_COUNT; i++) {
+		TestData_Make(i, data, len);
+		Bench_Deflate(TestData_Names[i], data, len);
+	}
+	Mem_Free(data);
+	return 0;
+}
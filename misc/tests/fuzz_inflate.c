@@ -0,0 +1,37 @@
+/* libFuzzer entry point for GZipHeader_Read, ZLibHeader_Read and Inflate */
+/* The first byte of the input selects the container format, the rest is the compressed data */
+#include "../../src/Deflate.h"
+#include "../../src/Stream.h"
+#include <stddef.h>
+
+/* Tiny inputs can legitimately decompress to huge outputs, so stop after this much */
+#define FUZZ_MAX_OUTPUT (16 * 1024 * 1024)
+
+int LLVMFuzzerTestOneInput(const cc_uint8* data, size_t size) {
+	static struct InflateState inflate;
+	static cc_uint8 output[64 * 1024];
+	struct GZipHeader gzHeader;
+	struct ZLibHeader zlHeader;
+	struct Stream src, stream;
+	cc_uint32 read, total = 0;
+	cc_result res = 0;
+	if (!size) return 0;
+
+	Stream_ReadonlyMemory(&src, (void*)(data + 1), (cc_uint32)(size - 1));
+	if (data[0] % 3 == 1) {
+		GZipHeader_Init(&gzHeader);
+		while (!gzHeader.done && !(res = GZipHeader_Read(&src, &gzHeader))) { }
+	} else if (data[0] % 3 == 2) {
+		ZLibHeader_Init(&zlHeader);
+		while (!zlHeader.done && !(res = ZLibHeader_Read(&src, &zlHeader))) { }
+	}
+	if (res) return 0;
+
+	Inflate_MakeStream2(&stream, &inflate, &src);
+	while (total < FUZZ_MAX_OUTPUT) {
+		res = stream.Read(&stream, output, sizeof(output), &read);
+		if (res || !read) break;
+		total += read;
+	}
+	return 0;
+}
@@ -0,0 +1,61 @@
+/* libFuzzer entry point for Zip_Extract and the ZipIndex functions */
+#include "../../src/Deflate.h"
+#include "../../src/Stream.h"
+#include "../../src/Platform.h"
+#include <stddef.h>
+
+/* Entries claiming to be larger than this are skipped, to avoid running out of memory */
+#define FUZZ_MAX_ENTRY (1024 * 1024)
+
+static cc_result Fuzz_ProcessEntry(const cc_string* path, struct Stream* data, struct ZipState* state) {
+	static cc_uint8 buffer[64 * 1024];
+	cc_uint32 read, total = 0;
+	cc_result res;
+
+	while (total < FUZZ_MAX_ENTRY) {
+		res = data->Read(data, buffer, sizeof(buffer), &read);
+		if (res || !read) return res;
+		total += read;
+	}
+	return 0;
+}
+
+static void Fuzz_ZipIndex(struct Stream* src) {
+	struct ZipIndexEntry* entry;
+	struct ZipIndex index;
+	cc_uint8* raw;
+	cc_uint8* data;
+	cc_string path;
+	int i;
+
+	if (!ZipIndex_Load(&index, src)) {
+		for (i = 0; i < index.count; i++) {
+			entry = &index.entries[i];
+			path  = ZipIndex_GetPath(&index, i);
+			ZipIndex_Find(&index, &path);
+
+			if (entry->Base.CompressedSize > FUZZ_MAX_ENTRY || entry->Base.UncompressedSize > FUZZ_MAX_ENTRY) continue;
+			raw  = (cc_uint8*)Mem_Alloc(entry->Base.CompressedSize   + 1, 1, "raw entry");
+			data = (cc_uint8*)Mem_Alloc(entry->Base.UncompressedSize + 1, 1, "entry data");
+
+			if (!ZipIndex_ReadRaw(&index, i, raw)) ZipIndex_Decompress(entry, raw, data);
+			Mem_Free(raw);
+			Mem_Free(data);
+		}
+	}
+	ZipIndex_Free(&index);
+}
+
+int LLVMFuzzerTestOneInput(const cc_uint8* data, size_t size) {
+	static struct ZipState state;
+	struct Stream src;
+
+	Stream_ReadonlyMemory(&src, (void*)data, (cc_uint32)size);
+	Zip_Init(&state, &src);
+	state.ProcessEntry = Fuzz_ProcessEntry;
+	Zip_Extract(&state);
+
+	Stream_ReadonlyMemory(&src, (void*)data, (cc_uint32)size);
+	Fuzz_ZipIndex(&src);
+	return 0;
+}
@@ -0,0 +1,135 @@
+/* Measures decompression speed of Inflate */
+/* Usage: inflate_bench [file ...] (uses generated data if no files are given) */
+/* NOTE: Files must be GZIP compressed (e.g. .cw maps) or .zip archives (e.g. texture packs) */
+#include "TestUtils.h"
+#include "../../src/Deflate.h"
+#include "../../src/Platform.h"
+#include "../../src/String.h"
+#include "../../src/Funcs.h"
+#include <stdio.h>
+
+#define BENCH_ITERATIONS 5
+static struct InflateState inflate;
+
+static void Bench_GZip(const char* name, cc_uint8* data, cc_uint32 len) {
+	struct GZipHeader header;
+	struct Stream src, stream;
+	cc_uint8 buffer[64 * 1024];
+	cc_uint32 read, total = 0;
+	cc_result res = 0;
+	cc_uint64 beg;
+	int i;
+
+	beg = Stopwatch_Measure();
+	for (i = 0; i < BENCH_ITERATIONS && !res; i++) {
+		Stream_ReadonlyMemory(&src, data, len);
+		GZipHeader_Init(&header);
+		while (!header.done && !(res = GZipHeader_Read(&src, &header))) { }
+		Inflate_MakeStream2(&stream, &inflate, &src);
+
+		while (!res) {
+			res = stream.Read(&stream, buffer, sizeof(buffer), &read);
+			if (!read) break;
+			total += read;
+		}
+	}
+
+	if (res) { printf("%s: error %x decompressing\n", name, res); return; }
+	Bench_Report(name, beg, total);
+}
+
+static void Bench_Zip(const char* name, cc_uint8* data, cc_uint32 len) {
+	struct ZipIndexEntry* entry;
+	struct ZipIndex index;
+	struct Stream src;
+	cc_uint8** raw;
+	cc_uint8* dst;
+	cc_uint32 maxSize = 0, total = 0;
+	cc_result res;
+	cc_uint64 beg;
+	int i, j;
+
+	Stream_ReadonlyMemory(&src, data, len);
+	res = ZipIndex_Load(&index, &src);
+	if (res) { printf("%s: error %x reading .zip\n", name, res); ZipIndex_Free(&index); return; }
+	raw = (cc_uint8**)Mem_AllocCleared(index.count, sizeof(cc_uint8*), "raw entries");
+
+	/* Only the decompression itself is measured */
+	for (i = 0; i < index.count && !res; i++) {
+		entry = &index.entries[i];
+		if (entry->Method != 8) continue;
+
+		raw[i]  = (cc_uint8*)Mem_Alloc(entry->Base.CompressedSize + 1, 1, "raw entry");
+		res     = ZipIndex_ReadRaw(&index, i, raw[i]);
+		maxSize = max(maxSize, entry->Base.UncompressedSize);
+	}
+	dst = (cc_uint8*)Mem_Alloc(maxSize + 1, 1, "entry data");
+
+	beg = Stopwatch_Measure();
+	for (j = 0; j < BENCH_ITERATIONS && !res; j++) {
+		for (i = 0; i < index.count && !res; i++) {
+			if (!raw[i]) continue;
+			res    = ZipIndex_Decompress(&index.entries[i], raw[i], dst);
+			total += index.entries[i].Base.UncompressedSize;
+		}
+	}
+
+	if (res) { printf("%s: error %x decompressing\n", name, res); }
+	else     { Bench_Report(name, beg, total); }
+
+	for (i = 0; i < index.count; i++) Mem_Free(raw[i]);
+	Mem_Free(raw);
+	Mem_Free(dst);
+	ZipIndex_Free(&index);
+}
+
+static void Bench_File(const char* path) {
+	static const cc_string zip = String_FromConst(".zip");
+	cc_string str = String_FromReadonly(path);
+	cc_uint8* data;
+	cc_uint32 len;
+	cc_result res;
+
+	if ((res = Test_ReadFile(path, &data, &len))) { printf("%s: error %x reading\n", path, res); return; }
+
+	if (String_CaselessEnds(&str, &zip)) {
+		Bench_Zip(path, data, len);
+	} else {
+		Bench_GZip(path, data, len);
+	}
+	Mem_Free(data);
+}
+
+int main(int argc, char** argv) {
+	cc_uint32 len = 8 * 1024 * 1024;
+	struct GZipState state;
+	struct Stream dst, stream;
+	char desc[256];
+	cc_uint8* data;
+	int i;
+	Platform_Init();
+	Deflate_Init();
+
+	if (argc > 1) {
+		for (i = 1; i < argc; i++) Bench_File(argv[i]);
+		return 0;
+	}
+
+	data = (cc_uint8*)Mem_Alloc(len, 1, "test data");
+	MemStream_Create(&dst);
+	for (i = 0; i < TEST_DATA_COUNT; i++) {
+		TestData_Make(i, data, len);
+		MemStream_Reset(&dst);
+
+		GZip_MakeStream(&stream, &state, &dst);
+		if (Stream_Write(&stream, data, len) || stream.Close(&stream)) {
+			printf("%s: error compressing\n", TestData_Names[i]); continue;
+		}
+
+		snprintf(desc, sizeof(desc), "%s (%u to %u bytes)", TestData_Names[i], dst.Meta.Mem.Length, len);
+		Bench_GZip(desc, dst.Meta.Mem.Base, dst.Meta.Mem.Length);
+	}
+	dst.Close(&dst);
+	Mem_Free(data);
+	return 0;
+}
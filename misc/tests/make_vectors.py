@@ -0,0 +1,77 @@
+# Generates compression_vectors.h, which contains data compressed by zlib (via python's zlib, gzip
+#  and zipfile modules) that compression_test.c checks Inflate and Zip_Extract against
+# Usage: python3 make_vectors.py > compression_vectors.h
+import gzip, io, sys, zipfile, zlib
+
+# NOTE: These generators must match Vector_Generate in compression_test.c
+GEN_RANDOM, GEN_TEXT, GEN_PATTERN = 0, 1, 2
+WORDS = [b"the", b"player", b"joined", b"game", b"welcome", b"to", b"server", b"build"]
+
+def generate(kind, length):
+    out, state = bytearray(), 12345
+    while len(out) < length:
+        state = (state * 1103515245 + 12345) & 0xFFFFFFFF
+        value = state >> 16
+        i     = len(out)
+        if kind == GEN_RANDOM:
+            out.append(value & 0xFF)
+        elif kind == GEN_TEXT:
+            out += WORDS[value % len(WORDS)] + (b"\n" if value % 10 == 0 else b" ")
+        else:
+            out.append(((i % 251) ^ (i >> 10)) & 0xFF)
+    return bytes(out[:length])
+
+def deflate_raw(data, level, strategy=zlib.Z_DEFAULT_STRATEGY):
+    c = zlib.compressobj(level, zlib.DEFLATED, -15, 9, strategy)
+    return c.compress(data) + c.flush()
+
+def gzip_named(data, name):
+    buf = io.BytesIO()
+    with gzip.GzipFile(filename=name, mode="wb", compresslevel=9, fileobj=buf, mtime=0) as f:
+        f.write(data)
+    return buf.getvalue()
+
+def make_zip():
+    buf = io.BytesIO()
+    with zipfile.ZipFile(buf, "w") as z:
+        # ZipInfo has a fixed timestamp, so the output is the same every time
+        z.writestr(zipfile.ZipInfo("textures/"), b"")
+        z.writestr(zipfile.ZipInfo("textures/terrain.png"), generate(GEN_PATTERN, 5000), zipfile.ZIP_DEFLATED)
+        z.writestr(zipfile.ZipInfo("readme.txt"), generate(GEN_TEXT, 200), zipfile.ZIP_STORED)
+        z.writestr(zipfile.ZipInfo("empty.txt"), b"", zipfile.ZIP_STORED)
+    return buf.getvalue()
+
+# name, container, generator, uncompressed length, compressed data
+VECTORS = [
+    ("gzip_empty",    "GZIP", GEN_TEXT,    0,     gzip.compress(b"", mtime=0)),
+    ("gzip_named",    "GZIP", GEN_TEXT,    4000,  gzip_named(generate(GEN_TEXT, 4000), "chat.txt")),
+    ("zlib_fast",     "ZLIB", GEN_PATTERN, 3000,  zlib.compress(generate(GEN_PATTERN, 3000), 1)),
+    ("raw_stored",    "RAW",  GEN_RANDOM,  300,   deflate_raw(generate(GEN_RANDOM, 300), 0)),
+    ("raw_fixed",     "RAW",  GEN_TEXT,    1000,  deflate_raw(generate(GEN_TEXT, 1000), 6, zlib.Z_FIXED)),
+    ("raw_far",       "RAW",  GEN_PATTERN, 70000, deflate_raw(generate(GEN_PATTERN, 70000), 9)),
+    ("raw_rle",       "RAW",  GEN_TEXT,    5000,  deflate_raw(generate(GEN_TEXT, 5000), 6, zlib.Z_RLE)),
+]
+
+def c_array(name, data):
+    lines = ["static const cc_uint8 %s[%d] = {" % (name, max(1, len(data)))]
+    for i in range(0, len(data), 16):
+        lines.append("\t" + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    if not data: lines.append("\t0x00")
+    lines.append("};")
+    return "\n".join(lines)
+
+out = ["/* Generated by make_vectors.py - do not edit */"]
+for name, _, _, _, data in VECTORS:
+    out.append(c_array("vec_" + name, data))
+out.append(c_array("vec_zip", make_zip()))
+
+out.append("")
+out.append("static const struct CompressionVector {")
+out.append("\tconst char* name; int container, generator; cc_uint32 length;")
+out.append("\tconst cc_uint8* data; cc_uint32 size;")
+out.append("} vectors[] = {")
+for name, container, gen, length, data in VECTORS:
+    out.append('\t{ "%s", CONTAINER_%s, %d, %d, vec_%s, %d },' % (name, container, gen, length, name, len(data)))
+out.append("};")
+# NOTE: Written with CRLF line endings, like the rest of the source files
+sys.stdout.buffer.write(("\n".join(out) + "\n").replace("\n", "\r\n").encode())
@@ -0,0 +1,103 @@
+/* Tests the ring buffer that the network receive thread passes packets to the main thread through */
+/* Server.c is included directly, so that its static functions can be called */
+#include "../../src/Server.c"
+#include <stdio.h>
+
+static int test_failures;
+#define Test_Assert(cond) if (!(cond)) { printf("FAILED: %s (line %d)\n", #cond, __LINE__); test_failures++; }
+
+/* Only Server.c and the platform code are linked in, so define what the tests use from other files */
+struct _ProtocolData Protocol;
+struct _GameData Game;
+cc_bool cpe_needD3Fix;
+
+static int pings, hackControls, setBlocks, jumpResets;
+static void Test_Ping(cc_uint8* data)        { pings++; }
+static void Test_HackControl(cc_uint8* data) { hackControls++; }
+static void Test_SetBlock(cc_uint8* data)    { setBlocks++; }
+void LocalPlayer_ResetJumpVelocity(void)     { jumpResets++; }
+
+static void Test_Reset(void) {
+	pings = 0; hackControls = 0; setBlocks = 0; jumpResets = 0;
+	net_recv.head = 0; net_recv.tail = 0;
+	net_recv.lastOpcode = 0;
+	net_stats.packets   = 0;
+	cpe_needD3Fix       = false;
+}
+
+static void Test_Frame(const cc_uint8* data, int len) {
+	cc_uint8 buffer[64];
+	Mem_Copy(buffer, data, len);
+	Test_Assert(NetRecv_FramePackets(buffer, len) == len);
+}
+
+static void Test_PingThroughRing(void) {
+	static const cc_uint8 ping[1] = { OPCODE_PING };
+	Test_Reset();
+	Game.Time  = 10.0;
+	lastPacket = 0.0;
+
+	Test_Frame(ping, sizeof(ping));
+	NetRecv_Process();
+
+	Test_Assert(pings      == 1);
+	Test_Assert(jumpResets == 0);
+	Test_Assert(lastOpcode == OPCODE_PING);
+	Test_Assert(lastPacket == 10.0);
+	Test_Assert(net_stats.packets == 1);
+	Test_Assert(net_recv.tail == net_recv.head);
+}
+
+static void Test_D3Skip(void) {
+	static const cc_uint8 data[] = { OPCODE_HACK_CONTROL, 0,0,0,0,0,0,0, 0xFF, OPCODE_PING };
+	Test_Reset();
+	cpe_needD3Fix = true;
+
+	Test_Frame(data, sizeof(data));
+	NetRecv_Process();
+
+	Test_Assert(hackControls == 1);
+	Test_Assert(jumpResets   == 1);
+	Test_Assert(pings        == 1);
+	/* skipped byte isn't a real packet */
+	Test_Assert(net_stats.packets == 2);
+}
+
+static void Test_Wraparound(void) {
+	static const cc_uint8 data[] = { OPCODE_SET_BLOCK, 0,0,0,0,0,0,0, OPCODE_PING };
+	int i, total = 0;
+	Test_Reset();
+
+	/* Each iteration pushes 14 bytes, so the ring wraps around a few times */
+	for (i = 0; i < 3 * NET_RING_SIZE / 14; i++) {
+		Test_Frame(data, sizeof(data));
+		if ((i % 1000) == 999) NetRecv_Process();
+		total++;
+	}
+	NetRecv_Process();
+
+	Test_Assert(setBlocks == total);
+	Test_Assert(pings     == total);
+	Test_Assert(jumpResets == 0);
+	Test_Assert(net_recv.tail == net_recv.head);
+}
+
+int main(int argc, char** argv) {
+	Protocol.Sizes[OPCODE_PING]           = 1;
+	Protocol.Handlers[OPCODE_PING]        = Test_Ping;
+	Protocol.Sizes[OPCODE_HACK_CONTROL]   = 8;
+	Protocol.Handlers[OPCODE_HACK_CONTROL] = Test_HackControl;
+	Protocol.Sizes[OPCODE_SET_BLOCK]      = 8;
+	Protocol.Handlers[OPCODE_SET_BLOCK]   = Test_SetBlock;
+
+	net_recv.ring   = (cc_uint8*)Mem_Alloc(NET_RING_SIZE, 1, "network ring buffer");
+	net_recv.status = NET_RECV_RUNNING;
+
+	Test_PingThroughRing();
+	Test_D3Skip();
+	Test_Wraparound();
+
+	if (test_failures) { printf("net_ring_test: %d failures\n", test_failures); return 1; }
+	printf("net_ring_test: passed\n");
+	return 0;
+}
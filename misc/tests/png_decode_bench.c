@@ -0,0 +1,137 @@
+/* Measures decoding speed of Png_Decode */
+/* Usage: png_decode_bench [file ...] (uses generated images if no files are given) */
+/* NOTE: Files can be .png images, or .zip archives (e.g. texture packs) of .png images */
+#include "TestUtils.h"
+#include "../../src/Deflate.h"
+#include "../../src/Platform.h"
+#include "../../src/String.h"
+#include <stdio.h>
+
+#define BENCH_ITERATIONS 5
+
+/* Decodes the given PNG data, returning the number of bytes of pixels decoded */
+static cc_result Bench_DecodeOnce(cc_uint8* data, cc_uint32 len, cc_uint32* decoded) {
+	struct Bitmap bmp;
+	struct Stream src;
+	cc_result res;
+
+	Stream_ReadonlyMemory(&src, data, len);
+	res = Png_Decode(&bmp, &src);
+	if (res) return res;
+
+	*decoded += Bitmap_DataSize(bmp.width, bmp.height);
+	Mem_Free(bmp.scan0);
+	return 0;
+}
+
+static void Bench_Png(const char* name, cc_uint8* data, cc_uint32 len) {
+	cc_uint32 total = 0;
+	cc_result res = 0;
+	cc_uint64 beg;
+	int i;
+
+	beg = Stopwatch_Measure();
+	for (i = 0; i < BENCH_ITERATIONS && !res; i++) {
+		res = Bench_DecodeOnce(data, len, &total);
+	}
+
+	if (res) { printf("%s: error %x decoding\n", name, res); return; }
+	Bench_Report(name, beg, total);
+}
+
+static void Bench_Zip(const char* name, cc_uint8* data, cc_uint32 len) {
+	static const cc_string png = String_FromConst(".png");
+	struct ZipIndexEntry* entry;
+	struct ZipIndex index;
+	struct Stream src;
+	cc_uint8** pngs;
+	cc_uint8* raw;
+	cc_uint32 total = 0;
+	cc_string path;
+	cc_result res;
+	cc_uint64 beg;
+	int i, j;
+
+	Stream_ReadonlyMemory(&src, data, len);
+	res = ZipIndex_Load(&index, &src);
+	if (res) { printf("%s: error %x reading .zip\n", name, res); ZipIndex_Free(&index); return; }
+	pngs = (cc_uint8**)Mem_AllocCleared(index.count, sizeof(cc_uint8*), "png entries");
+
+	/* Only decoding the images is measured, not decompressing them from the .zip */
+	for (i = 0; i < index.count && !res; i++) {
+		entry = &index.entries[i];
+		path  = ZipIndex_GetPath(&index, i);
+		if (!String_CaselessEnds(&path, &png)) continue;
+
+		raw     = (cc_uint8*)Mem_Alloc(entry->Base.CompressedSize + 1, 1, "raw entry");
+		pngs[i] = (cc_uint8*)Mem_Alloc(entry->Base.UncompressedSize + 1, 1, "png entry");
+
+		res = ZipIndex_ReadRaw(&index, i, raw);
+		if (!res) res = ZipIndex_Decompress(entry, raw, pngs[i]);
+		Mem_Free(raw);
+	}
+
+	beg = Stopwatch_Measure();
+	for (j = 0; j < BENCH_ITERATIONS && !res; j++) {
+		for (i = 0; i < index.count; i++) {
+			if (!pngs[i]) continue;
+			/* texture packs often contain a few invalid images, so just skip those */
+			Bench_DecodeOnce(pngs[i], index.entries[i].Base.UncompressedSize, &total);
+		}
+	}
+
+	if (res) { printf("%s: error %x reading .zip entries\n", name, res); }
+	else     { Bench_Report(name, beg, total); }
+
+	for (i = 0; i < index.count; i++) Mem_Free(pngs[i]);
+	Mem_Free(pngs);
+	ZipIndex_Free(&index);
+}
+
+static void Bench_File(const char* path) {
+	static const cc_string zip = String_FromConst(".zip");
+	cc_string str = String_FromReadonly(path);
+	cc_uint8* data;
+	cc_uint32 len;
+	cc_result res;
+
+	if ((res = Test_ReadFile(path, &data, &len))) { printf("%s: error %x reading\n", path, res); return; }
+
+	if (String_CaselessEnds(&str, &zip)) {
+		Bench_Zip(path, data, len);
+	} else {
+		Bench_Png(path, data, len);
+	}
+	Mem_Free(data);
+}
+
+static void Bench_Generated(const char* name, int width, int height, int type, cc_bool alpha) {
+	struct Bitmap bmp;
+	struct Stream dst;
+	cc_result res;
+
+	TestData_MakeBitmap(&bmp, width, height, type);
+	MemStream_Create(&dst);
+
+	res = Png_Encode(&bmp, &dst, NULL, alpha, PNG_ENCODE_DEFAULT);
+	if (res) { printf("%s: error %x encoding\n", name, res); }
+	else     { Bench_Png(name, dst.Meta.Mem.Base, dst.Meta.Mem.Length); }
+
+	dst.Close(&dst);
+	Mem_Free(bmp.scan0);
+}
+
+int main(int argc, char** argv) {
+	int i;
+	Platform_Init();
+	Deflate_Init();
+
+	if (argc > 1) {
+		for (i = 1; i < argc; i++) Bench_File(argv[i]);
+		return 0;
+	}
+
+	Bench_Generated("terrain 1024x1024 RGBA",   1024, 1024, TEST_BITMAP_TERRAIN,    true);
+	Bench_Generated("screenshot 1920x1080 RGB", 1920, 1080, TEST_BITMAP_SCREENSHOT, false);
+	return 0;
+}
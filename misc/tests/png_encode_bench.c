@@ -0,0 +1,70 @@
+/* Measures how long Png_Encode takes in each encoding mode, and how large the output is */
+/* Usage: png_encode_bench [file.png ...] (uses generated bitmaps if no files are given) */
+#include "TestUtils.h"
+#include "../../src/Deflate.h"
+#include "../../src/Platform.h"
+#include <stdio.h>
+
+static const char* const modeNames[] = { "fast", "default", "smallest" };
+
+static void Bench_Encode(const char* name, struct Bitmap* bmp, cc_bool alpha) {
+	char desc[256];
+	struct Stream s;
+	cc_uint64 beg;
+	cc_result res;
+	int mode;
+	MemStream_Create(&s);
+
+	for (mode = PNG_ENCODE_FAST; mode <= PNG_ENCODE_SMALLEST; mode++) {
+		MemStream_Reset(&s);
+		beg = Stopwatch_Measure();
+		res = Png_Encode(bmp, &s, NULL, alpha, mode);
+		if (res) { printf("%s: error %x encoding\n", name, res); break; }
+
+		snprintf(desc, sizeof(desc), "%s %dx%d %s (%u bytes)", name, bmp->width, bmp->height,
+				modeNames[mode], s.Meta.Mem.Length);
+		Bench_Report(desc, beg, Bitmap_DataSize(bmp->width, bmp->height));
+	}
+	s.Close(&s);
+}
+
+static void Bench_EncodeFile(const char* path) {
+	struct Bitmap bmp;
+	struct Stream s;
+	cc_uint8* data;
+	cc_uint32 len;
+	cc_result res;
+
+	if ((res = Test_ReadFile(path, &data, &len))) { printf("%s: error %x reading\n", path, res); return; }
+	Stream_ReadonlyMemory(&s, data, len);
+	res = Png_Decode(&bmp, &s);
+
+	if (res) {
+		printf("%s: error %x decoding\n", path, res);
+	} else {
+		Bench_Encode(path, &bmp, true);
+		Mem_Free(bmp.scan0);
+	}
+	Mem_Free(data);
+}
+
+int main(int argc, char** argv) {
+	struct Bitmap bmp;
+	int i;
+	Platform_Init();
+	Deflate_Init();
+
+	if (argc > 1) {
+		for (i = 1; i < argc; i++) Bench_EncodeFile(argv[i]);
+		return 0;
+	}
+
+	TestData_MakeBitmap(&bmp, 256, 256, TEST_BITMAP_TERRAIN);
+	Bench_Encode("terrain", &bmp, true);
+	Mem_Free(bmp.scan0);
+
+	TestData_MakeBitmap(&bmp, 854, 480, TEST_BITMAP_SCREENSHOT);
+	Bench_Encode("screenshot", &bmp, false);
+	Mem_Free(bmp.scan0);
+	return 0;
+}
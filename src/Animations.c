@@ -22,6 +22,60 @@ static void Animations_Update(int loc, struct Bitmap* bmp, int stride);
 	mirrored at https://github.com/UnknownShadow200/ClassiCube/wiki/Minecraft-Classic-lava-animation-algorithm
 	Water animation originally written by cybertoon, big thanks!
 */
+/*########################################################################################################################*
+*----------------------------------------------------Liquid animation-----------------------------------------------------*
+*#########################################################################################################################*/
+/* The per-pixel loops below are done 4 pixels at a time when SSE2 or NEON is available */
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#define CC_ANIM_SSE2
+#include <emmintrin.h>
+#elif defined __ARM_NEON || defined __ARM_NEON__
+#define CC_ANIM_NEON
+#include <arm_neon.h>
+#endif
+/* Heats up each pot by the flame underneath it, then cools down that flame */
+/* NOTE: Each flame also randomly reignites, in the same order as when simulating pixel by pixel */
+static void LiquidAnimation_Heat(float* pot, float* flame, int count, float cooling,
+								RNGState* rnd, float chance, float reignite) {
+	int i = 0;
+#if defined CC_ANIM_SSE2
+	__m128 zero = _mm_setzero_ps(), cool = _mm_set1_ps(cooling);
+	for (; i + 4 <= count; i += 4) {
+		__m128 f = _mm_loadu_ps(flame + i);
+		_mm_storeu_ps(pot   + i, _mm_max_ps(_mm_add_ps(_mm_loadu_ps(pot + i), f), zero));
+		_mm_storeu_ps(flame + i, _mm_sub_ps(f, cool));
+	}
+#elif defined CC_ANIM_NEON
+	float32x4_t zero = vdupq_n_f32(0.0f), cool = vdupq_n_f32(cooling);
+	for (; i + 4 <= count; i += 4) {
+		float32x4_t f = vld1q_f32(flame + i);
+		vst1q_f32(pot   + i, vmaxq_f32(vaddq_f32(vld1q_f32(pot + i), f), zero));
+		vst1q_f32(flame + i, vsubq_f32(f, cool));
+	}
+#endif
+	for (; i < count; i++) {
+		pot[i] += flame[i];
+		if (pot[i] < 0.0f) pot[i] = 0.0f;
+		flame[i] -= cooling;
+	}
+
+	for (i = 0; i < count; i++) {
+		if (Random_Float(rnd) <= chance) flame[i] = reignite;
+	}
+}
+
+/* Converts a row of heat values to pixel colours */
+#if defined CC_ANIM_SSE2
+#define Liquid_PackColors(r, g, b, a) _mm_or_si128(\
+	_mm_or_si128(_mm_slli_epi32(_mm_cvttps_epi32(r), BITMAPCOL_R_SHIFT), _mm_slli_epi32(_mm_cvttps_epi32(g), BITMAPCOL_G_SHIFT)),\
+	_mm_or_si128(_mm_slli_epi32(_mm_cvttps_epi32(b), BITMAPCOL_B_SHIFT), _mm_slli_epi32(_mm_cvttps_epi32(a), BITMAPCOL_A_SHIFT)))
+#elif defined CC_ANIM_NEON
+#define Liquid_PackColors(r, g, b, a) vorrq_u32(\
+	vorrq_u32(vshlq_n_u32(vcvtq_u32_f32(r), BITMAPCOL_R_SHIFT), vshlq_n_u32(vcvtq_u32_f32(g), BITMAPCOL_G_SHIFT)),\
+	vorrq_u32(vshlq_n_u32(vcvtq_u32_f32(b), BITMAPCOL_B_SHIFT), vshlq_n_u32(vcvtq_u32_f32(a), BITMAPCOL_A_SHIFT)))
+#endif
+
+
 /*########################################################################################################################*
 *-----------------------------------------------------Lava animation------------------------------------------------------*
 *#########################################################################################################################*/
@@ -31,15 +85,51 @@ static float L_flameHeat[LIQUID_ANIM_MAX * LIQUID_ANIM_MAX];
 static RNGState L_rnd;
 static cc_bool  L_rndInited;
 
-static void LavaAnimation_Tick(void) {
-	BitmapCol pixels[LIQUID_ANIM_MAX * LIQUID_ANIM_MAX];
-	BitmapCol* ptr = pixels;
-	float soupHeat, potHeat, col;
-	int size, mask, shift;
+static void LavaAnimation_Output(const float* heat, BitmapCol* pixels, int count) {
+	float col;
+	int i = 0;
+#if defined CC_ANIM_SSE2
+	__m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f), two = _mm_set1_ps(2.0f);
+	__m128 r_mul = _mm_set1_ps(100.0f), r_add = _mm_set1_ps(155.0f);
+	__m128 g_mul = _mm_set1_ps(255.0f), b_mul = _mm_set1_ps(128.0f), a = _mm_set1_ps(255.0f);
+	for (; i + 4 <= count; i += 4) {
+		__m128 c  = _mm_min_ps(_mm_max_ps(_mm_mul_ps(two, _mm_loadu_ps(heat + i)), zero), one);
+		__m128 c2 = _mm_mul_ps(c, c);
+		__m128 r  = _mm_add_ps(_mm_mul_ps(c, r_mul), r_add);
+		__m128 g  = _mm_mul_ps(c2, g_mul);
+		__m128 b  = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(c2, c), c), b_mul);
+		_mm_storeu_si128((__m128i*)(pixels + i), Liquid_PackColors(r, g, b, a));
+	}
+#elif defined CC_ANIM_NEON
+	float32x4_t zero = vdupq_n_f32(0.0f), one = vdupq_n_f32(1.0f), two = vdupq_n_f32(2.0f);
+	float32x4_t r_mul = vdupq_n_f32(100.0f), r_add = vdupq_n_f32(155.0f);
+	float32x4_t g_mul = vdupq_n_f32(255.0f), b_mul = vdupq_n_f32(128.0f), a = vdupq_n_f32(255.0f);
+	for (; i + 4 <= count; i += 4) {
+		float32x4_t c  = vminq_f32(vmaxq_f32(vmulq_f32(two, vld1q_f32(heat + i)), zero), one);
+		float32x4_t c2 = vmulq_f32(c, c);
+		float32x4_t r  = vaddq_f32(vmulq_f32(c, r_mul), r_add);
+		float32x4_t g  = vmulq_f32(c2, g_mul);
+		float32x4_t b  = vmulq_f32(vmulq_f32(vmulq_f32(c2, c), c), b_mul);
+		vst1q_u32((cc_uint32*)(pixels + i), Liquid_PackColors(r, g, b, a));
+	}
+#endif
+	for (; i < count; i++) {
+		col = 2.0f * heat[i];
+		Math_Clamp(col, 0.0f, 1.0f);
+
+		pixels[i] = BitmapCol_Make(
+			col * 100.0f + 155.0f,
+			col * col * 255.0f,
+			col * col * col * col * 128.0f,
+			255);
+	}
+}
+
+static void LavaAnimation_Simulate(BitmapCol* pixels, int size) {
+	float soupHeat, potHeat;
+	int mask, shift;
 	int x, y, i = 0;
-	struct Bitmap bmp;
 
-	size  = min(Atlas2D.TileSize, LIQUID_ANIM_MAX);
 	mask  = size - 1;
 	shift = Math_Log2(size);
 
@@ -47,9 +137,9 @@ static void LavaAnimation_Tick(void) {
 		Random_SeedFromCurrentTime(&L_rnd);
 		L_rndInited = true;
 	}
-	
+
 	for (y = 0; y < size; y++) {
-		for (x = 0; x < size; x++) {
+		for (x = 0; x < size; x++, i++) {
 			/* Calculate the colour at this coordinate in the heatmap */
 
 			/* Lookup table for (int)(1.2 * sin([ANGLE] * 22.5 * MATH_DEG2RAD)); */
@@ -70,36 +160,32 @@ static void LavaAnimation_Tick(void) {
 				L_soupHeat[((yy + 1) & mask) << shift | (xx       & mask)] +
 				L_soupHeat[((yy + 1) & mask) << shift | ((xx + 1) & mask)];
 
-			potHeat =
-				L_potHeat[i] +                                          /* x    , y     */
-				L_potHeat[y << shift | ((x + 1) & mask)] +              /* x + 1, y     */
-				L_potHeat[((y + 1) & mask) << shift | x] +              /* x    , y + 1 */
-				L_potHeat[((y + 1) & mask) << shift | ((x + 1) & mask)];/* x + 1, y + 1 */
-
+			if (x < mask) {
+				potHeat =
+					L_potHeat[i] +                                          /* x    , y     */
+					L_potHeat[i + 1] +                                      /* x + 1, y     */
+					L_potHeat[((y + 1) & mask) << shift | x] +              /* x    , y + 1 */
+					L_potHeat[((y + 1) & mask) << shift | (x + 1)];         /* x + 1, y + 1 */
+			} else {
+				/* The pot at the start of this row is only heated once the whole row is done, */
+				/*  but it would have already been heated when simulating pixel by pixel */
+				float potWrapped = L_potHeat[y << shift] + L_flameHeat[y << shift];
+				if (potWrapped < 0.0f) potWrapped = 0.0f;
+				if (!mask) potWrapped = L_potHeat[i]; /* 1x1 texture, so same pot as this pixel */
+
+				potHeat =
+					L_potHeat[i] + potWrapped +
+					L_potHeat[((y + 1) & mask) << shift | x] +
+					L_potHeat[((y + 1) & mask) << shift];
+			}
 			L_soupHeat[i] = soupHeat * 0.1f + potHeat * 0.2f;
-
-			L_potHeat[i] += L_flameHeat[i];
-			if (L_potHeat[i] < 0.0f) L_potHeat[i] = 0.0f;
-
-			L_flameHeat[i] -= 0.06f * 0.01f;
-			if (Random_Float(&L_rnd) <= 0.005f) L_flameHeat[i] = 1.5f * 0.01f;
-
-			/* Output the pixel */
-			col = 2.0f * L_soupHeat[i];
-			Math_Clamp(col, 0.0f, 1.0f);
-
-			*ptr = BitmapCol_Make(
-				col * 100.0f + 155.0f,
-				col * col * 255.0f,
-				col * col * col * col * 128.0f,
-				255);
-
-			ptr++; i++;
 		}
-	}
 
-	Bitmap_Init(bmp, size, size, pixels);
-	Animations_Update(LAVA_TEX_LOC, &bmp, size);
+		/* The pots of this row are no longer needed by the rest of the rows (except for wrapping around) */
+		LiquidAnimation_Heat(&L_potHeat[y << shift], &L_flameHeat[y << shift], size,
+							0.06f * 0.01f, &L_rnd, 0.005f, 1.5f * 0.01f);
+	}
+	LavaAnimation_Output(L_soupHeat, pixels, size * size);
 }
 
 
@@ -112,15 +198,52 @@ static float W_flameHeat[LIQUID_ANIM_MAX * LIQUID_ANIM_MAX];
 static RNGState W_rnd;
 static cc_bool  W_rndInited;
 
-static void WaterAnimation_Tick(void) {
-	BitmapCol pixels[LIQUID_ANIM_MAX * LIQUID_ANIM_MAX];
-	BitmapCol* ptr = pixels;
-	float soupHeat, col;
-	int size, mask, shift;
+static void WaterAnimation_Output(const float* heat, BitmapCol* pixels, int count) {
+	float col;
+	int i = 0;
+#if defined CC_ANIM_SSE2
+	__m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+	__m128 r_add = _mm_set1_ps(32.0f),  r_mul = _mm_set1_ps(32.0f);
+	__m128 g_add = _mm_set1_ps(50.0f),  g_mul = _mm_set1_ps(64.0f);
+	__m128 a_add = _mm_set1_ps(146.0f), a_mul = _mm_set1_ps(50.0f), b = _mm_set1_ps(255.0f);
+	for (; i + 4 <= count; i += 4) {
+		__m128 c = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(heat + i), zero), one);
+		c = _mm_mul_ps(c, c);
+		_mm_storeu_si128((__m128i*)(pixels + i), Liquid_PackColors(
+			_mm_add_ps(r_add, _mm_mul_ps(c, r_mul)), _mm_add_ps(g_add, _mm_mul_ps(c, g_mul)),
+			b,                                      _mm_add_ps(a_add, _mm_mul_ps(c, a_mul))));
+	}
+#elif defined CC_ANIM_NEON
+	float32x4_t zero = vdupq_n_f32(0.0f), one = vdupq_n_f32(1.0f);
+	float32x4_t r_add = vdupq_n_f32(32.0f),  r_mul = vdupq_n_f32(32.0f);
+	float32x4_t g_add = vdupq_n_f32(50.0f),  g_mul = vdupq_n_f32(64.0f);
+	float32x4_t a_add = vdupq_n_f32(146.0f), a_mul = vdupq_n_f32(50.0f), b = vdupq_n_f32(255.0f);
+	for (; i + 4 <= count; i += 4) {
+		float32x4_t c = vminq_f32(vmaxq_f32(vld1q_f32(heat + i), zero), one);
+		c = vmulq_f32(c, c);
+		vst1q_u32((cc_uint32*)(pixels + i), Liquid_PackColors(
+			vaddq_f32(r_add, vmulq_f32(c, r_mul)), vaddq_f32(g_add, vmulq_f32(c, g_mul)),
+			b,                                     vaddq_f32(a_add, vmulq_f32(c, a_mul))));
+	}
+#endif
+	for (; i < count; i++) {
+		col = heat[i];
+		Math_Clamp(col, 0.0f, 1.0f);
+		col = col * col;
+
+		pixels[i] = BitmapCol_Make(
+			32.0f  + col * 32.0f,
+			50.0f  + col * 64.0f,
+			255,
+			146.0f + col * 50.0f);
+	}
+}
+
+static void WaterAnimation_Simulate(BitmapCol* pixels, int size) {
+	float soupHeat;
+	int mask, shift;
 	int x, y, i = 0;
-	struct Bitmap bmp;
 
-	size  = min(Atlas2D.TileSize, LIQUID_ANIM_MAX);
 	mask  = size - 1;
 	shift = Math_Log2(size);
 
@@ -128,9 +251,9 @@ static void WaterAnimation_Tick(void) {
 		Random_SeedFromCurrentTime(&W_rnd);
 		W_rndInited = true;
 	}
-	
+
 	for (y = 0; y < size; y++) {
-		for (x = 0; x < size; x++) {
+		for (x = 0; x < size; x++, i++) {
 			/* Calculate the colour at this coordinate in the heatmap */
 			soupHeat =
 				W_soupHeat[y << shift | ((x - 1) & mask)] +
@@ -138,30 +261,94 @@ static void WaterAnimation_Tick(void) {
 				W_soupHeat[y << shift | ((x + 1) & mask)];
 
 			W_soupHeat[i] = soupHeat / 3.3f + W_potHeat[i] * 0.8f;
+		}
 
-			W_potHeat[i] += W_flameHeat[i];
-			if (W_potHeat[i] < 0.0f) W_potHeat[i] = 0.0f;
+		LiquidAnimation_Heat(&W_potHeat[y << shift], &W_flameHeat[y << shift], size,
+							0.1f * 0.05f, &W_rnd, 0.05f, 0.5f * 0.05f);
+	}
+	WaterAnimation_Output(W_soupHeat, pixels, size * size);
+}
 
-			W_flameHeat[i] -= 0.1f * 0.05f;
-			if (Random_Float(&W_rnd) <= 0.05f) W_flameHeat[i] = 0.5f * 0.05f;
 
-			/* Output the pixel */
-			col = W_soupHeat[i];
-			Math_Clamp(col, 0.0f, 1.0f);
-			col = col * col;
+/*########################################################################################################################*
+*-----------------------------------------------------Liquid loops--------------------------------------------------------*
+*#########################################################################################################################*/
+/* Rather than simulating every tick, a looping sequence of frames can instead be simulated just once */
+/* The last few simulated frames are crossfaded into the first frames, so the loop is seamless */
+#define LIQUID_LOOP_FRAMES  100 /* 5 seconds at 20 ticks a second */
+#define LIQUID_LOOP_BLEND   20
+#define LIQUID_LOOP_WARMUP  100 /* Liquid starts out with no heat, so looks very different at first */
+
+typedef void (*LiquidAnim_Simulate)(BitmapCol* pixels, int size);
+struct LiquidLoop {
+	BitmapCol* frames;
+	int size, frame;
+	LiquidAnim_Simulate Simulate;
+};
+static struct LiquidLoop lavaLoop  = { NULL, 0, 0, LavaAnimation_Simulate  };
+static struct LiquidLoop waterLoop = { NULL, 0, 0, WaterAnimation_Simulate };
+static cc_bool liquidLoops;
+
+static BitmapCol LiquidLoop_Blend(BitmapCol a, BitmapCol b, int t) {
+	int s = LIQUID_LOOP_BLEND - t;
+	return BitmapCol_Make(
+		(BitmapCol_R(a) * s + BitmapCol_R(b) * t) / LIQUID_LOOP_BLEND,
+		(BitmapCol_G(a) * s + BitmapCol_G(b) * t) / LIQUID_LOOP_BLEND,
+		(BitmapCol_B(a) * s + BitmapCol_B(b) * t) / LIQUID_LOOP_BLEND,
+		(BitmapCol_A(a) * s + BitmapCol_A(b) * t) / LIQUID_LOOP_BLEND);
+}
 
-			*ptr = BitmapCol_Make(
-				32.0f  + col * 32.0f,
-				50.0f  + col * 64.0f,
-				255,
-				146.0f + col * 50.0f);
+static void LiquidLoop_Free(struct LiquidLoop* loop) {
+	Mem_Free(loop->frames);
+	loop->frames = NULL;
+	loop->size   = 0;
+}
 
-			ptr++; i++;
+static void LiquidLoop_Generate(struct LiquidLoop* loop, int size) {
+	BitmapCol pixels[LIQUID_ANIM_MAX * LIQUID_ANIM_MAX];
+	int count = size * size;
+	BitmapCol* frame;
+	int i, j;
+
+	LiquidLoop_Free(loop);
+	/* NOTE: size is set even if allocating fails, to avoid trying to generate again every tick */
+	loop->size   = size;
+	loop->frame  = 0;
+	loop->frames = (BitmapCol*)Mem_TryAlloc(LIQUID_LOOP_FRAMES * count, sizeof(BitmapCol));
+	if (!loop->frames) return;
+
+	for (i = 0; i < LIQUID_LOOP_WARMUP; i++) { loop->Simulate(pixels, size); }
+	for (i = 0; i < LIQUID_LOOP_FRAMES; i++) {
+		loop->Simulate(loop->frames + i * count, size);
+	}
+
+	/* Last frame is then followed by what would have been the next simulated frame */
+	for (i = 0; i < LIQUID_LOOP_BLEND; i++) {
+		loop->Simulate(pixels, size);
+		frame = loop->frames + i * count;
+
+		for (j = 0; j < count; j++) {
+			frame[j] = LiquidLoop_Blend(pixels[j], frame[j], i);
 		}
 	}
+}
 
-	Bitmap_Init(bmp, size, size, pixels);
-	Animations_Update(WATER_TEX_LOC, &bmp, size);
+static void LiquidAnimation_Tick(struct LiquidLoop* loop, int texLoc) {
+	BitmapCol pixels[LIQUID_ANIM_MAX * LIQUID_ANIM_MAX];
+	int size = Atlas2D.TileSize;
+	struct Bitmap bmp;
+	/* NOTE: Not min(), as C++ headers pulled in by <emmintrin.h> can undefine it */
+	if (size > LIQUID_ANIM_MAX) size = LIQUID_ANIM_MAX;
+
+	if (liquidLoops && loop->size != size) LiquidLoop_Generate(loop, size);
+	if (liquidLoops && loop->frames) {
+		Bitmap_Init(bmp, size, size, loop->frames + loop->frame * size * size);
+		loop->frame = (loop->frame + 1) % LIQUID_LOOP_FRAMES;
+	} else {
+		loop->Simulate(pixels, size);
+		Bitmap_Init(bmp, size, size, pixels);
+	}
+	Animations_Update(texLoc, &bmp, size);
 }
 #endif
 
@@ -329,8 +516,8 @@ static void Animations_Validate(void) {
 static void Animations_Tick(struct ScheduledTask* task) {
 	int i;
 #ifndef CC_BUILD_WEB
-	if (useLavaAnim)  LavaAnimation_Tick();
-	if (useWaterAnim) WaterAnimation_Tick();
+	if (useLavaAnim)  LiquidAnimation_Tick(&lavaLoop,  LAVA_TEX_LOC);
+	if (useWaterAnim) LiquidAnimation_Tick(&waterLoop, WATER_TEX_LOC);
 #endif
 
 	if (!anims_count) return;
@@ -381,11 +568,22 @@ static void OnFileChanged(void* obj, struct Stream* stream, const cc_string* nam
 
 static void OnInit(void) {
 	ScheduledTask_Add(GAME_DEF_TICKS, Animations_Tick);
+#ifndef CC_BUILD_WEB
+	liquidLoops = Options_GetBool(OPT_LIQUID_ANIM_LOOP, false);
+#endif
 	Event_Register_(&TextureEvents.PackChanged, NULL, OnPackChanged);
 	Event_Register_(&TextureEvents.FileChanged, NULL, OnFileChanged);
 }
 
+static void OnFree(void) {
+	Animations_Clear();
+#ifndef CC_BUILD_WEB
+	LiquidLoop_Free(&lavaLoop);
+	LiquidLoop_Free(&waterLoop);
+#endif
+}
+
 struct IGameComponent Animations_Component = {
-	OnInit,            /* Init  */
-	Animations_Clear  /* Free  */
+	OnInit, /* Init  */
+	OnFree  /* Free  */
 };
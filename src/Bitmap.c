@@ -6,6 +6,7 @@
 #include "Stream.h"
 #include "Errors.h"
 #include "Utils.h"
+#include "Funcs.h"
 
 void Bitmap_UNSAFE_CopyBlock(int srcX, int srcY, int dstX, int dstY, 
 							struct Bitmap* src, struct Bitmap* dst, int size) {
@@ -87,8 +88,202 @@ cc_bool Png_Detect(const cc_uint8* data, cc_uint32 len) {
 	return len >= PNG_SIG_SIZE && Mem_Equal(data, pngSig, PNG_SIG_SIZE);
 }
 
+/* Reconstructing filtered scanlines is a large portion of the time spent decoding large PNGs */
+/* Up can be done 16 bytes at a time. Sub/Average/Paeth depend on the previous pixel, so for */
+/*  3 and 4 bytes per pixel (i.e. RGB and RGBA) the bytes of each pixel are reconstructed together */
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#define CC_PNG_SSE2
+#include <emmintrin.h>
+#elif (defined __ARM_NEON || defined __ARM_NEON__) && !defined __ARM_BIG_ENDIAN
+#define CC_PNG_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined CC_PNG_SSE2 || defined CC_PNG_NEON
+#define CC_PNG_SIMD
+/* Reads a 3 or 4 byte pixel as a little endian integer */
+/* NOTE: Byte by byte, since pixels are not aligned and reading 4 bytes for a 3 byte pixel */
+/*  could read past the end of the scanline buffer */
+CC_INLINE static cc_uint32 Png_GetPixel(const cc_uint8* p, int bpp) {
+	cc_uint32 v = p[0] | (p[1] << 8) | (p[2] << 16);
+	if (bpp == 4) v |= (cc_uint32)p[3] << 24;
+	return v;
+}
+
+CC_INLINE static void Png_SetPixel(cc_uint8* p, cc_uint32 v, int bpp) {
+	p[0] = (cc_uint8)v; p[1] = (cc_uint8)(v >> 8); p[2] = (cc_uint8)(v >> 16);
+	if (bpp == 4) p[3] = (cc_uint8)(v >> 24);
+}
+#endif
+
+#ifdef CC_PNG_SSE2
+#define Png_LoadPixel(p, bpp)     _mm_cvtsi32_si128((int)Png_GetPixel(p, bpp))
+#define Png_StorePixel(p, x, bpp) Png_SetPixel(p, (cc_uint32)_mm_cvtsi128_si32(x), bpp)
+
+static void Png_Up_Simd(cc_uint8* line, const cc_uint8* prior, cc_uint32 lineLen) {
+	cc_uint32 i;
+	for (i = 0; i + 16 <= lineLen; i += 16) {
+		__m128i x = _mm_loadu_si128((const __m128i*)(line  + i));
+		__m128i b = _mm_loadu_si128((const __m128i*)(prior + i));
+		_mm_storeu_si128((__m128i*)(line + i), _mm_add_epi8(x, b));
+	}
+	for (; i < lineLen; i++) { line[i] += prior[i]; }
+}
+
+static void Png_Sub_Simd(cc_uint8* line, cc_uint32 lineLen, int bpp) {
+	__m128i a = _mm_setzero_si128(), x;
+	cc_uint32 i = 0;
+
+	/* With 4 pixels in a vector, Sub is just a prefix sum */
+	if (bpp == 4) {
+		for (; i + 16 <= lineLen; i += 16) {
+			x = _mm_loadu_si128((const __m128i*)(line + i));
+			x = _mm_add_epi8(x, _mm_slli_si128(x, 4));
+			x = _mm_add_epi8(x, _mm_slli_si128(x, 8));
+			x = _mm_add_epi8(x, a);
+			_mm_storeu_si128((__m128i*)(line + i), x);
+			a = _mm_shuffle_epi32(x, 0xFF);
+		}
+	}
+
+	for (; i < lineLen; i += bpp) {
+		x = _mm_add_epi8(Png_LoadPixel(line + i, bpp), a);
+		Png_StorePixel(line + i, x, bpp);
+		a = x;
+	}
+}
+
+static void Png_Average_Simd(cc_uint8* line, const cc_uint8* prior, cc_uint32 lineLen, int bpp) {
+	const __m128i one = _mm_set1_epi8(1);
+	__m128i a = _mm_setzero_si128(), b, x, avg;
+	cc_uint32 i;
+
+	for (i = 0; i < lineLen; i += bpp) {
+		b = Png_LoadPixel(prior + i, bpp);
+		x = Png_LoadPixel(line  + i, bpp);
+		/* pavgb rounds up, so subtract 1 when a + b is odd */
+		avg = _mm_avg_epu8(a, b);
+		avg = _mm_sub_epi8(avg, _mm_and_si128(_mm_xor_si128(a, b), one));
+
+		a = _mm_add_epi8(x, avg);
+		Png_StorePixel(line + i, a, bpp);
+	}
+}
+
+#define Png_Abs16(x) _mm_max_epi16(x, _mm_sub_epi16(zero, x))
+#define Png_Select(mask, x, y) _mm_or_si128(_mm_and_si128(mask, x), _mm_andnot_si128(mask, y))
+
+static void Png_Paeth_Simd(cc_uint8* line, const cc_uint8* prior, cc_uint32 lineLen, int bpp) {
+	const __m128i zero = _mm_setzero_si128();
+	__m128i a = zero, c = zero, b, x, pa, pb, pc, smallest, nearest;
+	cc_uint32 i;
+
+	/* Paeth is computed using 16 bit lanes, as p = a + b - c can be outside 0-255 */
+	for (i = 0; i < lineLen; i += bpp) {
+		b = _mm_unpacklo_epi8(Png_LoadPixel(prior + i, bpp), zero);
+		x = Png_LoadPixel(line + i, bpp);
+
+		/* p - a = b - c, p - b = a - c, p - c = (a - c) + (b - c) */
+		pa = _mm_sub_epi16(b, c);
+		pb = _mm_sub_epi16(a, c);
+		pc = _mm_add_epi16(pa, pb);
+
+		pa = Png_Abs16(pa); pb = Png_Abs16(pb); pc = Png_Abs16(pc);
+		smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+
+		/* Ties are broken in the order a, b, c */
+		nearest = Png_Select(_mm_cmpeq_epi16(smallest, pb), b, c);
+		nearest = Png_Select(_mm_cmpeq_epi16(smallest, pa), a, nearest);
+
+		x = _mm_add_epi8(x, _mm_packus_epi16(nearest, zero));
+		Png_StorePixel(line + i, x, bpp);
+
+		a = _mm_unpacklo_epi8(x, zero);
+		c = b;
+	}
+}
+#endif
+
+#ifdef CC_PNG_NEON
+#define Png_LoadPixel(p, bpp)     vreinterpret_u8_u32(vdup_n_u32(Png_GetPixel(p, bpp)))
+#define Png_StorePixel(p, x, bpp) Png_SetPixel(p, vget_lane_u32(vreinterpret_u32_u8(x), 0), bpp)
+
+static void Png_Up_Simd(cc_uint8* line, const cc_uint8* prior, cc_uint32 lineLen) {
+	cc_uint32 i;
+	for (i = 0; i + 16 <= lineLen; i += 16) {
+		vst1q_u8(line + i, vaddq_u8(vld1q_u8(line + i), vld1q_u8(prior + i)));
+	}
+	for (; i < lineLen; i++) { line[i] += prior[i]; }
+}
+
+static void Png_Sub_Simd(cc_uint8* line, cc_uint32 lineLen, int bpp) {
+	uint8x8_t a = vdup_n_u8(0), x;
+	cc_uint32 i;
+
+	for (i = 0; i < lineLen; i += bpp) {
+		x = vadd_u8(Png_LoadPixel(line + i, bpp), a);
+		Png_StorePixel(line + i, x, bpp);
+		a = x;
+	}
+}
+
+static void Png_Average_Simd(cc_uint8* line, const cc_uint8* prior, cc_uint32 lineLen, int bpp) {
+	uint8x8_t a = vdup_n_u8(0), b, x;
+	cc_uint32 i;
+
+	for (i = 0; i < lineLen; i += bpp) {
+		b = Png_LoadPixel(prior + i, bpp);
+		x = Png_LoadPixel(line  + i, bpp);
+		/* vhadd computes (a + b) >> 1 without overflowing */
+		a = vadd_u8(x, vhadd_u8(a, b));
+		Png_StorePixel(line + i, a, bpp);
+	}
+}
+
+static void Png_Paeth_Simd(cc_uint8* line, const cc_uint8* prior, cc_uint32 lineLen, int bpp) {
+	uint8x8_t a = vdup_n_u8(0), c = a, b, x, useA, useB;
+	uint16x8_t pa, pb, pc;
+	cc_uint32 i;
+
+	for (i = 0; i < lineLen; i += bpp) {
+		b = Png_LoadPixel(prior + i, bpp);
+		x = Png_LoadPixel(line  + i, bpp);
+
+		/* |p - a| = |b - c|, |p - b| = |a - c|, |p - c| = |a + b - 2c| */
+		pa = vabdl_u8(b, c);
+		pb = vabdl_u8(a, c);
+		pc = vabdq_u16(vaddl_u8(a, b), vaddl_u8(c, c));
+
+		/* Ties are broken in the order a, b, c */
+		useA = vmovn_u16(vandq_u16(vcleq_u16(pa, pb), vcleq_u16(pa, pc)));
+		useB = vmovn_u16(vcleq_u16(pb, pc));
+
+		a = vadd_u8(x, vbsl_u8(useA, a, vbsl_u8(useB, b, c)));
+		Png_StorePixel(line + i, a, bpp);
+		c = b;
+	}
+}
+#endif
+
 static void Png_Reconstruct(cc_uint8 type, cc_uint8 bytesPerPixel, cc_uint8* line, cc_uint8* prior, cc_uint32 lineLen) {
 	cc_uint32 i, j;
+#ifdef CC_PNG_SIMD
+	if (type == PNG_FILTER_UP) {
+		Png_Up_Simd(line, prior, lineLen); return;
+	}
+
+	if (bytesPerPixel == 3 || bytesPerPixel == 4) {
+		switch (type) {
+		case PNG_FILTER_SUB:
+			Png_Sub_Simd(line, lineLen, bytesPerPixel); return;
+		case PNG_FILTER_AVERAGE:
+			Png_Average_Simd(line, prior, lineLen, bytesPerPixel); return;
+		case PNG_FILTER_PAETH:
+			Png_Paeth_Simd(line, prior, lineLen, bytesPerPixel); return;
+		}
+	}
+#endif
+
 	switch (type) {
 	case PNG_FILTER_NONE:
 		return;
@@ -269,7 +464,204 @@ static void Png_Expand_RGB_A_16(int width, BitmapCol* palette, cc_uint8* src, Bi
 	}
 }
 
+/* Byte index of red/blue within a BitmapCol in memory (green is always 1, alpha always 3) */
+#define PNG_R_INDEX (BITMAPCOL_R_SHIFT / 8)
+#define PNG_B_INDEX (BITMAPCOL_B_SHIFT / 8)
+
+#ifdef CC_PNG_SSE2
+static void Png_Expand_GRAYSCALE_8_Simd(int width, BitmapCol* palette, cc_uint8* src, BitmapCol* dst) {
+	const __m128i alpha = _mm_set1_epi8((char)0xFF);
+	__m128i g, gg, ga;
+	int i;
+
+	for (i = 0; i + 16 <= width; i += 16) {
+		g  = _mm_loadu_si128((const __m128i*)(src + i));
+		gg = _mm_unpacklo_epi8(g, g);
+		ga = _mm_unpacklo_epi8(g, alpha);
+		_mm_storeu_si128((__m128i*)(dst + i     ), _mm_unpacklo_epi16(gg, ga));
+		_mm_storeu_si128((__m128i*)(dst + i +  4), _mm_unpackhi_epi16(gg, ga));
+
+		gg = _mm_unpackhi_epi8(g, g);
+		ga = _mm_unpackhi_epi8(g, alpha);
+		_mm_storeu_si128((__m128i*)(dst + i +  8), _mm_unpacklo_epi16(gg, ga));
+		_mm_storeu_si128((__m128i*)(dst + i + 12), _mm_unpackhi_epi16(gg, ga));
+	}
+	Png_Expand_GRAYSCALE_8(width - i, palette, src + i, dst + i);
+}
+
+static void Png_Expand_GRAYSCALE_A_8_Simd(int width, BitmapCol* palette, cc_uint8* src, BitmapCol* dst) {
+	const __m128i grayMask = _mm_set1_epi16(0x00FF);
+	__m128i ga, gg;
+	int i;
+
+	for (i = 0; i + 8 <= width; i += 8) {
+		ga = _mm_loadu_si128((const __m128i*)(src + i * 2));
+		gg = _mm_and_si128(ga, grayMask);
+		gg = _mm_or_si128(gg, _mm_slli_epi16(gg, 8));
+
+		_mm_storeu_si128((__m128i*)(dst + i    ), _mm_unpacklo_epi16(gg, ga));
+		_mm_storeu_si128((__m128i*)(dst + i + 4), _mm_unpackhi_epi16(gg, ga));
+	}
+	Png_Expand_GRAYSCALE_A_8(width - i, palette, src + i * 2, dst + i);
+}
+
+static void Png_Expand_RGB_A_8_Simd(int width, BitmapCol* palette, cc_uint8* src, BitmapCol* dst) {
+	__m128i x;
+	int i;
+#if PNG_R_INDEX != 0
+	const __m128i rbMask = _mm_set1_epi32(0x00FF00FF);
+	__m128i rb;
+#endif
+
+	for (i = 0; i + 4 <= width; i += 4) {
+		x = _mm_loadu_si128((const __m128i*)(src + i * 4));
+#if PNG_R_INDEX != 0
+		/* Swap red and blue by swapping the 16 bit halves of each pixel */
+		rb = _mm_and_si128(x, rbMask);
+		rb = _mm_shufflehi_epi16(_mm_shufflelo_epi16(rb, 0xB1), 0xB1);
+		x  = _mm_or_si128(_mm_andnot_si128(rbMask, x), rb);
+#endif
+		_mm_storeu_si128((__m128i*)(dst + i), x);
+	}
+	Png_Expand_RGB_A_8(width - i, palette, src + i * 4, dst + i);
+}
+#endif
+
+/* RGB needs a byte shuffle (pshufb) to expand efficiently, which SSE2 lacks */
+#if defined CC_PNG_SSE2 && ((defined __GNUC__ && (__GNUC__ >= 5 || defined __clang__)) || (defined _MSC_VER && _MSC_VER >= 1600))
+#define CC_PNG_SSSE3
+#include <tmmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define SSSE3_TARGET
+#else
+#include <cpuid.h>
+#define SSSE3_TARGET __attribute__((target("ssse3")))
+#endif
+
+SSSE3_TARGET static void Png_Expand_RGB_8_SSSE3(int width, BitmapCol* palette, cc_uint8* src, BitmapCol* dst) {
+#if PNG_R_INDEX == 0
+	const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+#else
+	const __m128i shuffle = _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+#endif
+	const __m128i alpha = _mm_set1_epi32((int)BITMAPCOL_A_MASK);
+	__m128i x;
+	int i;
+
+	/* Each iteration reads 16 bytes but only uses 12, so stop 2 pixels early */
+	for (i = 0; i + 6 <= width; i += 4) {
+		x = _mm_loadu_si128((const __m128i*)(src + i * 3));
+		x = _mm_or_si128(_mm_shuffle_epi8(x, shuffle), alpha);
+		_mm_storeu_si128((__m128i*)(dst + i), x);
+	}
+	Png_Expand_RGB_8(width - i, palette, src + i * 3, dst + i);
+}
+
+/* 0 = not checked yet, 1 = unsupported, 2 = supported */
+static volatile int png_ssse3State;
+
+static cc_bool Png_HasSSSE3(void) {
+	cc_uint32 ecx;
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 1);
+	ecx = info[2];
+#else
+	cc_uint32 eax, ebx, edx;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return false;
+#endif
+	/* SSSE3 is ECX bit 9 */
+	return (ecx & (1 << 9)) != 0;
+}
+#endif
+
+#ifdef CC_PNG_NEON
+static void Png_Expand_GRAYSCALE_8_Simd(int width, BitmapCol* palette, cc_uint8* src, BitmapCol* dst) {
+	uint8x16x4_t out;
+	int i;
+	out.val[3] = vdupq_n_u8(255);
+
+	for (i = 0; i + 16 <= width; i += 16) {
+		out.val[0] = out.val[1] = out.val[2] = vld1q_u8(src + i);
+		vst4q_u8((cc_uint8*)(dst + i), out);
+	}
+	Png_Expand_GRAYSCALE_8(width - i, palette, src + i, dst + i);
+}
+
+static void Png_Expand_GRAYSCALE_A_8_Simd(int width, BitmapCol* palette, cc_uint8* src, BitmapCol* dst) {
+	uint8x16x2_t ga;
+	uint8x16x4_t out;
+	int i;
+
+	for (i = 0; i + 16 <= width; i += 16) {
+		ga = vld2q_u8(src + i * 2);
+		out.val[0] = out.val[1] = out.val[2] = ga.val[0];
+		out.val[3] = ga.val[1];
+		vst4q_u8((cc_uint8*)(dst + i), out);
+	}
+	Png_Expand_GRAYSCALE_A_8(width - i, palette, src + i * 2, dst + i);
+}
+
+static void Png_Expand_RGB_8_Simd(int width, BitmapCol* palette, cc_uint8* src, BitmapCol* dst) {
+	uint8x16x3_t rgb;
+	uint8x16x4_t out;
+	int i;
+	out.val[3] = vdupq_n_u8(255);
+
+	for (i = 0; i + 16 <= width; i += 16) {
+		rgb = vld3q_u8(src + i * 3);
+		out.val[PNG_R_INDEX] = rgb.val[0];
+		out.val[1]           = rgb.val[1];
+		out.val[PNG_B_INDEX] = rgb.val[2];
+		vst4q_u8((cc_uint8*)(dst + i), out);
+	}
+	Png_Expand_RGB_8(width - i, palette, src + i * 3, dst + i);
+}
+
+static void Png_Expand_RGB_A_8_Simd(int width, BitmapCol* palette, cc_uint8* src, BitmapCol* dst) {
+	uint8x16x4_t rgba, out;
+	int i;
+
+	for (i = 0; i + 16 <= width; i += 16) {
+		rgba = vld4q_u8(src + i * 4);
+		out.val[PNG_R_INDEX] = rgba.val[0];
+		out.val[1]           = rgba.val[1];
+		out.val[PNG_B_INDEX] = rgba.val[2];
+		out.val[3]           = rgba.val[3];
+		vst4q_u8((cc_uint8*)(dst + i), out);
+	}
+	Png_Expand_RGB_A_8(width - i, palette, src + i * 4, dst + i);
+}
+#endif
+
+/* Returns a vectorised row expander for the given format, or NULL if there isn't one */
+static Png_RowExpander Png_GetSimdExpander(cc_uint8 col, cc_uint8 bitsPerSample) {
+	if (bitsPerSample != 8) return NULL;
+	/* NOTE: Indexed images are left to the scalar expander, as a palette lookup is */
+	/*  essentially a gather, which SSE2/SSSE3/NEON have no instructions for */
+	switch (col) {
+#ifdef CC_PNG_SIMD
+	case PNG_COLOR_GRAYSCALE:   return Png_Expand_GRAYSCALE_8_Simd;
+	case PNG_COLOR_GRAYSCALE_A: return Png_Expand_GRAYSCALE_A_8_Simd;
+	case PNG_COLOR_RGB_A:       return Png_Expand_RGB_A_8_Simd;
+#endif
+#if defined CC_PNG_NEON
+	case PNG_COLOR_RGB:         return Png_Expand_RGB_8_Simd;
+#elif defined CC_PNG_SSSE3
+	case PNG_COLOR_RGB:
+		/* Checking CPUID for every image would be slow (it can even trap to the hypervisor) */
+		if (!png_ssse3State) png_ssse3State = Png_HasSSSE3() ? 2 : 1;
+		return png_ssse3State == 2 ? Png_Expand_RGB_8_SSSE3 : NULL;
+#endif
+	}
+	return NULL;
+}
+
 static Png_RowExpander Png_GetExpander(cc_uint8 col, cc_uint8 bitsPerSample) {
+	Png_RowExpander simd = Png_GetSimdExpander(col, bitsPerSample);
+	if (simd) return simd;
+
 	switch (col) {
 	case PNG_COLOR_GRAYSCALE:
 		switch (bitsPerSample) {
@@ -333,6 +725,44 @@ static void ComputeTransparency(struct Bitmap* bmp, BitmapCol col) {
 #define PNG_BUFFER_SIZE ((PNG_MAX_DIMS * 2 * 4 + 1) * 2)
 
 /* TODO: Test a lot of .png files and ensure output is right */
+static cc_result DecodedPng_Read(struct Stream* s, cc_uint8* data, cc_uint32 count, cc_uint32* modified) {
+	struct Stream* source = ((struct DecodedPng*)s->Meta.Inflate)->source;
+	return source->Read(source, data, count, modified);
+}
+static cc_result DecodedPng_ReadU8(struct Stream* s, cc_uint8* data) {
+	struct Stream* source = ((struct DecodedPng*)s->Meta.Inflate)->source;
+	return source->ReadU8(source, data);
+}
+static cc_result DecodedPng_Skip(struct Stream* s, cc_uint32 count) {
+	struct Stream* source = ((struct DecodedPng*)s->Meta.Inflate)->source;
+	return source->Skip(source, count);
+}
+static cc_result DecodedPng_Seek(struct Stream* s, cc_uint32 position) {
+	struct Stream* source = ((struct DecodedPng*)s->Meta.Inflate)->source;
+	return source->Seek(source, position);
+}
+static cc_result DecodedPng_Position(struct Stream* s, cc_uint32* position) {
+	struct Stream* source = ((struct DecodedPng*)s->Meta.Inflate)->source;
+	return source->Position(source, position);
+}
+static cc_result DecodedPng_Length(struct Stream* s, cc_uint32* length) {
+	struct Stream* source = ((struct DecodedPng*)s->Meta.Inflate)->source;
+	return source->Length(source, length);
+}
+
+void Png_MakeDecodedStream(struct Stream* stream, struct DecodedPng* png, struct Stream* source) {
+	Stream_Init(stream);
+	png->source = source;
+	stream->Meta.Inflate = png;
+
+	stream->Read     = DecodedPng_Read;
+	stream->ReadU8   = DecodedPng_ReadU8;
+	stream->Skip     = DecodedPng_Skip;
+	stream->Seek     = DecodedPng_Seek;
+	stream->Position = DecodedPng_Position;
+	stream->Length   = DecodedPng_Length;
+}
+
 cc_result Png_Decode(struct Bitmap* bmp, struct Stream* stream) {
 	cc_uint8 tmp[PNG_PALETTE * 3];
 	cc_uint32 dataSize, fourCC;
@@ -363,6 +793,14 @@ cc_result Png_Decode(struct Bitmap* bmp, struct Stream* stream) {
 	bmp->width = 0; bmp->height = 0;
 	bmp->scan0 = NULL;
 
+	/* Bitmap might have already been decoded (e.g. on a background thread) */
+	if (stream->Read == DecodedPng_Read && ((struct DecodedPng*)stream->Meta.Inflate)->bmp.scan0) {
+		struct DecodedPng* png = (struct DecodedPng*)stream->Meta.Inflate;
+		*bmp = png->bmp;
+		png->bmp.scan0 = NULL;
+		return 0;
+	}
+
 	res = Stream_Read(stream, tmp, PNG_SIG_SIZE);
 	if (res) return res;
 	if (!Png_Detect(tmp, PNG_SIG_SIZE)) return PNG_ERR_INVALID_SIG;
@@ -533,6 +971,10 @@ static void Png_Filter(cc_uint8 filter, const cc_uint8* cur, const cc_uint8* pri
 	int i, p, pa, pb, pc;
 
 	switch (filter) {
+	case PNG_FILTER_NONE:
+		Mem_Copy(best, cur, lineLen);
+		break;
+
 	case PNG_FILTER_SUB:
 		for (i = 0; i < bpp; i++) { best[i] = cur[i]; }
 
@@ -625,24 +1067,115 @@ static void Png_EncodeRow(const cc_uint8* cur, const cc_uint8* prior, cc_uint8*
 	best[0] = bestFilter;
 }
 
+/* Filter is chosen separately for each row, based on which filter seems to compress best */
+#define PNG_FILTER_ADAPTIVE 5
+
+/* Filters and compresses the rows of the bitmap into the IDAT chunk */
+static cc_result Png_EncodeRows(struct Bitmap* bmp, struct Stream* chunk, Png_RowGetter getRow, 
+								cc_bool alpha, int filter, cc_uint8 level) {
+	cc_uint8* prevLine;
+	cc_uint8* curLine;
+	cc_uint8* bestLine;
+	struct ZLibState* zlState;
+	struct Stream zlStream;
+	int y, lineSize;
+	cc_result res = 0;
+
+	/* NOTE: These are too large to put on the stack, as screenshots are encoded on a background thread */
+	lineSize = bmp->width * (alpha ? 4 : 3);
+	zlState  = (struct ZLibState*)Mem_TryAlloc(1, sizeof(struct ZLibState) + lineSize * 3 + 1);
+	if (!zlState) return ERR_OUT_OF_MEMORY;
+
+	prevLine = (cc_uint8*)(zlState + 1);
+	curLine  = prevLine + lineSize;
+	bestLine = curLine  + lineSize;
+
+	ZLib_MakeStream(&zlStream, zlState, chunk);
+	zlState->Base.Level = level;
+	Mem_Set(prevLine, 0, lineSize);
+
+	for (y = 0; y < bmp->height; y++) {
+		BitmapCol* src = getRow(bmp, y);
+		cc_uint8* prev = (y & 1) == 0 ? prevLine : curLine;
+		cc_uint8* cur  = (y & 1) == 0 ? curLine  : prevLine;
+
+		Png_MakeRow(src, cur, lineSize, alpha);
+		if (filter == PNG_FILTER_ADAPTIVE) {
+			Png_EncodeRow(cur, prev, bestLine, lineSize, alpha);
+		} else {
+			bestLine[0] = filter;
+			Png_Filter(filter, cur, prev, bestLine + 1, lineSize, alpha ? 4 : 3);
+		}
+
+		/* +1 for filter byte */
+		if ((res = Stream_Write(&zlStream, bestLine, lineSize + 1))) break;
+	}
+
+	if (!res) res = zlStream.Close(&zlStream);
+	Mem_Free(zlState);
+	return res;
+}
+
+static cc_result CountingStream_Write(struct Stream* s, const cc_uint8* data, cc_uint32 count, cc_uint32* modified) {
+	s->Meta.Mem.Length += count;
+	*modified = count;
+	return 0;
+}
+
+/* Tries compressing the image with each of the given filter strategies, returning the smallest one */
+static cc_result Png_FindBestFilter(struct Bitmap* bmp, Png_RowGetter getRow, cc_bool alpha, int* bestFilter) {
+	static const int filters[] = { 
+		PNG_FILTER_ADAPTIVE, PNG_FILTER_NONE, PNG_FILTER_SUB, PNG_FILTER_UP, PNG_FILTER_PAETH 
+	};
+	cc_uint32 bestSize = Int32_MaxValue;
+	struct Stream counter;
+	cc_result res;
+	int i;
+
+	Stream_Init(&counter);
+	counter.Write = CountingStream_Write;
+	*bestFilter   = PNG_FILTER_ADAPTIVE;
+
+	/* Texture packs often have large areas of flat colour or of repeated tiles */
+	/*  which a single filter for the whole image can compress much better than adaptive */
+	for (i = 0; i < Array_Elems(filters); i++) {
+		counter.Meta.Mem.Length = 0;
+		res = Png_EncodeRows(bmp, &counter, getRow, alpha, filters[i], DEFLATE_LEVEL_MAX);
+		if (res) return res;
+
+		if (counter.Meta.Mem.Length >= bestSize) continue;
+		bestSize    = counter.Meta.Mem.Length;
+		*bestFilter = filters[i];
+	}
+	return 0;
+}
+
 static BitmapCol* DefaultGetRow(struct Bitmap* bmp, int y) { return Bitmap_GetRow(bmp, y); }
 cc_result Png_Encode(struct Bitmap* bmp, struct Stream* stream, 
-					Png_RowGetter getRow, cc_bool alpha) {
+					Png_RowGetter getRow, cc_bool alpha, cc_uint8 mode) {
 	cc_uint8 tmp[32];
-	/* TODO: This should be * 4 for alpha (should switch to mem_alloc though) */
-	cc_uint8 prevLine[PNG_MAX_DIMS * 3], curLine[PNG_MAX_DIMS * 3];
-	cc_uint8 bestLine[PNG_MAX_DIMS * 3 + 1];
-
-	struct ZLibState zlState;
-	struct Stream chunk, zlStream;
+	struct Stream chunk;
 	cc_uint32 stream_end, stream_beg;
-	int y, lineSize;
+	cc_uint8 level;
+	int filter;
 	cc_result res;
 
 	/* stream may not start at 0 (e.g. when making default.zip) */
 	if ((res = stream->Position(stream, &stream_beg))) return res;
 
 	if (!getRow) getRow = DefaultGetRow;
+
+	switch (mode) {
+	case PNG_ENCODE_FAST:
+		/* Sub is cheap to compute, and compresses about as well as the other fixed filters for screenshots */
+		filter = PNG_FILTER_SUB;      level = DEFLATE_LEVEL_LIGHT; break;
+	case PNG_ENCODE_SMALLEST:
+		if ((res = Png_FindBestFilter(bmp, getRow, alpha, &filter))) return res;
+		level  = DEFLATE_LEVEL_MAX;   break;
+	default:
+		filter = PNG_FILTER_ADAPTIVE; level = DEFLATE_LEVEL_DEFAULT; break;
+	}
+
 	if ((res = Stream_Write(stream, pngSig, PNG_SIG_SIZE))) return res;
 	Stream_WriteonlyCrc32(&chunk, stream);
 
@@ -666,22 +1199,7 @@ cc_result Png_Encode(struct Bitmap* bmp, struct Stream* stream,
 	Stream_SetU32_BE(&tmp[0], PNG_FourCC('I','D','A','T'));
 	if ((res = Stream_Write(&chunk, tmp, 4))) return res;
 
-	ZLib_MakeStream(&zlStream, &zlState, &chunk); 
-	lineSize = bmp->width * (alpha ? 4 : 3);
-	Mem_Set(prevLine, 0, lineSize);
-
-	for (y = 0; y < bmp->height; y++) {
-		BitmapCol* src = getRow(bmp, y);
-		cc_uint8* prev = (y & 1) == 0 ? prevLine : curLine;
-		cc_uint8* cur  = (y & 1) == 0 ? curLine  : prevLine;
-
-		Png_MakeRow(src, cur, lineSize, alpha);
-		Png_EncodeRow(cur, prev, bestLine, lineSize, alpha);
-
-		/* +1 for filter byte */
-		if ((res = Stream_Write(&zlStream, bestLine, lineSize + 1))) return res;
-	}
-	if ((res = zlStream.Close(&zlStream))) return res;
+	if ((res = Png_EncodeRows(bmp, &chunk, getRow, alpha, filter, level))) return res;
 	Stream_SetU32_BE(&tmp[0], chunk.Meta.CRC32.CRC32 ^ 0xFFFFFFFFUL);
 
 	/* Write end chunk */
@@ -86,9 +86,24 @@ typedef BitmapCol* (*Png_RowGetter)(struct Bitmap* bmp, int row);
      https://github.com/nothings/stb/blob/master/stb_image.h
 */
 CC_API cc_result Png_Decode(struct Bitmap* bmp, struct Stream* stream);
+
+/* Bitmap that has already been decoded from PNG data. (e.g. on a background thread) */
+struct DecodedPng { struct Bitmap bmp; struct Stream* source; };
+/* Wraps the stream the PNG data was decoded from, but where calling Png_Decode on the */
+/*  wrapper stream just returns the already decoded bitmap instead of decoding the data again. */
+/* NOTE: Png_Decode takes ownership of the decoded bitmap (setting png->bmp.scan0 to NULL), */
+/*  so only the first Png_Decode call returns it - later calls decode the data as normal. */
+void Png_MakeDecodedStream(struct Stream* stream, struct DecodedPng* png, struct Stream* source);
+/* Trade off between how fast a PNG is encoded and how small the encoded PNG is */
+enum PNG_ENCODE_ {
+	PNG_ENCODE_FAST,    /* Single fixed filter, fast compression (e.g. for screenshots) */
+	PNG_ENCODE_DEFAULT, /* Filter chosen per row, default compression */
+	PNG_ENCODE_SMALLEST /* Tries several filter strategies, max compression (e.g. for default.zip) */
+};
 /* Encodes a bitmap in PNG format. */
 /* getRow is optional. Can be used to modify how rows are encoded. (e.g. flip image) */
 /* if alpha is non-zero, RGBA channels are saved, otherwise only RGB channels are. */
+/* mode is how to trade off encoding speed vs size. (see PNG_ENCODE_ enum) */
 cc_result Png_Encode(struct Bitmap* bmp, struct Stream* stream, 
-						Png_RowGetter getRow, cc_bool alpha);
+						Png_RowGetter getRow, cc_bool alpha, cc_uint8 mode);
 #endif
@@ -7,6 +7,7 @@
 #include "Inventory.h"
 #include "Event.h"
 #include "Picking.h"
+#include "Platform.h"
 
 struct _BlockLists Blocks;
 
@@ -165,7 +166,7 @@ void Block_DefineCustom(BlockID block) {
 
 	Inventory_AddDefault(block);
 	Block_SetCustomDefined(block, true);
-	Event_RaiseVoid(&BlockEvents.BlockDefChanged);
+	Block_RaiseDefChanged();
 }
 
 static void Block_RecalcIsLiquid(BlockID b) {
@@ -459,17 +460,14 @@ static cc_bool Block_MightCull(BlockID block, BlockID other) {
 	return (bType == COLLIDE_SOLID && oType == COLLIDE_SOLID) || bType != COLLIDE_SOLID;
 }
 
-static void Block_CalcCulling(BlockID block, BlockID other) {
+static cc_uint8 Block_CalcCulling(BlockID block, BlockID other) {
 	Vec3 bMin, bMax, oMin, oMax;
 	cc_bool occludedX, occludedY, occludedZ, bothLiquid;
 	int f;
 
 	/* Some blocks may not cull 'other' block, in which case just skip per-face check */
 	/* e.g. sprite blocks, default leaves, will not cull any other blocks */
-	if (!Block_MightCull(block, other)) {	
-		Blocks.Hidden[(block * BLOCK_COUNT) + other] = 0;
-		return;
-	}
+	if (!Block_MightCull(block, other)) return 0;
 
 	bMin = Blocks.MinBB[block]; bMax = Blocks.MaxBB[block];
 	oMin = Blocks.MinBB[other]; oMax = Blocks.MaxBB[other];
@@ -493,31 +491,106 @@ static void Block_CalcCulling(BlockID block, BlockID other) {
 	f |= occludedZ && oMin.Z == 0.0f && bMax.Z == 1.0f ? (1 << FACE_ZMAX) : 0;
 	f |= occludedY && (bothLiquid || (oMax.Y == 1.0f && bMin.Y == 0.0f)) ? (1 << FACE_YMIN) : 0;
 	f |= occludedY && (bothLiquid || (oMin.Y == 0.0f && bMax.Y == 1.0f)) ? (1 << FACE_YMAX) : 0;
-	Blocks.Hidden[(block * BLOCK_COUNT) + other] = f;
+	return f;
+}
+
+/* Culling only depends on a few properties of the two blocks, so blocks with identical */
+/*  properties are grouped into one 'culling class', and Blocks.Hidden stores the hidden faces */
+/*  for each pair of classes. Most worlds only use a few dozen classes out of BLOCK_COUNT blocks. */
+static cc_bool cullingDirty = true;
+static BlockID cullClassBlocks[BLOCK_COUNT];
+static int hiddenCapacity;
+
+/* Whether this block culls itself differently to how it culls other blocks with the same properties */
+static cc_bool Block_NeedsOwnCullClass(BlockID b) {
+	/* e.g. glass hides faces between two glass blocks, but not between glass and another transparent block */
+	if (Blocks.Draw[b] == DRAW_TRANSPARENT || Blocks.Draw[b] == DRAW_GAS) return true;
+	/* Water is always culled by lava */
+	if (b >= BLOCK_WATER && b <= BLOCK_STILL_LAVA) return true;
+	return Blocks.IsLiquid[b] && Blocks.Draw[b] != DRAW_TRANSLUCENT;
+}
+
+static cc_bool Block_SameCullClass(BlockID a, BlockID b) {
+	return Blocks.Draw[a] == Blocks.Draw[b] && Blocks.IsLiquid[a] == Blocks.IsLiquid[b]
+		&& Blocks.Collide[a] == Blocks.Collide[b]
+		&& Vec3_Equals(&Blocks.MinBB[a], &Blocks.MinBB[b]) && Vec3_Equals(&Blocks.MaxBB[a], &Blocks.MaxBB[b]);
+}
+
+static void Block_AssignCullClasses(void) {
+	int block, i, count = 0;
+	for (block = BLOCK_AIR; block < BLOCK_COUNT; block++) {
+		i = count;
+
+		if (!Block_NeedsOwnCullClass((BlockID)block)) {
+			for (i = 0; i < count; i++) {
+				if (Block_NeedsOwnCullClass(cullClassBlocks[i])) continue;
+				if (Block_SameCullClass(cullClassBlocks[i], (BlockID)block)) break;
+			}
+		}
+
+		if (i == count) cullClassBlocks[count++] = (BlockID)block;
+		Blocks.CullClass[block] = (cc_uint16)i;
+	}
+	Blocks.CullStride = count;
+}
+
+void Block_CalcHiddenFaces(void) {
+	int count, i, j;
+	cc_uint8* row;
+	if (!cullingDirty) return;
+	
+	Block_AssignCullClasses();
+	count = Blocks.CullStride;
+
+	if (count * count > hiddenCapacity) {
+		Mem_Free(Blocks.Hidden);
+		hiddenCapacity = count * count;
+		Blocks.Hidden  = (cc_uint8*)Mem_Alloc(hiddenCapacity, 1, "hidden faces");
+	}
+
+	for (i = 0; i < count; i++) {
+		row = &Blocks.Hidden[i * count];
+		for (j = 0; j < count; j++) {
+			row[j] = Block_CalcCulling(cullClassBlocks[i], cullClassBlocks[j]);
+		}
+	}
+	cullingDirty = false;
 }
 
 cc_bool Block_IsFaceHidden(BlockID block, BlockID other, Face face) {
-	return (Blocks.Hidden[(block * BLOCK_COUNT) + other] & (1 << face)) != 0;
+	Block_CalcHiddenFaces();
+	return (Block_HiddenFaces(block, other) & (1 << face)) != 0;
 }
 
 void Block_UpdateAllCulling(void) {
-	int block, neighbour;
+	int block;
 	for (block = BLOCK_AIR; block < BLOCK_COUNT; block++) {
 		Block_CalcStretch((BlockID)block);
-		for (neighbour = BLOCK_AIR; neighbour < BLOCK_COUNT; neighbour++) {
-			Block_CalcCulling((BlockID)block, (BlockID)neighbour);
-		}
 	}
+	cullingDirty = true;
 }
 
 void Block_UpdateCulling(BlockID block) {
-	int neighbour;
 	Block_CalcStretch(block);
-	
-	for (neighbour = BLOCK_AIR; neighbour < BLOCK_COUNT; neighbour++) {
-		Block_CalcCulling(block, (BlockID)neighbour);
-		Block_CalcCulling((BlockID)neighbour, block);
-	}
+	cullingDirty = true;
+}
+
+static cc_bool deferUpdates, deferredDefChanged;
+
+void Block_RaiseDefChanged(void) {
+	if (deferUpdates) { deferredDefChanged = true; return; }
+	Event_RaiseVoid(&BlockEvents.BlockDefChanged);
+}
+
+void Block_BeginDeferredUpdates(void) { deferUpdates = true; }
+
+void Block_EndDeferredUpdates(void) {
+	if (!deferUpdates) return;
+	deferUpdates = false;
+	if (!deferredDefChanged) return;
+
+	deferredDefChanged = false;
+	Event_RaiseVoid(&BlockEvents.BlockDefChanged);
 }
 
 
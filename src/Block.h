@@ -96,8 +96,13 @@ CC_VAR extern struct _BlockLists {
 	/* Whether this block is allowed to be deleted. */
 	cc_bool CanDelete[BLOCK_COUNT];
 
-	/* Bit flags of faces hidden of two neighbouring blocks. */
-	cc_uint8 Hidden[BLOCK_COUNT * BLOCK_COUNT];
+	/* Bit flags of faces hidden of two neighbouring culling classes. */
+	/* NOTE: Use Block_HiddenFaces, and call Block_CalcHiddenFaces before using this. */
+	cc_uint8* Hidden;
+	/* Culling class of each block. Blocks in the same class are culled identically. */
+	cc_uint16 CullClass[BLOCK_COUNT];
+	/* Number of culling classes. (i.e. size of a row in Hidden) */
+	int CullStride;
 	/* Bit flags of which faces of this block can stretch with greedy meshing. */
 	cc_uint8 CanStretch[BLOCK_COUNT];
 } Blocks;
@@ -144,12 +149,24 @@ void Block_SetSide(TextureLoc texLoc, BlockID blockId);
 /* The texture for the given face of the given block. */
 #define Block_Tex(block, face) Blocks.Textures[(block) * FACE_COUNT + (face)]
 
+/* Bit flags of the faces of 'block' that are hidden by 'other' block. */
+#define Block_HiddenFaces(block, other) Blocks.Hidden[Blocks.CullClass[block] * Blocks.CullStride + Blocks.CullClass[other]]
+/* Recalculates Blocks.Hidden if any blocks have changed since it was last calculated. */
+void Block_CalcHiddenFaces(void);
 cc_bool Block_IsFaceHidden(BlockID block, BlockID other, Face face);
 /* Updates culling data of all blocks. */
 void Block_UpdateAllCulling(void);
 /* Updates culling data just for this block. */
 /* (e.g. whether block can be stretched, visibility with other blocks) */
+/* NOTE: Visibility with other blocks is only recalculated by the next Block_CalcHiddenFaces. */
 void Block_UpdateCulling(BlockID block);
+/* Raises BlockEvents.BlockDefChanged. */
+void Block_RaiseDefChanged(void);
+/* Delays Block_RaiseDefChanged until Block_EndDeferredUpdates is called. */
+/* Used when many block definitions change at once (e.g. servers send hundreds when joining) */
+void Block_BeginDeferredUpdates(void);
+/* Raises BlockEvents.BlockDefChanged once if any definitions were changed since Block_BeginDeferredUpdates. */
+void Block_EndDeferredUpdates(void);
 
 /* Whether blocks can be automatically rotated. */
 extern cc_bool AutoRotate_Enabled;
@@ -18,6 +18,7 @@
 #include "TexturePack.h"
 #include "Options.h"
 #include "Drawer2D.h"
+#include "Protocol.h"
 
 static char msgs[12][STRING_SIZE];
 cc_string Chat_Status[4]       = { String_FromArray(msgs[0]), String_FromArray(msgs[1]), String_FromArray(msgs[2]), String_FromArray(msgs[3]) };
@@ -607,6 +608,98 @@ static struct ChatCommand TeleportCommand = {
 	}
 };
 
+static void PacketStats_Format(cc_string* str, int opcode) {
+	struct NetPacketProfile* prof = &Net_PacketProfiles[opcode];
+	const char* name = Protocol_OpcodeName(opcode);
+	int kb    = (int)(prof->bytes / 1024);
+	int total = (int)(prof->totalMicros / 1000);
+	int avg   = (int)(prof->totalMicros / prof->packets);
+
+	if (name) {
+		String_Format2(str, "%c (%i)", name, &opcode);
+	} else {
+		String_Format1(str, "Opcode %i", &opcode);
+	}
+	String_Format4(str, ": %i packets, %i KB, %i ms total, %i us avg", 
+		&prof->packets, &kb, &total, &avg);
+	String_Format1(str, ", %i us max", &prof->maxMicros);
+}
+
+static void PacketStats_Print(void) {
+	cc_string str; char strBuffer[STRING_SIZE * 2];
+	cc_bool printed[256] = { 0 };
+	int i, j, best;
+
+	/* Show the opcodes whose handlers took the most time overall */
+	for (i = 0; i < 10; i++) {
+		best = -1;
+		for (j = 0; j < 256; j++) {
+			if (printed[j] || !Net_PacketProfiles[j].packets) continue;
+			if (best == -1 || Net_PacketProfiles[j].totalMicros > Net_PacketProfiles[best].totalMicros) best = j;
+		}
+		if (best == -1) break;
+
+		printed[best] = true;
+		String_InitArray(str, strBuffer);
+		PacketStats_Format(&str, best);
+		Chat_Add1("&e%s", &str);
+	}
+	if (!i) Chat_AddRaw("&e/client: &fNo packets have been profiled yet.");
+}
+
+static void PacketStats_Save(void) {
+	static const cc_string path = String_FromConst("packetstats.txt");
+	cc_string str; char strBuffer[STRING_SIZE * 2];
+	struct Stream stream;
+	cc_result res;
+	int i;
+
+	res = Stream_CreateFile(&stream, &path);
+	if (res) { Logger_SysWarn2(res, "creating", &path); return; }
+
+	for (i = 0; i < 256; i++) {
+		if (!Net_PacketProfiles[i].packets) continue;
+		String_InitArray(str, strBuffer);
+		PacketStats_Format(&str, i);
+		if ((res = Stream_WriteLine(&stream, &str))) break;
+	}
+
+	if (res) Logger_SysWarn2(res, "writing to", &path);
+	res = stream.Close(&stream);
+	if (res) { Logger_SysWarn2(res, "closing", &path); return; }
+	Chat_Add1("&e/client: &fSaved packet statistics to %s", &path);
+}
+
+static void PacketStatsCommand_Execute(const cc_string* args, int argsCount) {
+	if (!argsCount) {
+		if (!Net_ProfilePackets) Chat_AddRaw("&e/client: &fPacket profiling is off.");
+		PacketStats_Print();
+	} else if (String_CaselessEqualsConst(&args[0], "on")) {
+		Net_ProfilePackets = true;
+		Chat_AddRaw("&e/client: &fPacket profiling is now on.");
+	} else if (String_CaselessEqualsConst(&args[0], "off")) {
+		Net_ProfilePackets = false;
+		Chat_AddRaw("&e/client: &fPacket profiling is now off.");
+	} else if (String_CaselessEqualsConst(&args[0], "reset")) {
+		Mem_Set(Net_PacketProfiles, 0, sizeof(Net_PacketProfiles));
+		Chat_AddRaw("&e/client: &fPacket statistics reset.");
+	} else if (String_CaselessEqualsConst(&args[0], "save")) {
+		PacketStats_Save();
+	} else {
+		Chat_Add1("&e/client: &cUnrecognised option &f\"%s\"&c.", &args[0]);
+	}
+}
+
+static struct ChatCommand PacketStatsCommand = {
+	"PacketStats", PacketStatsCommand_Execute, false,
+	{
+		"&a/client packetstats [on/off/reset/save]",
+		"&eTimes how long handling each type of received packet takes.",
+		"&eWithout arguments, shows the packet types that took the most time.",
+		"&bsave: &eWrites statistics for all packet types to packetstats.txt",
+	}
+};
+
 
 /*########################################################################################################################*
 *-------------------------------------------------------Generic chat------------------------------------------------------*
@@ -632,6 +725,7 @@ static void OnInit(void) {
 	Commands_Register(&CuboidCommand);
 	Commands_Register(&TeleportCommand);
 	Commands_Register(&ClearDeniedCommand);
+	Commands_Register(&PacketStatsCommand);
 
 #if defined CC_BUILD_MOBILE || defined CC_BUILD_WEB
 	/* Better to not log chat by default on mobile/web, */
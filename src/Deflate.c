@@ -14,7 +14,7 @@
 enum GzipState {
 	GZIP_STATE_HEADER1, GZIP_STATE_HEADER2, GZIP_STATE_COMPRESSIONMETHOD, GZIP_STATE_FLAGS,
 	GZIP_STATE_LASTMODIFIED, GZIP_STATE_COMPRESSIONFLAGS, GZIP_STATE_OPERATINGSYSTEM, 
-	GZIP_STATE_HEADERCHECKSUM, GZIP_STATE_FILENAME, GZIP_STATE_COMMENT, GZIP_STATE_DONE
+	GZIP_STATE_FILENAME, GZIP_STATE_COMMENT, GZIP_STATE_HEADERCHECKSUM, GZIP_STATE_DONE
 };
 
 void GZipHeader_Init(struct GZipHeader* header) {
@@ -142,9 +142,9 @@ enum INFLATE_STATE_ {
 };
 
 /* Insert next byte into the bit buffer */
-#define Inflate_GetByte(state) state->AvailIn--; state->Bits |= (cc_uint32)(*state->NextIn++) << state->NumBits; state->NumBits += 8;
+#define Inflate_GetByte(state) state->AvailIn--; state->Bits |= (cc_uintptr)(*state->NextIn++) << state->NumBits; state->NumBits += 8;
 /* Retrieves bits from the bit buffer */
-#define Inflate_PeekBits(state, bits) (state->Bits & ((1UL << (bits)) - 1UL))
+#define Inflate_PeekBits(state, bits) ((cc_uint32)state->Bits & ((1UL << (bits)) - 1UL))
 /* Consumes/eats up bits from the bit buffer */
 #define Inflate_ConsumeBits(state, bits) state->Bits >>= (bits); state->NumBits -= (bits);
 /* Aligns bit buffer to be on a byte boundary */
@@ -164,7 +164,8 @@ enum INFLATE_STATE_ {
 #define Inflate_NextCompressState(state) ((state->AvailIn >= INFLATE_FASTINF_IN && state->AvailOut >= INFLATE_FASTINF_OUT) ? INFLATE_STATE_FASTCOMPRESSED : INFLATE_STATE_COMPRESSED_LIT)
 /* The maximum amount of bytes that can be output is 258 */
 #define INFLATE_FASTINF_OUT 258
-/* The most input bytes required for huffman codes and extra data is 16 + 5 + 16 + 13 bits. Add 3 extra bytes to account for putting data into the bit buffer. */
+/* The most input bytes required for huffman codes and extra data is 16 + 5 + 16 + 13 bits. */
+/* Add extra bytes to account for the fast path filling up the entire bit buffer. */
 #define INFLATE_FASTINF_IN 10
 
 static cc_uint32 Huffman_ReverseBits(cc_uint32 n, cc_uint8 bits) {
@@ -275,7 +276,7 @@ static int Huffman_Decode(struct InflateState* state, struct HuffmanTable* table
 		if (packed >= 0) {
 			bits = packed >> INFLATE_FAST_BITS;
 			Inflate_ConsumeBits(state, bits);
-			return packed & 0x1FF;
+			return packed & INFLATE_FAST_MASK;
 		}
 	}
 
@@ -304,7 +305,7 @@ static int Huffman_Decode(struct InflateState* state, struct HuffmanTable* table
 	if (packed >= 0) {\
 		consumedBits = packed >> INFLATE_FAST_BITS;\
 		Inflate_ConsumeBits(state, consumedBits);\
-		result = packed & 0x1FF;\
+		result = packed & INFLATE_FAST_MASK;\
 	} else {\
 		result = Huffman_UNSAFE_Decode_Slow(state, &table);\
 	}\
@@ -389,67 +390,232 @@ static const cc_uint8 codelens_order[INFLATE_MAX_CODELENS] = {
 	16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15 
 };
 
+/* Kinds of entries in the combined literals/lengths lookup table */
+enum INFLATE_FAST_ { INFLATE_FAST_SLOW, INFLATE_FAST_LIT1, INFLATE_FAST_LIT2, INFLATE_FAST_LEN };
+#define Inflate_MakeFast(kind, bits, value) (((cc_uint32)(kind) << 24) | ((cc_uint32)(bits) << 16) | (cc_uint32)(value))
+
+/* Builds the combined literals/lengths lookup table from the literals huffman table. */
+/* Each entry either decodes two literals, one literal, or a length (including its extra bits if they fit) */
+static void Inflate_BuildLitsFast(struct InflateState* s) {
+	struct HuffmanTable* table = &s->Table.Lits;
+	int i, packed, bits, value, next, nextBits;
+	int lenIdx, extraBits;
+
+	for (i = 0; i < (1 << INFLATE_FAST_BITS); i++) {
+		packed = table->Fast[i];
+		/* Codeword is longer than INFLATE_FAST_BITS */
+		if (packed < 0) { s->LitsFast[i] = INFLATE_FAST_SLOW; continue; }
+
+		bits  = packed >> INFLATE_FAST_BITS;
+		value = packed & INFLATE_FAST_MASK;
+
+		if (value < 256) {
+			/* Remaining bits of the index might completely contain the next literal's codeword too */
+			next     = table->Fast[i >> bits];
+			nextBits = next >> INFLATE_FAST_BITS;
+
+			if (next >= 0 && bits + nextBits <= INFLATE_FAST_BITS && (next & INFLATE_FAST_MASK) < 256) {
+				value |= (next & INFLATE_FAST_MASK) << 8;
+				s->LitsFast[i] = Inflate_MakeFast(INFLATE_FAST_LIT2, bits + nextBits, value);
+			} else {
+				s->LitsFast[i] = Inflate_MakeFast(INFLATE_FAST_LIT1, bits, value);
+			}
+		} else if (value > 256 && value < 286) {
+			lenIdx    = value - 257;
+			extraBits = len_bits[lenIdx];
+
+			/* Remaining bits of the index might completely contain the extra length bits too */
+			if (bits + extraBits <= INFLATE_FAST_BITS) {
+				value = len_base[lenIdx] + ((i >> bits) & ((1 << extraBits) - 1));
+				s->LitsFast[i] = Inflate_MakeFast(INFLATE_FAST_LEN, bits + extraBits, value);
+			} else {
+				value = len_base[lenIdx] | (extraBits << 9);
+				s->LitsFast[i] = Inflate_MakeFast(INFLATE_FAST_LEN, bits, value);
+			}
+		} else {
+			/* End of block, or an invalid length */
+			s->LitsFast[i] = INFLATE_FAST_SLOW;
+		}
+	}
+}
+
+#if defined __GNUC__
+/* Compiles down to a single unaligned load and store on most architectures */
+#define Inflate_Copy8(dst, src) __builtin_memcpy(dst, src, 8);
+#elif defined _M_IX86 || defined _M_X64
+#define Inflate_Copy8(dst, src) *((cc_uint64*)(dst)) = *((const cc_uint64*)(src));
+#else
+#define Inflate_Copy8(dst, src) dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2]; dst[3] = src[3];\
+								dst[4] = src[4]; dst[5] = src[5]; dst[6] = src[6]; dst[7] = src[7];
+#endif
+
+/* Copies 'len' bytes from 'dist' bytes back, 8 bytes at a time where possible */
+/* NOTE: Only ever writes to dst[0] to dst[len - 1] */
+static void Inflate_CopyMatch(cc_uint8* dst, cc_uint32 dist, cc_uint32 len) {
+	cc_uint8* end = dst + len;
+	cc_uint8* src = dst - dist;
+	cc_uint32 i, stride;
+
+	if (dist < 8) {
+		/* Source and destination overlap, so copy first few bytes one at a time */
+		for (i = 0; i < 8 && dst < end; i++) { *dst++ = *src++; }
+
+		/* Output now repeats every 'dist' bytes, so can move source back far enough to not overlap */
+		for (stride = dist; stride < 8; stride += dist) { }
+		src = dst - stride;
+	}
+
+	for (; end - dst >= 8; dst += 8, src += 8) { Inflate_Copy8(dst, src) }
+	while (dst < end) { *dst++ = *src++; }
+}
+
+/* Bit buffer is kept in local variables, as otherwise writes to the window might alias it */
+#define Inflate_FastGetByte() bits |= (cc_uintptr)(*in++) << numBits; numBits += 8;
+#define Inflate_FastEnsureBits(count) while (numBits < (count)) { Inflate_FastGetByte(); }
+#define Inflate_FastPeekBits(count) ((cc_uint32)bits & ((1UL << (count)) - 1UL))
+#define Inflate_FastConsumeBits(count) bits >>= (count); numBits -= (count);
+#define Inflate_FastSave(s) s->Bits = bits; s->NumBits = numBits; s->NextIn = in; s->AvailIn = (cc_uint32)(inEnd - in);
+#define Inflate_FastLoad(s) bits = s->Bits; numBits = s->NumBits; in = s->NextIn;
+#define INFLATE_BITBUF_BITS (sizeof(cc_uintptr) * 8)
+
+/* On little endian 64 bit systems, can refill the bit buffer by reading 8 bytes at once */
+#if defined __GNUC__ && defined __BYTE_ORDER__ && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) && (__SIZEOF_POINTER__ == 8)
+#define INFLATE_FAST_REFILL
+#define Inflate_ReadU64(dst, src) __builtin_memcpy(&dst, src, 8);
+#elif defined _M_X64
+#define INFLATE_FAST_REFILL
+#define Inflate_ReadU64(dst, src) dst = *((const cc_uint64*)(src));
+#endif
+
 static void Inflate_InflateFast(struct InflateState* s) {
+	/* bit buffer variables */
+	cc_uintptr bits;
+	cc_uint32 numBits;
+	cc_uint8* in;
+	cc_uint8* inEnd;
+#ifdef INFLATE_FAST_REFILL
+	cc_uint64 word;
+#endif
+
 	/* huffman variables */
-	cc_uint32 lit, len, dist;
-	cc_uint32 bits, lenIdx, distIdx;
+	cc_uint32 entry, lit, len, dist;
+	cc_uint32 extra, lenIdx, distIdx;
 	int packed, consumedBits;
 
 	/* window variables */
 	cc_uint8* window;
-	cc_uint32 i, curIdx, startIdx;
+	cc_uint32 curIdx, startIdx, availOut;
 	cc_uint32 copyStart, copyLen, partLen;
 
 	window = s->Window;
 	curIdx = s->WindowIndex;
 	copyStart = s->WindowIndex;
 	copyLen   = 0;
+	availOut  = s->AvailOut;
+	inEnd     = s->NextIn + s->AvailIn;
+	Inflate_FastLoad(s);
 
 #define INFLATE_FAST_COPY_MAX (INFLATE_WINDOW_SIZE - INFLATE_FASTINF_OUT)
-	while (s->AvailOut >= INFLATE_FASTINF_OUT && s->AvailIn >= INFLATE_FASTINF_IN && copyLen < INFLATE_FAST_COPY_MAX) {
-		Huffman_UNSAFE_Decode(s, s->Table.Lits, lit);
+	while (availOut >= INFLATE_FASTINF_OUT && inEnd - in >= INFLATE_FASTINF_IN && copyLen < INFLATE_FAST_COPY_MAX) {
+		/* Fill up the bit buffer, so that rarely need to read more bits below */
+		/* (64 bit buffer always has enough bits for an entire length + distance) */
+#ifdef INFLATE_FAST_REFILL
+		/* Reading 8 bytes is always safe here, as INFLATE_FASTINF_IN is larger than 8 */
+		Inflate_ReadU64(word, in);
+		bits    |= (cc_uintptr)word << numBits;
+		in      += (63 - numBits) >> 3;
+		numBits |= 56;
+#else
+		while (numBits <= INFLATE_BITBUF_BITS - 8) { Inflate_FastGetByte(); }
+#endif
+		entry = s->LitsFast[bits & INFLATE_FAST_MASK];
+
+		switch (entry >> 24) {
+		case INFLATE_FAST_LIT2:
+			window[curIdx] = (cc_uint8)entry;
+			window[(curIdx + 1) & INFLATE_WINDOW_MASK] = (cc_uint8)(entry >> 8);
+			Inflate_FastConsumeBits((entry >> 16) & 0xFF);
+
+			curIdx = (curIdx + 2) & INFLATE_WINDOW_MASK;
+			availOut -= 2; copyLen += 2;
+			continue;
+
+		case INFLATE_FAST_LIT1:
+			window[curIdx] = (cc_uint8)entry;
+			Inflate_FastConsumeBits((entry >> 16) & 0xFF);
+
+			curIdx = (curIdx + 1) & INFLATE_WINDOW_MASK;
+			availOut--; copyLen++;
+			continue;
+
+		case INFLATE_FAST_LEN:
+			Inflate_FastConsumeBits((entry >> 16) & 0xFF);
+			extra = (entry >> 9) & 0x0F;
+			len   = (entry & 0x1FF) + Inflate_FastPeekBits(extra);
+			Inflate_FastConsumeBits(extra);
+			break;
+
+		default:
+			/* End of block, or codeword is longer than INFLATE_FAST_BITS */
+			Inflate_FastSave(s);
+			Huffman_UNSAFE_Decode(s, s->Table.Lits, lit);
+			Inflate_FastLoad(s);
+			if (s->State == INFLATE_STATE_DONE) goto finished;
 
-		if (lit <= 256) {
 			if (lit < 256) {
 				window[curIdx] = (cc_uint8)lit;
-				s->AvailOut--; copyLen++;
 				curIdx = (curIdx + 1) & INFLATE_WINDOW_MASK;
-			} else {
+				availOut--; copyLen++;
+				continue;
+			} else if (lit == 256) {
 				s->State = Inflate_NextBlockState(s);
-				break;
+				goto finished;
 			}
-		} else {
+
 			lenIdx = lit - 257;
-			bits = len_bits[lenIdx];
-			Inflate_UNSAFE_EnsureBits(s, bits);
-			len  = len_base[lenIdx] + Inflate_ReadBits(s, bits);
-
-			Huffman_UNSAFE_Decode(s, s->TableDists, distIdx);
-			bits = dist_bits[distIdx];
-			Inflate_UNSAFE_EnsureBits(s, bits);
-			dist = dist_base[distIdx] + Inflate_ReadBits(s, bits);
-	
-			/* Window infinitely repeats like ...xyz|uvwxyz|uvwxyz|uvw... */
-			/* If start and end don't cross a boundary, can avoid masking index */
-			startIdx = (curIdx - dist) & INFLATE_WINDOW_MASK;
-			if (curIdx >= startIdx && (curIdx + len) < INFLATE_WINDOW_SIZE) {
-				cc_uint8* src = &window[startIdx]; 
-				cc_uint8* dst = &window[curIdx];
-
-				for (i = 0; i < (len & ~0x3); i += 4) {
-					*dst++ = *src++; *dst++ = *src++; *dst++ = *src++; *dst++ = *src++;
-				}
-				for (; i < len; i++) { *dst++ = *src++; }
-			} else {
-				for (i = 0; i < len; i++) {
-					window[(curIdx + i) & INFLATE_WINDOW_MASK] = window[(startIdx + i) & INFLATE_WINDOW_MASK];
-				}
+			extra  = len_bits[lenIdx];
+			Inflate_FastEnsureBits(extra);
+			len = len_base[lenIdx] + Inflate_FastPeekBits(extra);
+			Inflate_FastConsumeBits(extra);
+			break;
+		}
+
+		Inflate_FastEnsureBits(INFLATE_MAX_BITS);
+		packed = s->TableDists.Fast[bits & INFLATE_FAST_MASK];
+		if (packed >= 0) {
+			distIdx = packed & INFLATE_FAST_MASK;
+			Inflate_FastConsumeBits(packed >> INFLATE_FAST_BITS);
+		} else {
+			Inflate_FastSave(s);
+			distIdx = Huffman_UNSAFE_Decode_Slow(s, &s->TableDists);
+			Inflate_FastLoad(s);
+			if (s->State == INFLATE_STATE_DONE) goto finished;
+		}
+
+		extra = dist_bits[distIdx];
+		Inflate_FastEnsureBits(extra);
+		dist = dist_base[distIdx] + Inflate_FastPeekBits(extra);
+		Inflate_FastConsumeBits(extra);
+		/* Distance codes 30 and 31 are invalid */
+		if (!dist) { Inflate_Fail(s, INF_ERR_INVALID_CODE); break; }
+
+		/* Window infinitely repeats like ...xyz|uvwxyz|uvwxyz|uvw... */
+		/* If start and end don't cross a boundary, can avoid masking index */
+		startIdx = (curIdx - dist) & INFLATE_WINDOW_MASK;
+		if (curIdx >= startIdx && (curIdx + len) < INFLATE_WINDOW_SIZE) {
+			Inflate_CopyMatch(&window[curIdx], dist, len);
+		} else {
+			for (lenIdx = 0; lenIdx < len; lenIdx++) {
+				window[(curIdx + lenIdx) & INFLATE_WINDOW_MASK] = window[(startIdx + lenIdx) & INFLATE_WINDOW_MASK];
 			}
-			curIdx = (curIdx + len) & INFLATE_WINDOW_MASK;
-			s->AvailOut -= len; copyLen += len;
 		}
+		curIdx = (curIdx + len) & INFLATE_WINDOW_MASK;
+		availOut -= len; copyLen += len;
 	}
 
+finished:
+	Inflate_FastSave(s);
+	s->AvailOut    = availOut;
 	s->WindowIndex = curIdx;
 	if (!copyLen) return;
 
@@ -497,6 +663,7 @@ void Inflate_Process(struct InflateState* s) {
 			case 1: { /* Fixed/static huffman compressed */
 				(void)Huffman_Build(&s->Table.Lits, fixed_lits,  INFLATE_MAX_LITS);
 				(void)Huffman_Build(&s->TableDists, fixed_dists, INFLATE_MAX_DISTS);
+				Inflate_BuildLitsFast(s);
 				s->State = Inflate_NextCompressState(s);
 			} break;
 
@@ -606,6 +773,7 @@ void Inflate_Process(struct InflateState* s) {
 				if (res) { Inflate_Fail(s, res); return; }
 				res = Huffman_Build(&s->TableDists, s->Buffer + s->NumLits, s->NumDists);
 				if (res) { Inflate_Fail(s, res); return; }
+				Inflate_BuildLitsFast(s);
 			}
 			break;
 		}
@@ -785,7 +953,7 @@ static const cc_uint16 deflate_dist[31] = {
 };
 
 /* Pushes given bits, but does not write them */
-#define Deflate_PushBits(state, value, bits) state->Bits |= (value) << state->NumBits; state->NumBits += (bits);
+#define Deflate_PushBits(state, value, bits) state->Bits |= (cc_uint32)(value) << state->NumBits; state->NumBits += (bits);
 /* Pushes bits of the huffman codeword bits for the given literal, but does not write them */
 #define Deflate_PushLit(state, value) Deflate_PushBits(state, state->LitsCodewords[value], state->LitsLens[value])
 /* Pushes given bits (reversing for huffman code), but does not write them */
@@ -797,6 +965,44 @@ static const cc_uint16 deflate_dist[31] = {
 
 #define MIN_MATCH_LEN 3
 #define MAX_MATCH_LEN 258
+/* Matches of minimum length that are further back than this usually take more bits than 3 literals */
+#define DEFLATE_TOO_FAR 4096
+
+/* Limits for how hard to search for matches at each compression level. (based on zlib's) */
+static const struct DeflateConfig {
+	cc_uint16 goodLen;  /* Search less hard for a match, once previous match is at least this long */
+	cc_uint16 lazyLen;  /* Don't try lazy matching, once previous match is at least this long */
+	cc_uint16 niceLen;  /* Stop searching for a match, once a match at least this long is found */
+	cc_uint16 maxChain; /* Max number of previous positions in the hash chain to try matching against */
+} deflate_configs[4] = {
+	{  0,   0,   0,    0 }, /* DEFLATE_LEVEL_FAST (unused, see Deflate_CompressFast) */
+	{  8,  16, 128,  128 }, /* DEFLATE_LEVEL_DEFAULT */
+	{ 32, 258, 258, 4096 }, /* DEFLATE_LEVEL_MAX */
+	{  4,   4,  16,    8 }  /* DEFLATE_LEVEL_LIGHT */
+};
+
+/* Lookup tables for converting a match length/distance into its DEFLATE code */
+static cc_uint8 deflate_lenCode[MAX_MATCH_LEN + 1];
+static cc_uint8 deflate_distCode[512];
+/* Distances above 256 are looked up in 128 distance sized buckets */
+#define Deflate_DistCode(dist) ((dist) <= 256 ? deflate_distCode[(dist) - 1] : deflate_distCode[256 + (((dist) - 1) >> 7)])
+
+void Deflate_Init(void) {
+	int i, j;
+
+	for (i = MIN_MATCH_LEN, j = 0; i <= MAX_MATCH_LEN; i++) {
+		while (i >= deflate_len[j + 1]) j++;
+		deflate_lenCode[i] = j;
+	}
+	for (i = 1, j = 0; i <= 256; i++) {
+		while (i >= deflate_dist[j + 1]) j++;
+		deflate_distCode[i - 1] = j;
+	}
+	for (i = 257; i <= INFLATE_WINDOW_SIZE; i += 128) {
+		while (i >= deflate_dist[j + 1]) j++;
+		deflate_distCode[256 + ((i - 1) >> 7)] = j;
+	}
+}
 
 /* Number of bytes that match (are the same) from a and b */
 static int Deflate_MatchLen(cc_uint8* a, cc_uint8* b, int maxLen) {
@@ -807,7 +1013,16 @@ static int Deflate_MatchLen(cc_uint8* a, cc_uint8* b, int maxLen) {
 
 /* Hashes 3 bytes of data */
 static cc_uint32 Deflate_Hash(cc_uint8* src) {
-	return (cc_uint32)((src[0] << 8) ^ (src[1] << 4) ^ (src[2])) & DEFLATE_HASH_MASK;
+	cc_uint32 value = (src[0] << 16) | (src[1] << 8) | src[2];
+	return (cc_uint32)(value * 0x9E3779B1UL) >> (32 - DEFLATE_HASH_BITS);
+}
+
+/* Writes buffered output data to the destination stream */
+static cc_result Deflate_FlushOutput(struct DeflateState* state) {
+	cc_result res = Stream_Write(state->Dest, state->Output, DEFLATE_OUT_SIZE - state->AvailOut);
+	state->NextOut  = state->Output;
+	state->AvailOut = DEFLATE_OUT_SIZE;
+	return res;
 }
 
 /* Writes a literal to state->Output */
@@ -834,7 +1049,7 @@ static void Deflate_LenDist(struct DeflateState* state, int len, int dist) {
 
 /* Moves "current block" to "previous block", adjusting state if needed. */
 static void Deflate_MoveBlock(struct DeflateState* state) {
-	int i;
+	int i, pos;
 	Mem_Copy(state->Input, state->Input + DEFLATE_BLOCK_SIZE, DEFLATE_BLOCK_SIZE);
 	state->InputPosition = DEFLATE_BLOCK_SIZE;
 
@@ -842,13 +1057,15 @@ static void Deflate_MoveBlock(struct DeflateState* state) {
 	for (i = 0; i < Array_Elems(state->Head); i++) {
 		state->Head[i] = state->Head[i] < DEFLATE_BLOCK_SIZE ? 0 : (state->Head[i] - DEFLATE_BLOCK_SIZE);
 	}
-	for (i = 0; i < Array_Elems(state->Prev); i++) {
-		state->Prev[i] = state->Prev[i] < DEFLATE_BLOCK_SIZE ? 0 : (state->Prev[i] - DEFLATE_BLOCK_SIZE);
+	/* hash chains of "current block" become the hash chains of "previous block" */
+	for (i = 0; i < DEFLATE_BLOCK_SIZE; i++) {
+		pos = state->Prev[i + DEFLATE_BLOCK_SIZE];
+		state->Prev[i] = pos < DEFLATE_BLOCK_SIZE ? 0 : (pos - DEFLATE_BLOCK_SIZE);
 	}
 }
 
-/* Compresses current block of data */
-static cc_result Deflate_FlushBlock(struct DeflateState* state, int len) {
+/* Compresses current block of data, using greedy matching and fixed huffman codes */
+static cc_result Deflate_CompressFast(struct DeflateState* state, int len) {
 	cc_uint32 hash, nextHash;
 	int bestLen, maxLen, matchLen, depth;
 	int bestPos, pos, nextPos;
@@ -916,10 +1133,7 @@ static cc_result Deflate_FlushBlock(struct DeflateState* state, int len) {
 
 		/* leave room for a few bytes and literals at end */
 		if (state->AvailOut >= 20) continue;
-		res = Stream_Write(state->Dest, state->Output, DEFLATE_OUT_SIZE - state->AvailOut);
-		state->NextOut  = state->Output;
-		state->AvailOut = DEFLATE_OUT_SIZE;
-		if (res) return res;
+		if ((res = Deflate_FlushOutput(state))) return res;
 	}
 
 	/* literals for last few bytes */
@@ -927,10 +1141,361 @@ static cc_result Deflate_FlushBlock(struct DeflateState* state, int len) {
 		Deflate_Lit(state, *cur);
 		len--; cur++;
 	}
+	return Deflate_FlushOutput(state);
+}
 
-	res = Stream_Write(state->Dest, state->Output, DEFLATE_OUT_SIZE - state->AvailOut);
-	state->NextOut  = state->Output;
-	state->AvailOut = DEFLATE_OUT_SIZE;
+
+/* Inserts the 3 bytes at the given position into the hash chains */
+static void Deflate_Insert(struct DeflateState* state, int pos) {
+	cc_uint32 hash = Deflate_Hash(&state->Input[pos]);
+	state->Prev[pos]  = state->Head[hash];
+	state->Head[hash] = pos;
+}
+
+/* Finds the longest match for the given position that is longer than bestLen */
+/* NOTE: The given position must have already been inserted into the hash chains */
+static int Deflate_LongestMatch(struct DeflateState* state, int pos, int maxLen, int bestLen, 
+								const struct DeflateConfig* cfg, int* bestDist) {
+	cc_uint8* input = state->Input;
+	cc_uint8* cur   = input + pos;
+	cc_uint8* match;
+	int chain = cfg->maxChain;
+	int cand, len;
+
+	if (bestLen >= maxLen) return bestLen;
+	/* Previous match is already good, so don't search as hard */
+	if (bestLen >= cfg->goodLen) chain >>= 2;
+
+	for (cand = state->Prev[pos]; cand && chain; cand = state->Prev[cand], chain--) {
+		match = input + cand;
+		/* Quickly reject candidates that can't be longer than the current best match */
+		if (match[bestLen] != cur[bestLen] || match[0] != cur[0] || match[1] != cur[1]) continue;
+
+		len = Deflate_MatchLen(match, cur, maxLen);
+		if (len <= bestLen) continue;
+
+		bestLen   = len;
+		*bestDist = pos - cand;
+		if (len >= cfg->niceLen || len >= maxLen) break;
+	}
+	return bestLen;
+}
+
+/* Adds a literal to the symbols of the current block */
+#define Deflate_AddLit(state, lit) state->SymLits[state->NumSyms] = lit; state->SymDists[state->NumSyms++] = 0;
+/* Adds a length-distance pair to the symbols of the current block */
+#define Deflate_AddLenDist(state, len, dist) state->SymLits[state->NumSyms] = len; state->SymDists[state->NumSyms++] = dist;
+
+/* Converts current block of data into literals and length-distance pairs, using lazy matching */
+/* Based off the description of deflate_slow in zlib's deflate.c */
+static void Deflate_FindSymbols(struct DeflateState* state, int len) {
+	const struct DeflateConfig* cfg = &deflate_configs[state->Level];
+	cc_uint8* input = state->Input;
+	int pos = DEFLATE_BLOCK_SIZE, end = DEFLATE_BLOCK_SIZE + len;
+	int prevLen = MIN_MATCH_LEN - 1, prevDist = 0;
+	int curLen, curDist, matchEnd;
+	cc_bool hasPrev = false;
+
+	state->NumSyms = 0;
+	while (pos < end) {
+		curLen = MIN_MATCH_LEN - 1; curDist = 0;
+
+		if (end - pos >= MIN_MATCH_LEN) {
+			Deflate_Insert(state, pos);
+			/* Don't bother searching when previous match is already long enough */
+			if (prevLen < cfg->lazyLen) {
+				curLen = Deflate_LongestMatch(state, pos, min(end - pos, MAX_MATCH_LEN), 
+											prevLen, cfg, &curDist);
+			}
+			if (curLen == MIN_MATCH_LEN && curDist > DEFLATE_TOO_FAR) curLen = MIN_MATCH_LEN - 1;
+		}
+
+		if (prevLen >= MIN_MATCH_LEN && curLen <= prevLen) {
+			/* Match at previous byte is at least as good, so use it */
+			Deflate_AddLenDist(state, prevLen, prevDist);
+			matchEnd = pos - 1 + prevLen;
+
+			/* Previous and current byte were already inserted into hash chains */
+			for (pos++; pos < matchEnd; pos++) {
+				if (end - pos >= MIN_MATCH_LEN) Deflate_Insert(state, pos);
+			}
+			hasPrev = false;
+			prevLen = MIN_MATCH_LEN - 1;
+		} else {
+			/* Match at current byte (if any) is better, so previous byte becomes a literal */
+			if (hasPrev) { Deflate_AddLit(state, input[pos - 1]); }
+			hasPrev  = true;
+			prevLen  = curLen;
+			prevDist = curDist;
+			pos++;
+		}
+	}
+	if (hasPrev) { Deflate_AddLit(state, input[pos - 1]); }
+}
+
+/* Computes minimum redundancy code lengths of the given frequencies, which must be sorted in ascending order. */
+/* Based off 'In-place calculation of minimum-redundancy codes' by Alistair Moffat and Jyrki Katajainen */
+static void Huffman_CalcCodeLens(int* A, int n) {
+	int root, leaf, next, avbl, used, depth;
+	A[0] += A[1]; root = 0; leaf = 2;
+
+	/* first pass, left to right, setting parent pointers */
+	for (next = 1; next < n - 1; next++) {
+		if (leaf >= n || A[root] < A[leaf]) {
+			A[next] = A[root]; A[root++] = next;
+		} else {
+			A[next] = A[leaf++];
+		}
+
+		if (leaf >= n || (root < next && A[root] < A[leaf])) {
+			A[next] += A[root]; A[root++] = next;
+		} else {
+			A[next] += A[leaf++];
+		}
+	}
+
+	/* second pass, right to left, setting internal depths */
+	A[n - 2] = 0;
+	for (next = n - 3; next >= 0; next--) { A[next] = A[A[next]] + 1; }
+
+	/* third pass, right to left, setting leaf depths */
+	avbl = 1; used = depth = 0; root = n - 2; next = n - 1;
+	while (avbl > 0) {
+		while (root >= 0 && A[root] == depth) { used++; root--; }
+		while (avbl > used) { A[next--] = depth; avbl--; }
+		avbl = 2 * used; depth++; used = 0;
+	}
+}
+
+/* Computes the bit length of each codeword, limiting bit lengths to at most maxBits */
+static void Deflate_BuildLens(const cc_uint32* freqs, int count, int maxBits, cc_uint8* lens) {
+	int syms[INFLATE_MAX_LITS], depths[INFLATE_MAX_LITS];
+	int bl_count[INFLATE_MAX_BITS];
+	int i, j, n = 0, sym, total;
+
+	for (i = 0; i < count; i++) {
+		lens[i] = 0;
+		if (freqs[i]) syms[n++] = i;
+	}
+	/* DEFLATE requires at least two codes (see build_tree in zlib's trees.c) */
+	for (i = 0; n < 2; i++) {
+		if (!freqs[i]) syms[n++] = i;
+	}
+
+	/* Sort symbols by ascending frequency */
+	for (i = 1; i < n; i++) {
+		sym = syms[i];
+		for (j = i; j > 0 && freqs[syms[j - 1]] > freqs[sym]; j--) { syms[j] = syms[j - 1]; }
+		syms[j] = sym;
+	}
+
+	for (i = 0; i < n; i++) { depths[i] = freqs[syms[i]]; }
+	Huffman_CalcCodeLens(depths, n);
+
+	for (i = 0; i < INFLATE_MAX_BITS; i++) bl_count[i] = 0;
+	for (i = 0; i < n; i++) { bl_count[min(depths[i], maxBits)]++; }
+
+	/* Too long codewords were shortened to maxBits, so the tree is now oversubscribed. */
+	/* Lengthen shorter codewords until the tree is complete again. (see miniz's tdefl_huffman_enforce_max_code_size) */
+	total = 0;
+	for (i = maxBits; i > 0; i--) { total += bl_count[i] << (maxBits - i); }
+
+	while (total != (1 << maxBits)) {
+		bl_count[maxBits]--;
+		for (i = maxBits - 1; i > 0; i--) {
+			if (!bl_count[i]) continue;
+			bl_count[i]--; bl_count[i + 1] += 2; break;
+		}
+		total--;
+	}
+
+	/* Most frequent symbols are assigned shortest codewords */
+	for (i = 1, j = n; i <= maxBits; i++) {
+		for (sym = bl_count[i]; sym > 0; sym--) { lens[syms[--j]] = i; }
+	}
+}
+
+/* Run length encodes the concatenated literal and distance codeword bit lengths */
+static int Deflate_EncodeLens(const cc_uint8* lens, int count, cc_uint8* syms, cc_uint8* extra) {
+	int i = 0, n = 0, run, part;
+	cc_uint8 cur;
+
+	while (i < count) {
+		cur = lens[i];
+		for (run = 1; i + run < count && lens[i + run] == cur; run++) { }
+		i += run;
+
+		if (!cur) {
+			for (; run >= 11; run -= part) {
+				part = min(run, 138);
+				syms[n] = 18; extra[n++] = part - 11;
+			}
+			if (run >= 3) { syms[n] = 17; extra[n++] = run - 3; run = 0; }
+		} else {
+			syms[n] = cur; extra[n++] = 0; run--;
+			for (; run >= 3; run -= part) {
+				part = min(run, 6);
+				syms[n] = 16; extra[n++] = part - 3;
+			}
+		}
+		for (; run > 0; run--) { syms[n] = cur; extra[n++] = 0; }
+	}
+	return n;
+}
+
+/* Sums up number of bits needed to encode the given frequencies with the given codeword lengths */
+static cc_uint32 Deflate_CountBits(const cc_uint32* freqs, const cc_uint8* lens, int count) {
+	cc_uint32 bits = 0;
+	int i;
+	for (i = 0; i < count; i++) { bits += freqs[i] * lens[i]; }
+	return bits;
+}
+
+static void Deflate_BuildTable(const cc_uint8* lens, int count, cc_uint16* codewords, cc_uint8* bitlens);
+static const cc_uint8 codelen_bits[3] = { 2, 3, 7 };
+
+/* Writes the symbols of current block of data using the current huffman codes */
+static cc_result Deflate_WriteSymbols(struct DeflateState* state, const cc_uint16* distCodewords, const cc_uint8* distLens) {
+	cc_uint32 i, lit, dist, code;
+	cc_result res;
+
+	for (i = 0; i < state->NumSyms; i++) {
+		lit  = state->SymLits[i];
+		dist = state->SymDists[i];
+
+		if (!dist) {
+			Deflate_PushLit(state, lit);
+		} else {
+			code = deflate_lenCode[lit];
+			Deflate_PushLit(state, code + 257);
+			Deflate_PushBits(state, lit - deflate_len[code], len_bits[code]);
+			Deflate_FlushBits(state);
+
+			code = Deflate_DistCode(dist);
+			Deflate_PushBits(state, distCodewords[code], distLens[code]);
+			Deflate_FlushBits(state);
+			Deflate_PushBits(state, dist - deflate_dist[code], dist_bits[code]);
+		}
+		Deflate_FlushBits(state);
+
+		/* leave room for a few bytes and literals at end */
+		if (state->AvailOut >= 20) continue;
+		if ((res = Deflate_FlushOutput(state))) return res;
+	}
+
+	Deflate_PushLit(state, 256);
+	Deflate_FlushBits(state);
+	return 0;
+}
+
+/* Writes current block of data, using whichever of stored/fixed/dynamic huffman is smallest */
+static cc_result Deflate_WriteBlock(struct DeflateState* state, int len, cc_bool final) {
+	cc_uint32 litFreqs[INFLATE_MAX_LITS], distFreqs[INFLATE_MAX_DISTS], lensFreqs[INFLATE_MAX_CODELENS];
+	cc_uint8 lens[INFLATE_MAX_LITS_DISTS], lensSyms[INFLATE_MAX_LITS_DISTS], lensExtra[INFLATE_MAX_LITS_DISTS];
+	cc_uint8 litLens[INFLATE_MAX_LITS], distLens[INFLATE_MAX_DISTS], codeLens[INFLATE_MAX_CODELENS];
+	cc_uint16 distCodewords[INFLATE_MAX_DISTS], lensCodewords[INFLATE_MAX_CODELENS];
+	cc_uint32 i, lit, dist, code, extraBits;
+	cc_uint32 dynamicBits, fixedBits, storedBits;
+	int numLits, numDists, numLens, numCodeLens;
+	cc_result res;
+
+	/* Leave room for largest possible dynamic huffman block header */
+	if (state->AvailOut < 1024 && (res = Deflate_FlushOutput(state))) return res;
+
+	Mem_Set(litFreqs,  0, sizeof(litFreqs));
+	Mem_Set(distFreqs, 0, sizeof(distFreqs));
+	Mem_Set(lensFreqs, 0, sizeof(lensFreqs));
+	extraBits = 0;
+
+	for (i = 0; i < state->NumSyms; i++) {
+		lit  = state->SymLits[i];
+		dist = state->SymDists[i];
+		if (!dist) { litFreqs[lit]++; continue; }
+
+		code = deflate_lenCode[lit];
+		litFreqs[code + 257]++;
+		extraBits += len_bits[code];
+
+		code = Deflate_DistCode(dist);
+		distFreqs[code]++;
+		extraBits += dist_bits[code];
+	}
+	litFreqs[256] = 1;
+
+	Deflate_BuildLens(litFreqs,  INFLATE_MAX_LITS - 2,  15, litLens);
+	Deflate_BuildLens(distFreqs, INFLATE_MAX_DISTS - 2, 15, distLens);
+	for (numLits  = 286; numLits  > 257 && !litLens[numLits - 1];   numLits--)  { }
+	for (numDists = 30;  numDists > 1   && !distLens[numDists - 1]; numDists--) { }
+
+	/* Literal and distance codeword lengths are encoded together */
+	Mem_Copy(lens,           litLens,  numLits);
+	Mem_Copy(lens + numLits, distLens, numDists);
+	numLens = Deflate_EncodeLens(lens, numLits + numDists, lensSyms, lensExtra);
+	for (i = 0; i < numLens; i++) { lensFreqs[lensSyms[i]]++; }
+
+	Deflate_BuildLens(lensFreqs, INFLATE_MAX_CODELENS, 7, codeLens);
+	for (numCodeLens = 19; numCodeLens > 4 && !codeLens[codelens_order[numCodeLens - 1]]; numCodeLens--) { }
+
+	dynamicBits = 3 + 5 + 5 + 4 + numCodeLens * 3 + Deflate_CountBits(lensFreqs, codeLens, INFLATE_MAX_CODELENS)
+				+ lensFreqs[16] * 2 + lensFreqs[17] * 3 + lensFreqs[18] * 7
+				+ Deflate_CountBits(litFreqs, litLens, numLits) + Deflate_CountBits(distFreqs, distLens, numDists) + extraBits;
+	fixedBits   = 3 + Deflate_CountBits(litFreqs, fixed_lits, INFLATE_MAX_LITS) 
+				+ Deflate_CountBits(distFreqs, fixed_dists, INFLATE_MAX_DISTS) + extraBits;
+	/* Stored blocks are aligned to next byte boundary */
+	storedBits  = 3 + ((8 - ((state->NumBits + 3) & 7)) & 7) + 32 + len * 8;
+
+	if (storedBits < fixedBits && storedBits < dynamicBits) {
+		Deflate_PushBits(state, final, 3); /* block type STORED */
+		Deflate_FlushBits(state);
+		if (state->NumBits) { Deflate_PushBits(state, 0, 8 - state->NumBits); }
+
+		Deflate_PushBits(state, len, 16);
+		Deflate_FlushBits(state);
+		Deflate_PushBits(state, len ^ 0xFFFFUL, 16);
+		Deflate_FlushBits(state);
+
+		if ((res = Deflate_FlushOutput(state))) return res;
+		return Stream_Write(state->Dest, state->Input + DEFLATE_BLOCK_SIZE, len);
+	} else if (fixedBits <= dynamicBits) {
+		Deflate_PushBits(state, final | (1 << 1), 3); /* block type FIXED */
+		Deflate_BuildTable(fixed_lits,  INFLATE_MAX_LITS,  state->LitsCodewords, state->LitsLens);
+		Deflate_BuildTable(fixed_dists, INFLATE_MAX_DISTS, distCodewords, distLens);
+		return Deflate_WriteSymbols(state, distCodewords, distLens);
+	}
+
+	Deflate_PushBits(state, final | (2 << 1), 3); /* block type DYNAMIC */
+	Deflate_PushBits(state, numLits - 257, 5);
+	Deflate_PushBits(state, numDists - 1,  5);
+	Deflate_PushBits(state, numCodeLens - 4, 4);
+	Deflate_FlushBits(state);
+
+	for (i = 0; i < numCodeLens; i++) {
+		Deflate_PushBits(state, codeLens[codelens_order[i]], 3);
+		Deflate_FlushBits(state);
+	}
+
+	Deflate_BuildTable(codeLens, INFLATE_MAX_CODELENS, lensCodewords, codeLens);
+	for (i = 0; i < numLens; i++) {
+		code = lensSyms[i];
+		Deflate_PushBits(state, lensCodewords[code], codeLens[code]);
+		if (code >= 16) { Deflate_PushBits(state, lensExtra[i], codelen_bits[code - 16]); }
+		Deflate_FlushBits(state);
+	}
+
+	Deflate_BuildTable(litLens,  INFLATE_MAX_LITS - 2,  state->LitsCodewords, state->LitsLens);
+	Deflate_BuildTable(distLens, INFLATE_MAX_DISTS - 2, distCodewords,        distLens);
+	return Deflate_WriteSymbols(state, distCodewords, distLens);
+}
+
+/* Compresses current block of data */
+static cc_result Deflate_FlushBlock(struct DeflateState* state, int len, cc_bool final) {
+	cc_result res;
+	if (state->Level == DEFLATE_LEVEL_FAST) {
+		res = Deflate_CompressFast(state, len);
+	} else {
+		Deflate_FindSymbols(state, len);
+		res = Deflate_WriteBlock(state, len, final);
+	}
 
 	Deflate_MoveBlock(state);
 	return res;
@@ -958,7 +1523,7 @@ static cc_result Deflate_StreamWrite(struct Stream* stream, const cc_uint8* data
 		data += len;
 
 		if (state->InputPosition == DEFLATE_BUFFER_SIZE) {
-			res = Deflate_FlushBlock(state, DEFLATE_BLOCK_SIZE);
+			res = Deflate_FlushBlock(state, DEFLATE_BLOCK_SIZE, false);
 			if (res) return res;
 		}
 	}
@@ -971,12 +1536,15 @@ static cc_result Deflate_StreamClose(struct Stream* stream) {
 	cc_result res;
 
 	state = (struct DeflateState*)stream->Meta.Inflate;
-	res   = Deflate_FlushBlock(state, state->InputPosition - DEFLATE_BLOCK_SIZE);
+	res   = Deflate_FlushBlock(state, state->InputPosition - DEFLATE_BLOCK_SIZE, true);
 	if (res) return res;
 
 	/* Write huffman encoded "literal 256" to terminate symbols */
-	Deflate_PushLit(state, 256);
-	Deflate_FlushBits(state);
+	/* (other levels write this at the end of every block) */
+	if (state->Level == DEFLATE_LEVEL_FAST) {
+		Deflate_PushLit(state, 256);
+		Deflate_FlushBits(state);
+	}
 
 	/* In case last byte still has a few extra bits */
 	if (state->NumBits) {
@@ -987,6 +1555,35 @@ static cc_result Deflate_StreamClose(struct Stream* stream) {
 	return Stream_Write(state->Dest, state->Output, DEFLATE_OUT_SIZE - state->AvailOut);
 }
 
+/* Preloads "previous block" with the given data, so that matches in the first block can refer to it */
+static void Deflate_SetDictionary(struct DeflateState* state, const cc_uint8* data, int len) {
+	int pos, beg = DEFLATE_BLOCK_SIZE - len;
+	Mem_Copy(state->Input + beg, data, len);
+
+	/* Position 0 indicates 'no match' in hash chains */
+	for (pos = max(beg, 1); pos <= DEFLATE_BLOCK_SIZE - MIN_MATCH_LEN; pos++) {
+		Deflate_Insert(state, pos);
+	}
+}
+
+/* Compresses any buffered data, then aligns output to a byte boundary by writing an empty stored block */
+/* NOTE: Only supported by levels other than DEFLATE_LEVEL_FAST */
+static cc_result Deflate_SyncFlush(struct DeflateState* state) {
+	int len = state->InputPosition - DEFLATE_BLOCK_SIZE;
+	cc_result res;
+	if (len && (res = Deflate_FlushBlock(state, len, false))) return res;
+
+	Deflate_PushBits(state, 0, 3); /* final block FALSE, block type STORED */
+	Deflate_FlushBits(state);
+	if (state->NumBits) { Deflate_PushBits(state, 0, 8 - state->NumBits); }
+	Deflate_FlushBits(state);
+
+	Deflate_PushBits(state, 0x0000, 16);
+	Deflate_PushBits(state, 0xFFFF, 16);
+	Deflate_FlushBits(state);
+	return Deflate_FlushOutput(state);
+}
+
 /* Constructs a huffman encoding table (for values to codewords) */
 static void Deflate_BuildTable(const cc_uint8* lens, int count, cc_uint16* codewords, cc_uint8* bitlens) {
 	int i, j, offset, codeword;
@@ -1022,6 +1619,7 @@ void Deflate_MakeStream(struct Stream* stream, struct DeflateState* state, struc
 	state->AvailOut = DEFLATE_OUT_SIZE;
 	state->Dest     = underlying;
 	state->WroteHeader = false;
+	state->Level    = DEFLATE_LEVEL_DEFAULT;
 
 	Mem_Set(state->Head, 0, sizeof(state->Head));
 	Mem_Set(state->Prev, 0, sizeof(state->Prev));
@@ -1032,41 +1630,39 @@ void Deflate_MakeStream(struct Stream* stream, struct DeflateState* state, struc
 /*########################################################################################################################*
 *-----------------------------------------------------GZip (compress)-----------------------------------------------------*
 *#########################################################################################################################*/
-static cc_result GZip_StreamClose(struct Stream* stream) {
-	struct GZipState* state = (struct GZipState*)stream->Meta.Inflate;
-	cc_uint8 data[8];
-	cc_result res;
-
-	if ((res = Deflate_StreamClose(stream))) return res;
-	Stream_SetU32_LE(&data[0], state->Crc32 ^ 0xFFFFFFFFUL);
-	Stream_SetU32_LE(&data[4], state->Size);
-	return Stream_Write(state->Base.Dest, data, sizeof(data));
-}
-
 static cc_result GZip_StreamWrite(struct Stream* stream, const cc_uint8* data, cc_uint32 count, cc_uint32* modified) {
 	struct GZipState* state = (struct GZipState*)stream->Meta.Inflate;
-	cc_uint32 i, crc32 = state->Crc32;
 	state->Size += count;
 
-	/* TODO: Optimise this calculation */
-	for (i = 0; i < count; i++) {
-		crc32 = Utils_Crc32Table[(crc32 ^ data[i]) & 0xFF] ^ (crc32 >> 8);
-	}
-
-	state->Crc32 = crc32;
+	state->Crc32 = Utils_Crc32Update(state->Crc32, data, count);
 	return Deflate_StreamWrite(stream, data, count, modified);
 }
 
+static const cc_uint8 gzip_header[10] = { 0x1F, 0x8B, 0x08 }; /* GZip header */
 static cc_result GZip_StreamWriteFirst(struct Stream* stream, const cc_uint8* data, cc_uint32 count, cc_uint32* modified) {
-	static cc_uint8 header[10] = { 0x1F, 0x8B, 0x08 }; /* GZip header */
 	struct GZipState* state = (struct GZipState*)stream->Meta.Inflate;
 	cc_result res;
 
-	if ((res = Stream_Write(state->Base.Dest, header, sizeof(header)))) return res;
+	if ((res = Stream_Write(state->Base.Dest, gzip_header, sizeof(gzip_header)))) return res;
 	stream->Write = GZip_StreamWrite;
 	return GZip_StreamWrite(stream, data, count, modified);
 }
 
+static cc_result GZip_StreamClose(struct Stream* stream) {
+	struct GZipState* state = (struct GZipState*)stream->Meta.Inflate;
+	cc_uint8 data[8];
+	cc_result res;
+
+	/* Header is only written along with the first data, so an empty stream wouldn't have one */
+	if (stream->Write == GZip_StreamWriteFirst) {
+		if ((res = Stream_Write(state->Base.Dest, gzip_header, sizeof(gzip_header)))) return res;
+	}
+	if ((res = Deflate_StreamClose(stream))) return res;
+	Stream_SetU32_LE(&data[0], state->Crc32 ^ 0xFFFFFFFFUL);
+	Stream_SetU32_LE(&data[4], state->Size);
+	return Stream_Write(state->Base.Dest, data, sizeof(data));
+}
+
 void GZip_MakeStream(struct Stream* stream, struct GZipState* state, struct Stream* underlying) {
 	Deflate_MakeStream(stream, &state->Base, underlying);
 	state->Crc32  = 0xFFFFFFFFUL;
@@ -1079,42 +1675,115 @@ void GZip_MakeStream(struct Stream* stream, struct GZipState* state, struct Stre
 /*########################################################################################################################*
 *-----------------------------------------------------ZLib (compress)-----------------------------------------------------*
 *#########################################################################################################################*/
-static cc_result ZLib_StreamClose(struct Stream* stream) {
-	struct ZLibState* state = (struct ZLibState*)stream->Meta.Inflate;
-	cc_uint8 data[4];
-	cc_result res;
+#define ADLER32_BASE 65521
+/* Largest n such that 255n(n+1)/2 + (n+1)(BASE-1) fits in 32 bits */
+/*  i.e. how many bytes can be summed before s2 must be reduced modulo BASE */
+#define ADLER32_NMAX 5552
+
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#define CC_ADLER32_SSE2
+#include <emmintrin.h>
+
+/* Sums 16 byte blocks in parallel, returning the sum of s1 before each block */
+/* (i.e. s2 must be increased by 16 * returned value) */
+static cc_uint32 Adler32_BlocksSSE2(cc_uint32* s1, cc_uint32* s2, const cc_uint8* data, cc_uint32 blocks) {
+	const __m128i wHi  = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+	const __m128i wLo  = _mm_setr_epi16( 8,  7,  6,  5,  4,  3,  2, 1);
+	const __m128i zero = _mm_setzero_si128();
+	__m128i vs1 = zero, vs2 = zero, vPrev = zero, v;
+	cc_uint32 sums[4], prev;
+
+	for (; blocks; blocks--, data += 16) {
+		v     = _mm_loadu_si128((const __m128i*)data);
+		vPrev = _mm_add_epi32(vPrev, vs1);
+		/* psadbw against 0 gives the sum of each 8 bytes */
+		vs1   = _mm_add_epi32(vs1, _mm_sad_epu8(v, zero));
+		vs2   = _mm_add_epi32(vs2, _mm_madd_epi16(_mm_unpacklo_epi8(v, zero), wHi));
+		vs2   = _mm_add_epi32(vs2, _mm_madd_epi16(_mm_unpackhi_epi8(v, zero), wLo));
+	}
 
-	if ((res = Deflate_StreamClose(stream))) return res;	
-	Stream_SetU32_BE(&data[0], state->Adler32);
-	return Stream_Write(state->Base.Dest, data, sizeof(data));
+	_mm_storeu_si128((__m128i*)sums, vPrev);
+	prev = sums[0] + sums[2];
+	_mm_storeu_si128((__m128i*)sums, vs2);
+	*s2 += sums[0] + sums[1] + sums[2] + sums[3];
+	_mm_storeu_si128((__m128i*)sums, vs1);
+	*s1 += sums[0] + sums[2];
+	return prev;
 }
+#endif
 
-static cc_result ZLib_StreamWrite(struct Stream* stream, const cc_uint8* data, cc_uint32 count, cc_uint32* modified) {
-	struct ZLibState* state = (struct ZLibState*)stream->Meta.Inflate;
-	cc_uint32 i, adler32 = state->Adler32;
+/* Updates a running Adler32 checksum with the given data */
+static cc_uint32 Adler32_Update(cc_uint32 adler32, const cc_uint8* data, cc_uint32 count) {
 	cc_uint32 s1 = adler32 & 0xFFFF, s2 = (adler32 >> 16) & 0xFFFF;
+	cc_uint32 i, n;
+#ifdef CC_ADLER32_SSE2
+	cc_uint32 blocks, prev;
+#endif
+
+	/* Only need to reduce modulo BASE once every NMAX bytes */
+	while (count) {
+		n = min(count, ADLER32_NMAX);
+		count -= n;
+
+#ifdef CC_ADLER32_SSE2
+		blocks = n >> 4;
+		if (blocks) {
+			/* s1 is added to s2 once for each of the bytes */
+			s2  += s1 * (blocks << 4);
+			prev = Adler32_BlocksSSE2(&s1, &s2, data, blocks);
+			/* NOTE: NMAX guarantees the final s2 still fits in 32 bits */
+			s2  += prev << 4;
+			data += blocks << 4; n &= 15;
+		}
+#else
+		for (; n >= 8; n -= 8, data += 8) {
+			s1 += data[0]; s2 += s1; s1 += data[1]; s2 += s1;
+			s1 += data[2]; s2 += s1; s1 += data[3]; s2 += s1;
+			s1 += data[4]; s2 += s1; s1 += data[5]; s2 += s1;
+			s1 += data[6]; s2 += s1; s1 += data[7]; s2 += s1;
+		}
+#endif
+		for (i = 0; i < n; i++) {
+			s1 += data[i]; s2 += s1;
+		}
+		data += n;
 
-	/* TODO: Optimise this calculation */
-	for (i = 0; i < count; i++) {
-		#define ADLER32_BASE 65521
-		s1 = (s1 + data[i]) % ADLER32_BASE;
-		s2 = (s2 + s1)      % ADLER32_BASE;
+		s1 %= ADLER32_BASE;
+		s2 %= ADLER32_BASE;
 	}
+	return (s2 << 16) | s1;
+}
 
-	state->Adler32 = (s2 << 16) | s1;
+static cc_result ZLib_StreamWrite(struct Stream* stream, const cc_uint8* data, cc_uint32 count, cc_uint32* modified) {
+	struct ZLibState* state = (struct ZLibState*)stream->Meta.Inflate;
+	state->Adler32 = Adler32_Update(state->Adler32, data, count);
 	return Deflate_StreamWrite(stream, data, count, modified);
 }
 
+static const cc_uint8 zlib_header[2] = { 0x78, 0x9C }; /* ZLib header */
 static cc_result ZLib_StreamWriteFirst(struct Stream* stream, const cc_uint8* data, cc_uint32 count, cc_uint32* modified) {
-	static cc_uint8 header[2] = { 0x78, 0x9C }; /* ZLib header */
 	struct ZLibState* state = (struct ZLibState*)stream->Meta.Inflate;
 	cc_result res;
 
-	if ((res = Stream_Write(state->Base.Dest, header, sizeof(header)))) return res;
+	if ((res = Stream_Write(state->Base.Dest, zlib_header, sizeof(zlib_header)))) return res;
 	stream->Write = ZLib_StreamWrite;
 	return ZLib_StreamWrite(stream, data, count, modified);
 }
 
+static cc_result ZLib_StreamClose(struct Stream* stream) {
+	struct ZLibState* state = (struct ZLibState*)stream->Meta.Inflate;
+	cc_uint8 data[4];
+	cc_result res;
+
+	/* Header is only written along with the first data, so an empty stream wouldn't have one */
+	if (stream->Write == ZLib_StreamWriteFirst) {
+		if ((res = Stream_Write(state->Base.Dest, zlib_header, sizeof(zlib_header)))) return res;
+	}
+	if ((res = Deflate_StreamClose(stream))) return res;
+	Stream_SetU32_BE(&data[0], state->Adler32);
+	return Stream_Write(state->Base.Dest, data, sizeof(data));
+}
+
 void ZLib_MakeStream(struct Stream* stream, struct ZLibState* state, struct Stream* underlying) {
 	Deflate_MakeStream(stream, &state->Base, underlying);
 	state->Adler32 = 1;
@@ -1123,6 +1792,386 @@ void ZLib_MakeStream(struct Stream* stream, struct ZLibState* state, struct Stre
 }
 
 
+/*########################################################################################################################*
+*-------------------------------------------------Parallel GZip/ZLib (compress)-------------------------------------------*
+*#########################################################################################################################*/
+/* Combines CRC32 of two blocks of data into CRC32 of the two blocks joined together */
+/* Based off crc32_combine in zlib, which works by applying the CRC32 of len2 zero bytes to crc1 */
+static cc_uint32 Crc32_MatrixTimes(const cc_uint32* mat, cc_uint32 vec) {
+	cc_uint32 sum = 0;
+	for (; vec; vec >>= 1, mat++) {
+		if (vec & 1) sum ^= *mat;
+	}
+	return sum;
+}
+
+static void Crc32_MatrixSquare(cc_uint32* square, const cc_uint32* mat) {
+	int i;
+	for (i = 0; i < 32; i++) { square[i] = Crc32_MatrixTimes(mat, mat[i]); }
+}
+
+static cc_uint32 Crc32_Combine(cc_uint32 crc1, cc_uint32 crc2, cc_uint32 len2) {
+	cc_uint32 even[32], odd[32], row;
+	int i;
+	if (!len2) return crc1;
+
+	/* operator for one zero bit */
+	odd[0] = 0xEDB88320UL; row = 1;
+	for (i = 1; i < 32; i++) { odd[i] = row; row <<= 1; }
+
+	Crc32_MatrixSquare(even, odd); /* operator for two zero bits */
+	Crc32_MatrixSquare(odd, even); /* operator for four zero bits */
+
+	/* apply len2 zeroes to crc1 (first square puts operator for one zero byte in even) */
+	for (;;) {
+		Crc32_MatrixSquare(even, odd);
+		if (len2 & 1) crc1 = Crc32_MatrixTimes(even, crc1);
+		if (!(len2 >>= 1)) break;
+
+		Crc32_MatrixSquare(odd, even);
+		if (len2 & 1) crc1 = Crc32_MatrixTimes(odd, crc1);
+		if (!(len2 >>= 1)) break;
+	}
+	return crc1 ^ crc2;
+}
+
+/* Combines Adler32 of two blocks of data into Adler32 of the two blocks joined together */
+/* Based off adler32_combine in zlib */
+static cc_uint32 Adler32_Combine(cc_uint32 adler1, cc_uint32 adler2, cc_uint32 len2) {
+	cc_uint32 rem  = len2 % ADLER32_BASE;
+	cc_uint32 sum1 = adler1 & 0xFFFF;
+	cc_uint32 sum2 = (rem * sum1) % ADLER32_BASE;
+
+	sum1 += (adler2 & 0xFFFF) + ADLER32_BASE - 1;
+	sum2 += ((adler1 >> 16) & 0xFFFF) + ((adler2 >> 16) & 0xFFFF) + ADLER32_BASE - rem;
+	if (sum1 >= ADLER32_BASE) sum1 -= ADLER32_BASE;
+	if (sum1 >= ADLER32_BASE) sum1 -= ADLER32_BASE;
+	if (sum2 >= (ADLER32_BASE << 1)) sum2 -= (ADLER32_BASE << 1);
+	if (sum2 >= ADLER32_BASE) sum2 -= ADLER32_BASE;
+	return sum1 | (sum2 << 16);
+}
+
+#ifndef CC_BUILD_WEB
+#define DEFLATE_MAX_JOBS (DEFLATE_MAX_WORKERS * 2)
+/* Compressed output is usually smaller than input, but can be slightly larger (e.g. stored blocks) */
+#define DEFLATE_JOB_OUT_SIZE (DEFLATE_JOB_SIZE + 1024)
+enum DEFLATE_JOB_ { DEFLATE_JOB_FILLING, DEFLATE_JOB_QUEUED, DEFLATE_JOB_RUNNING, DEFLATE_JOB_DONE };
+
+struct DeflateJob {
+	cc_uint8* input;  /* DEFLATE_BLOCK_SIZE bytes of dictionary, followed by DEFLATE_JOB_SIZE bytes of data */
+	cc_uint32 dictLen, len;
+	cc_uint8* output;
+	cc_uint32 outLen, outCapacity;
+	cc_uint32 check;  /* CRC32 or Adler32 of the data */
+	cc_result res;
+	cc_uint8 status;
+	cc_bool final;
+};
+
+/* NOTE: Only one parallel stream can be active at once, since Thread_Start doesn't take an argument */
+static struct ParallelDeflate {
+	cc_bool active, gzip, wroteHeader, stopping;
+	struct Stream* dest;
+	cc_uint32 check, size;
+	cc_result res;
+	int numWorkers, numStarted, numJobs;
+	int submitted, written; /* Number of jobs submitted to worker threads, number of jobs written to dest */
+	void* mutex;
+	void* workWaitable; /* Signalled when a job is submitted */
+	void* doneWaitable; /* Signalled when a job is finished */
+	void* threads[DEFLATE_MAX_WORKERS];
+	struct DeflateState* states[DEFLATE_MAX_WORKERS];
+	struct DeflateJob jobs[DEFLATE_MAX_JOBS];
+} parallel;
+
+static cc_result DeflateJob_Write(struct Stream* s, const cc_uint8* data, cc_uint32 count, cc_uint32* modified) {
+	struct DeflateJob* job = (struct DeflateJob*)s->Meta.Inflate;
+	cc_uint32 capacity;
+	cc_uint8* output;
+
+	if (job->outLen + count > job->outCapacity) {
+		capacity = max(job->outLen + count, job->outCapacity * 2);
+		output   = (cc_uint8*)Mem_TryRealloc(job->output, capacity, 1);
+		if (!output) return ERR_OUT_OF_MEMORY;
+
+		job->output      = output;
+		job->outCapacity = capacity;
+	}
+
+	Mem_Copy(job->output + job->outLen, data, count);
+	job->outLen += count;
+	*modified    = count;
+	return 0;
+}
+
+/* Compresses the data of a job independently, except for preloading the dictionary */
+static cc_result DeflateJob_Run(struct DeflateJob* job, struct DeflateState* state) {
+	struct Stream compStream, dst;
+	cc_uint8* data = job->input + DEFLATE_BLOCK_SIZE;
+	cc_uint32 modified;
+	cc_result res;
+
+	job->check = parallel.gzip ? Utils_CRC32(data, job->len) : Adler32_Update(1, data, job->len);
+	job->outLen = 0;
+
+	Stream_Init(&dst);
+	dst.Write = DeflateJob_Write;
+	dst.Meta.Inflate = job;
+
+	Deflate_MakeStream(&compStream, state, &dst);
+	Deflate_SetDictionary(state, data - job->dictLen, job->dictLen);
+
+	if ((res = Deflate_StreamWrite(&compStream, data, job->len, &modified))) return res;
+	/* Output of all jobs but the last must end on a byte boundary, so they can be joined together */
+	return job->final ? Deflate_StreamClose(&compStream) : Deflate_SyncFlush(state);
+}
+
+static void Parallel_WorkerMain(void) {
+	struct DeflateState* state;
+	struct DeflateJob* job;
+	cc_bool stopping;
+	int i;
+
+	Mutex_Lock(parallel.mutex);
+	{
+		state = parallel.states[parallel.numStarted++];
+	}
+	Mutex_Unlock(parallel.mutex);
+
+	for (;;) {
+		job = NULL;
+		Mutex_Lock(parallel.mutex);
+		{
+			stopping = parallel.stopping;
+			for (i = parallel.written; i < parallel.submitted && !stopping; i++) {
+				if (parallel.jobs[i % parallel.numJobs].status != DEFLATE_JOB_QUEUED) continue;
+
+				job = &parallel.jobs[i % parallel.numJobs];
+				job->status = DEFLATE_JOB_RUNNING;
+				break;
+			}
+		}
+		Mutex_Unlock(parallel.mutex);
+
+		/* Multiple signals may have been combined into one, so wake up another worker too */
+		if (job || stopping) Waitable_Signal(parallel.workWaitable);
+		if (stopping) return;
+		if (!job) { Waitable_Wait(parallel.workWaitable); continue; }
+
+		job->res = DeflateJob_Run(job, state);
+		Mutex_Lock(parallel.mutex);
+		{
+			job->status = DEFLATE_JOB_DONE;
+		}
+		Mutex_Unlock(parallel.mutex);
+		Waitable_Signal(parallel.doneWaitable);
+	}
+}
+
+/* Waits for the oldest submitted job to finish, then writes out its compressed output */
+static cc_result Parallel_WriteOldest(void) {
+	struct DeflateJob* job = &parallel.jobs[parallel.written % parallel.numJobs];
+	cc_uint8 status;
+	cc_result res;
+
+	for (;;) {
+		Mutex_Lock(parallel.mutex);
+		{
+			status = job->status;
+		}
+		Mutex_Unlock(parallel.mutex);
+
+		if (status == DEFLATE_JOB_DONE) break;
+		Waitable_Wait(parallel.doneWaitable);
+	}
+
+	Mutex_Lock(parallel.mutex);
+	{
+		parallel.written++;
+	}
+	Mutex_Unlock(parallel.mutex);
+	if (job->res) return job->res;
+
+	if (!parallel.wroteHeader) {
+		parallel.wroteHeader = true;
+		res = parallel.gzip ? Stream_Write(parallel.dest, gzip_header, sizeof(gzip_header))
+							: Stream_Write(parallel.dest, zlib_header, sizeof(zlib_header));
+		if (res) return res;
+	}
+	if ((res = Stream_Write(parallel.dest, job->output, job->outLen))) return res;
+
+	parallel.check = parallel.gzip ? Crc32_Combine(parallel.check, job->check, job->len)
+								   : Adler32_Combine(parallel.check, job->check, job->len);
+	parallel.size += job->len;
+	return 0;
+}
+
+/* Submits the job currently being filled to the worker threads */
+static void Parallel_Submit(cc_bool final) {
+	struct DeflateJob* job = &parallel.jobs[parallel.submitted % parallel.numJobs];
+	job->final = final;
+
+	Mutex_Lock(parallel.mutex);
+	{
+		job->status = DEFLATE_JOB_QUEUED;
+		parallel.submitted++;
+	}
+	Mutex_Unlock(parallel.mutex);
+	Waitable_Signal(parallel.workWaitable);
+}
+
+/* Starts filling the next job, using the end of the previous job's data as its dictionary */
+static cc_result Parallel_BeginJob(void) {
+	struct DeflateJob* job;
+	struct DeflateJob* prev;
+	cc_result res;
+
+	/* Wait for a job to become free */
+	while (parallel.submitted - parallel.written >= parallel.numJobs) {
+		if ((res = Parallel_WriteOldest())) return res;
+	}
+
+	job = &parallel.jobs[parallel.submitted % parallel.numJobs];
+	job->len     = 0;
+	job->dictLen = 0;
+	job->status  = DEFLATE_JOB_FILLING;
+	if (!parallel.submitted) return 0;
+
+	prev = &parallel.jobs[(parallel.submitted - 1) % parallel.numJobs];
+	job->dictLen = min(prev->len, DEFLATE_BLOCK_SIZE);
+	Mem_Copy(job->input + DEFLATE_BLOCK_SIZE  - job->dictLen,
+			 prev->input + DEFLATE_BLOCK_SIZE + prev->len - job->dictLen, job->dictLen);
+	return 0;
+}
+
+static cc_result Parallel_StreamWrite(struct Stream* stream, const cc_uint8* data, cc_uint32 count, cc_uint32* modified) {
+	struct DeflateJob* job;
+	cc_uint32 len;
+	*modified = 0;
+	if (parallel.res) return parallel.res;
+
+	while (count > 0) {
+		job = &parallel.jobs[parallel.submitted % parallel.numJobs];
+		len = min(count, DEFLATE_JOB_SIZE - job->len);
+
+		Mem_Copy(job->input + DEFLATE_BLOCK_SIZE + job->len, data, len);
+		job->len  += len;
+		*modified += len;
+		data      += len;
+		count     -= len;
+		if (job->len < DEFLATE_JOB_SIZE) break;
+
+		Parallel_Submit(false);
+		if ((parallel.res = Parallel_BeginJob())) return parallel.res;
+	}
+	return 0;
+}
+
+/* Stops all the worker threads, then frees all the state */
+static void Parallel_Free(void) {
+	int i;
+	Mutex_Lock(parallel.mutex);
+	{
+		parallel.stopping = true;
+	}
+	Mutex_Unlock(parallel.mutex);
+	Waitable_Signal(parallel.workWaitable);
+
+	for (i = 0; i < parallel.numWorkers; i++) {
+		if (parallel.threads[i]) Thread_Join(parallel.threads[i]);
+	}
+	for (i = 0; i < parallel.numJobs; i++) {
+		Mem_Free(parallel.jobs[i].input);
+		Mem_Free(parallel.jobs[i].output);
+	}
+	for (i = 0; i < parallel.numWorkers; i++) {
+		Mem_Free(parallel.states[i]);
+	}
+
+	if (parallel.mutex)        Mutex_Free(parallel.mutex);
+	if (parallel.workWaitable) Waitable_Free(parallel.workWaitable);
+	if (parallel.doneWaitable) Waitable_Free(parallel.doneWaitable);
+	Mem_Set(&parallel, 0, sizeof(parallel));
+}
+
+static cc_result Parallel_StreamClose(struct Stream* stream) {
+	cc_uint8 data[8];
+	cc_result res = parallel.res;
+
+	if (!res) {
+		Parallel_Submit(true);
+		while (!res && parallel.written < parallel.submitted) {
+			res = Parallel_WriteOldest();
+		}
+	}
+
+	if (!res && parallel.gzip) {
+		Stream_SetU32_LE(&data[0], parallel.check);
+		Stream_SetU32_LE(&data[4], parallel.size);
+		res = Stream_Write(parallel.dest, data, 8);
+	} else if (!res) {
+		Stream_SetU32_BE(&data[0], parallel.check);
+		res = Stream_Write(parallel.dest, data, 4);
+	}
+
+	Parallel_Free();
+	return res;
+}
+
+static cc_result Parallel_MakeStream(struct Stream* stream, struct Stream* underlying, int numWorkers, cc_bool gzip) {
+	struct DeflateJob* job;
+	int i;
+	if (parallel.active) return ERR_NOT_SUPPORTED;
+
+	parallel.active     = true;
+	parallel.gzip       = gzip;
+	parallel.dest       = underlying;
+	parallel.check      = gzip ? 0 : 1;
+	parallel.numWorkers = max(1, min(numWorkers, DEFLATE_MAX_WORKERS));
+	parallel.numJobs    = parallel.numWorkers * 2;
+
+	for (i = 0; i < parallel.numJobs; i++) {
+		job = &parallel.jobs[i];
+		job->input  = (cc_uint8*)Mem_TryAlloc(DEFLATE_BLOCK_SIZE + DEFLATE_JOB_SIZE, 1);
+		job->output = (cc_uint8*)Mem_TryAlloc(DEFLATE_JOB_OUT_SIZE, 1);
+		job->outCapacity = DEFLATE_JOB_OUT_SIZE;
+		if (!job->input || !job->output) { Parallel_Free(); return ERR_OUT_OF_MEMORY; }
+	}
+	for (i = 0; i < parallel.numWorkers; i++) {
+		parallel.states[i] = (struct DeflateState*)Mem_TryAlloc(1, sizeof(struct DeflateState));
+		if (!parallel.states[i]) { Parallel_Free(); return ERR_OUT_OF_MEMORY; }
+	}
+
+	Stream_Init(stream);
+	stream->Meta.Inflate = &parallel;
+	stream->Write = Parallel_StreamWrite;
+	stream->Close = Parallel_StreamClose;
+
+	parallel.mutex        = Mutex_Create();
+	parallel.workWaitable = Waitable_Create();
+	parallel.doneWaitable = Waitable_Create();
+
+	for (i = 0; i < parallel.numWorkers; i++) {
+		parallel.threads[i] = Thread_Start(Parallel_WorkerMain);
+	}
+	return Parallel_BeginJob();
+}
+#else
+static cc_result Parallel_MakeStream(struct Stream* stream, struct Stream* underlying, int numWorkers, cc_bool gzip) {
+	/* Thread_Start isn't actually multithreaded in webclient */
+	return ERR_NOT_SUPPORTED;
+}
+#endif
+
+cc_result GZip_MakeParallelStream(struct Stream* stream, struct Stream* underlying, int numWorkers) {
+	return Parallel_MakeStream(stream, underlying, numWorkers, true);
+}
+
+cc_result ZLib_MakeParallelStream(struct Stream* stream, struct Stream* underlying, int numWorkers) {
+	return Parallel_MakeStream(stream, underlying, numWorkers, false);
+}
+
+
 /*########################################################################################################################*
 *--------------------------------------------------------ZipEntry---------------------------------------------------------*
 *#########################################################################################################################*/
@@ -1234,8 +2283,8 @@ void Zip_Init(struct ZipState* state, struct Stream* input) {
 	state->SelectEntry  = Zip_DefaultSelector;
 }
 
-cc_result Zip_Extract(struct ZipState* state) {
-	struct Stream* stream = state->input;
+/* Seeks to just after the signature of the end of central directory record */
+static cc_result Zip_SeekEndOfCentralDirectory(struct Stream* stream) {
 	cc_uint32 stream_len;
 	cc_uint32 sig = 0;
 	int i, count;
@@ -1250,10 +2299,18 @@ cc_result Zip_Extract(struct ZipState* state) {
 		if (res) return ZIP_ERR_SEEK_END_OF_CENTRAL_DIR;
 
 		if ((res = Stream_ReadU32_LE(stream, &sig))) return res;
-		if (sig == ZIP_SIG_ENDOFCENTRALDIR) break;
+		if (sig == ZIP_SIG_ENDOFCENTRALDIR) return 0;
 	}
+	return ZIP_ERR_NO_END_OF_CENTRAL_DIR;
+}
 
-	if (sig != ZIP_SIG_ENDOFCENTRALDIR) return ZIP_ERR_NO_END_OF_CENTRAL_DIR;
+cc_result Zip_Extract(struct ZipState* state) {
+	struct Stream* stream = state->input;
+	cc_uint32 sig = 0;
+	int i;
+
+	cc_result res;
+	if ((res = Zip_SeekEndOfCentralDirectory(stream))) return res;
 	res = Zip_ReadEndOfCentralDirectory(state);
 	if (res) return res;
 
@@ -1289,3 +2346,166 @@ cc_result Zip_Extract(struct ZipState* state) {
 	}
 	return 0;
 }
+
+
+/*########################################################################################################################*
+*--------------------------------------------------------ZipIndex---------------------------------------------------------*
+*#########################################################################################################################*/
+static cc_uint32 ZipIndex_Hash(const char* path, int len) {
+	cc_uint32 hash = 0;
+	int i;
+	for (i = 0; i < len; i++) { hash = hash * 31 + (cc_uint8)path[i]; }
+	return hash;
+}
+
+static cc_result ZipIndex_ReadCentralDirectory(struct ZipIndex* index, cc_uint32* pathsLen, cc_uint32 maxPathsLen) {
+	struct Stream* stream = index->input;
+	struct ZipIndexEntry* entry;
+	cc_uint8 header[42];
+	cc_uint32 bucket;
+	int pathLen, extraLen, commentLen;
+	cc_result res;
+	if ((res = Stream_Read(stream, header, sizeof(header)))) return res;
+
+	pathLen    = Stream_GetU16_LE(&header[24]);
+	extraLen   = Stream_GetU16_LE(&header[26]);
+	commentLen = Stream_GetU16_LE(&header[28]);
+	if (*pathsLen + pathLen > maxPathsLen) return ZIP_ERR_FILENAME_LEN;
+
+	/* NOTE: ZIP spec says path uses code page 437 for encoding */
+	if ((res = Stream_Read(stream, (cc_uint8*)&index->paths[*pathsLen], pathLen))) return res;
+	if ((res = stream->Skip(stream, extraLen + commentLen))) return res;
+
+	entry = &index->entries[index->count];
+	entry->Method                 = Stream_GetU16_LE(&header[6]);
+	entry->Base.CRC32             = Stream_GetU32_LE(&header[12]);
+	entry->Base.CompressedSize    = Stream_GetU32_LE(&header[16]);
+	entry->Base.UncompressedSize  = Stream_GetU32_LE(&header[20]);
+	entry->Base.LocalHeaderOffset = Stream_GetU32_LE(&header[38]);
+	entry->PathOffset = *pathsLen;
+	entry->PathLength = pathLen;
+
+	/* Stored entries are always the same size compressed and uncompressed */
+	if (!entry->Method) entry->Base.CompressedSize = entry->Base.UncompressedSize;
+	*pathsLen += pathLen;
+
+	/* Add entry to the hash table (using linear probing) */
+	bucket = ZipIndex_Hash(&index->paths[entry->PathOffset], pathLen) & index->bucketsMask;
+	while (index->buckets[bucket]) { bucket = (bucket + 1) & index->bucketsMask; }
+
+	index->count++;
+	index->buckets[bucket] = index->count;
+	return 0;
+}
+
+cc_result ZipIndex_Load(struct ZipIndex* index, struct Stream* input) {
+	struct Stream* stream = input;
+	cc_uint32 dirSize, dirBeg, pathsLen;
+	cc_uint8 header[18];
+	cc_uint32 sig = 0;
+	int i, count, numBuckets;
+	cc_result res;
+
+	Mem_Set(index, 0, sizeof(*index));
+	index->input = input;
+	if ((res = Zip_SeekEndOfCentralDirectory(stream))) return res;
+	if ((res = Stream_Read(stream, header, sizeof(header)))) return res;
+
+	count   = Stream_GetU16_LE(&header[6]);
+	dirSize = Stream_GetU32_LE(&header[8]);
+	dirBeg  = Stream_GetU32_LE(&header[12]);
+	for (numBuckets = 16; numBuckets < count * 2; numBuckets <<= 1) { }
+
+	/* Paths of entries are all stored in the central directory, so can't be longer than it */
+	index->entries = (struct ZipIndexEntry*)Mem_TryAlloc(count + 1, sizeof(struct ZipIndexEntry));
+	index->paths   = (char*)Mem_TryAlloc(dirSize + 1, 1);
+	index->buckets = (cc_uint16*)Mem_TryAllocCleared(numBuckets, sizeof(cc_uint16));
+	index->bucketsMask = numBuckets - 1;
+	if (!index->entries || !index->paths || !index->buckets) return ERR_OUT_OF_MEMORY;
+
+	res = stream->Seek(stream, dirBeg);
+	if (res) return ZIP_ERR_SEEK_CENTRAL_DIR;
+	pathsLen = 0;
+
+	for (i = 0; i < count; i++) {
+		if ((res = Stream_ReadU32_LE(stream, &sig))) return res;
+
+		if (sig == ZIP_SIG_CENTRALDIR) {
+			res = ZipIndex_ReadCentralDirectory(index, &pathsLen, dirSize);
+			if (res) return res;
+		} else if (sig == ZIP_SIG_ENDOFCENTRALDIR) {
+			break;
+		} else {
+			return ZIP_ERR_INVALID_CENTRAL_DIR;
+		}
+	}
+	return 0;
+}
+
+void ZipIndex_Free(struct ZipIndex* index) {
+	Mem_Free(index->entries);
+	Mem_Free(index->paths);
+	Mem_Free(index->buckets);
+
+	index->entries = NULL;
+	index->paths   = NULL;
+	index->buckets = NULL;
+	index->count   = 0;
+}
+
+cc_string ZipIndex_GetPath(struct ZipIndex* index, int i) {
+	struct ZipIndexEntry* entry = &index->entries[i];
+	return String_Init(index->paths + entry->PathOffset, entry->PathLength, entry->PathLength);
+}
+
+int ZipIndex_Find(struct ZipIndex* index, const cc_string* path) {
+	cc_uint32 bucket = ZipIndex_Hash(path->buffer, path->length) & index->bucketsMask;
+	cc_string entryPath;
+	int i;
+
+	/* Entries are stored in hash table as (index + 1), with 0 meaning empty */
+	for (; (i = index->buckets[bucket]); bucket = (bucket + 1) & index->bucketsMask) {
+		entryPath = ZipIndex_GetPath(index, i - 1);
+		if (String_Equals(&entryPath, path)) return i - 1;
+	}
+	return -1;
+}
+
+cc_result ZipIndex_ReadRaw(struct ZipIndex* index, int i, cc_uint8* data) {
+	struct Stream* stream = index->input;
+	struct ZipIndexEntry* entry = &index->entries[i];
+	cc_uint8 header[26];
+	int pathLen, extraLen;
+	cc_uint32 sig;
+	cc_result res;
+
+	res = stream->Seek(stream, entry->Base.LocalHeaderOffset);
+	if (res) return ZIP_ERR_SEEK_LOCAL_DIR;
+
+	if ((res = Stream_ReadU32_LE(stream, &sig))) return res;
+	if (sig != ZIP_SIG_LOCALFILEHEADER) return ZIP_ERR_INVALID_LOCAL_DIR;
+	if ((res = Stream_Read(stream, header, sizeof(header)))) return res;
+
+	/* local file may have extra data before actual data (e.g. ZIP64) */
+	pathLen  = Stream_GetU16_LE(&header[22]);
+	extraLen = Stream_GetU16_LE(&header[24]);
+	if ((res = stream->Skip(stream, pathLen + extraLen))) return res;
+
+	return Stream_Read(stream, data, entry->Base.CompressedSize);
+}
+
+cc_result ZipIndex_Decompress(const struct ZipIndexEntry* entry, cc_uint8* raw, cc_uint8* data) {
+	struct Stream src, compStream;
+	struct InflateState inflate;
+
+	if (entry->Method == 0) {
+		Mem_Copy(data, raw, entry->Base.UncompressedSize);
+		return 0;
+	} else if (entry->Method != 8) {
+		return ERR_NOT_SUPPORTED;
+	}
+
+	Stream_ReadonlyMemory(&src, raw, entry->Base.CompressedSize);
+	Inflate_MakeStream2(&compStream, &inflate, &src);
+	return Stream_Read(&compStream, data, entry->Base.UncompressedSize);
+}
@@ -27,7 +27,8 @@ cc_result ZLibHeader_Read(struct Stream* s, struct ZLibHeader* header);
 #define INFLATE_MAX_DISTS 32
 #define INFLATE_MAX_LITS_DISTS (INFLATE_MAX_LITS + INFLATE_MAX_DISTS)
 #define INFLATE_MAX_BITS 16
-#define INFLATE_FAST_BITS 9
+#define INFLATE_FAST_BITS 10
+#define INFLATE_FAST_MASK ((1 << INFLATE_FAST_BITS) - 1)
 #define INFLATE_WINDOW_SIZE 0x8000UL
 #define INFLATE_WINDOW_MASK 0x7FFFUL
 
@@ -42,7 +43,7 @@ struct HuffmanTable {
 struct InflateState {
 	cc_uint8 State;
 	cc_bool LastBlock; /* Whether the last DEFLATE block has been encounted in the stream */
-	cc_uint32 Bits;    /* Holds bits across byte boundaries */
+	cc_uintptr Bits;   /* Holds bits across byte boundaries (as many bits as fit in a native word) */
 	cc_uint32 NumBits; /* Number of bits in Bits buffer */
 
 	cc_uint8* NextIn;   /* Pointer within Input buffer to next byte that can be read */
@@ -63,6 +64,7 @@ struct InflateState {
 		struct HuffmanTable Lits;           /* Values represent literal or lengths */
 	} Table; /* union to save on memory */
 	struct HuffmanTable TableDists;         /* Values represent distances back */
+	cc_uint32 LitsFast[1 << INFLATE_FAST_BITS]; /* Combined literals/lengths lookup table, see Inflate_BuildLitsFast */
 	cc_uint8 Window[INFLATE_WINDOW_SIZE];    /* Holds circular buffer of recent output data, used for LZ77 */
 	cc_result result;
 };
@@ -81,8 +83,18 @@ CC_API void Inflate_MakeStream2(struct Stream* stream, struct InflateState* stat
 #define DEFLATE_BLOCK_SIZE  16384
 #define DEFLATE_BUFFER_SIZE 32768
 #define DEFLATE_OUT_SIZE 8192
-#define DEFLATE_HASH_SIZE 0x1000UL
-#define DEFLATE_HASH_MASK 0x0FFFUL
+#define DEFLATE_HASH_BITS 15
+#define DEFLATE_HASH_SIZE 0x8000UL
+#define DEFLATE_HASH_MASK 0x7FFFUL
+
+/* Compression levels, trading off compression speed for size of compressed output */
+enum DEFLATE_LEVEL_ {
+	DEFLATE_LEVEL_FAST,    /* Greedy matching, single fixed huffman block */
+	DEFLATE_LEVEL_DEFAULT, /* Lazy matching, dynamic huffman block per 16 KB of input */
+	DEFLATE_LEVEL_MAX,     /* Same as DEFAULT, but searches much further back for matches */
+	DEFLATE_LEVEL_LIGHT    /* Same as DEFAULT, but only briefly searches for matches */
+};
+
 struct DeflateState {
 	cc_uint32 Bits;         /* Holds bits across byte boundaries */
 	cc_uint32 NumBits;      /* Number of bits in Bits buffer */
@@ -97,10 +109,20 @@ struct DeflateState {
 	
 	cc_uint8 Input[DEFLATE_BUFFER_SIZE];
 	cc_uint8 Output[DEFLATE_OUT_SIZE];
-	int Head[DEFLATE_HASH_SIZE];
-	int Prev[DEFLATE_BUFFER_SIZE];
+	cc_uint16 Head[DEFLATE_HASH_SIZE];
+	cc_uint16 Prev[DEFLATE_BUFFER_SIZE];
 	cc_bool WroteHeader;
+	/* Compression level (see DEFLATE_LEVEL_ enum). Defaults to DEFLATE_LEVEL_DEFAULT. */
+	/* NOTE: Can only be changed before any data has been written to the stream. */
+	cc_uint8 Level;
+
+	cc_uint32 NumSyms;                      /* Number of symbols in current block */
+	cc_uint16 SymLits[DEFLATE_BLOCK_SIZE];  /* Literal value, or length of match */
+	cc_uint16 SymDists[DEFLATE_BLOCK_SIZE]; /* 0 for a literal, otherwise distance of match */
 };
+/* Initialises the lookup tables used by the DEFLATE compressor. */
+/* NOTE: Must be called once at startup, before any thread compresses data. */
+CC_API void Deflate_Init(void);
 /* Compresses input data using DEFLATE, then writes compressed output to another stream. Write only stream. */
 /* DEFLATE compression is pure compressed data, there is no header or footer. */
 CC_API void Deflate_MakeStream(struct Stream* stream, struct DeflateState* state, struct Stream* underlying);
@@ -115,6 +137,20 @@ struct ZLibState { struct DeflateState Base; cc_uint32 Adler32; };
 /* ZLIB compression is ZLIB header, followed by DEFLATE compressed data, followed by ZLIB footer. */
 CC_API void ZLib_MakeStream(struct Stream* stream, struct ZLibState* state, struct Stream* underlying);
 
+#define DEFLATE_JOB_SIZE (128 * 1024)
+#define DEFLATE_MAX_WORKERS 8
+/* Compresses input data using GZIP on multiple worker threads, then writes compressed output to another stream. Write only stream. */
+/* Input is split into DEFLATE_JOB_SIZE sized jobs that are compressed independently (except for using the end */
+/*  of the previous job's data as a dictionary), with the output of the jobs then being joined back together. */
+/* NOTE: Output is still a single valid GZIP stream, but is usually slightly larger than GZip_MakeStream's. */
+/* NOTE: If this returns an error (e.g. out of memory), use GZip_MakeStream instead. */
+/* NOTE: You MUST call Close on the stream, as that also stops the worker threads. */
+/* NOTE: Only one parallel compression stream can be in use at a time. */
+CC_API cc_result GZip_MakeParallelStream(struct Stream* stream, struct Stream* underlying, int numWorkers);
+/* Compresses input data using ZLIB on multiple worker threads, then writes compressed output to another stream. Write only stream. */
+/* NOTE: See the notes for GZip_MakeParallelStream. */
+CC_API cc_result ZLib_MakeParallelStream(struct Stream* stream, struct Stream* underlying, int numWorkers);
+
 /* Minimal data needed to describe an entry in a .zip archive. */
 struct ZipEntry { cc_uint32 CompressedSize, UncompressedSize, LocalHeaderOffset, CRC32; };
 #define ZIP_MAX_ENTRIES 1024
@@ -151,4 +187,41 @@ CC_API void Zip_Init(struct ZipState* state, struct Stream* input);
 /* Reads and processes the entries in a .zip archive. */
 /* NOTE: Must have been initialised with Zip_Init first. */
 CC_API cc_result Zip_Extract(struct ZipState* state);
+
+/* Data needed to describe an entry in a .zip archive index. */
+/* NOTE: For stored/uncompressed entries, Base.CompressedSize is always Base.UncompressedSize. */
+struct ZipIndexEntry { struct ZipEntry Base; cc_uint32 PathOffset; cc_uint16 PathLength, Method; };
+
+/* In-memory index of the entries in a .zip archive, allowing entries to be looked up and read in any order. */
+struct ZipIndex {
+	/* Source of the .zip archive data. Must be seekable. */
+	struct Stream* input;
+	/* Number of entries in the archive. */
+	int count;
+	/* Data for each entry in the archive. */
+	struct ZipIndexEntry* entries;
+	/* (internal) Paths of all the entries, stored one after another. */
+	char* paths;
+	/* (internal) Hash table of entries by path, where each bucket is (entry index + 1) */
+	cc_uint16* buckets;
+	int bucketsMask;
+};
+
+/* Reads the central directory of a .zip archive into an in-memory index. */
+/* NOTE: You MUST call ZipIndex_Free afterwards, even if this returns an error. */
+CC_API cc_result ZipIndex_Load(struct ZipIndex* index, struct Stream* input);
+/* Frees memory allocated by ZipIndex_Load. */
+CC_API void ZipIndex_Free(struct ZipIndex* index);
+/* Returns the full path of the i'th entry in the archive. */
+CC_API cc_string ZipIndex_GetPath(struct ZipIndex* index, int i);
+/* Returns the index of the entry with the given full path, or -1 if there is no such entry. */
+/* NOTE: Comparison is case sensitive. */
+CC_API int ZipIndex_Find(struct ZipIndex* index, const cc_string* path);
+/* Reads the raw (possibly compressed) data of the i'th entry into the given buffer. */
+/* NOTE: data must be at least entries[i].Base.CompressedSize bytes in size. */
+CC_API cc_result ZipIndex_ReadRaw(struct ZipIndex* index, int i, cc_uint8* data);
+/* Decompresses the raw data of an entry, as read by ZipIndex_ReadRaw, into the given buffer. */
+/* NOTE: data must be at least entry->Base.UncompressedSize bytes in size. */
+/* NOTE: Doesn't use the index's input stream, so can safely be called from other threads. */
+CC_API cc_result ZipIndex_Decompress(const struct ZipIndexEntry* entry, cc_uint8* raw, cc_uint8* data);
 #endif
@@ -489,15 +489,176 @@ static void PerformScheduledTasks(double time) {
 	}
 }
 
+#ifndef CC_BUILD_WEB
+/* Screenshots are encoded and saved on a background thread, so that filtering and */
+/*  compressing the PNG doesn't cause a hitch. Only reading back the pixels happens on the main thread */
+/* The queue is bounded, as each pending screenshot holds a copy of the whole backbuffer */
+#define SCREENSHOT_QUEUE_SIZE 4
+enum ScreenshotState { SCREENSHOT_FREE, SCREENSHOT_QUEUED, SCREENSHOT_DONE };
+
+static struct ScreenshotJob {
+	struct Bitmap bmp;
+	cc_string filename; char filenameBuffer[STRING_SIZE];
+	cc_string path;     char pathBuffer[FILENAME_SIZE];
+	const char* failedAction;
+	cc_result result;
+	int state;
+} screenshot_jobs[SCREENSHOT_QUEUE_SIZE];
+
+static struct ScreenshotSaver {
+	void* thread;
+	void* mutex;
+	void* workSignal;
+	void* doneSignal;
+	/* Jobs are queued (main thread), saved (saver thread) and reported (main thread) in the same order */
+	int queueIndex, saveIndex, reportIndex;
+	cc_bool stop;
+} screenshot_saver;
+
+static cc_result ScreenshotJob_Save(struct ScreenshotJob* job) {
+	struct Stream stream;
+	cc_result res;
+
+	res = Stream_CreateFile(&stream, &job->path);
+	if (res) { job->failedAction = "creating"; return res; }
+
+	res = Png_Encode(&job->bmp, &stream, NULL, false, PNG_ENCODE_FAST);
+	if (res) { job->failedAction = "saving to"; stream.Close(&stream); return res; }
+
+	res = stream.Close(&stream);
+	if (res) { job->failedAction = "closing"; }
+	return res;
+}
+
+static void ScreenshotSaver_Main(void) {
+	struct ScreenshotJob* job;
+
+	for (;;) {
+		Mutex_Lock(screenshot_saver.mutex);
+		for (;;) {
+			job = &screenshot_jobs[screenshot_saver.saveIndex];
+			if (job->state == SCREENSHOT_QUEUED) break;
+			/* Only stop once all the queued screenshots have been saved */
+			if (screenshot_saver.stop) { Mutex_Unlock(screenshot_saver.mutex); return; }
+
+			Mutex_Unlock(screenshot_saver.mutex);
+			Waitable_Wait(screenshot_saver.workSignal);
+			Mutex_Lock(screenshot_saver.mutex);
+		}
+		Mutex_Unlock(screenshot_saver.mutex);
+
+		job->result = ScreenshotJob_Save(job);
+		Mem_Free(job->bmp.scan0);
+		job->bmp.scan0 = NULL;
+
+		Mutex_Lock(screenshot_saver.mutex);
+		{
+			job->state = SCREENSHOT_DONE;
+			screenshot_saver.saveIndex = (screenshot_saver.saveIndex + 1) % SCREENSHOT_QUEUE_SIZE;
+		}
+		Mutex_Unlock(screenshot_saver.mutex);
+		Waitable_Signal(screenshot_saver.doneSignal);
+	}
+}
+
+static void ScreenshotSaver_Start(void) {
+	int i;
+	for (i = 0; i < SCREENSHOT_QUEUE_SIZE; i++) {
+		String_InitArray(screenshot_jobs[i].filename, screenshot_jobs[i].filenameBuffer);
+		String_InitArray(screenshot_jobs[i].path,     screenshot_jobs[i].pathBuffer);
+	}
+
+	screenshot_saver.mutex      = Mutex_Create();
+	screenshot_saver.workSignal = Waitable_Create();
+	screenshot_saver.doneSignal = Waitable_Create();
+	screenshot_saver.stop       = false;
+	screenshot_saver.thread     = Thread_Start(ScreenshotSaver_Main);
+}
+
+/* Waits for all queued screenshots to be saved, then stops the saver thread */
+static void ScreenshotSaver_Stop(void) {
+	if (!screenshot_saver.thread) return;
+
+	Mutex_Lock(screenshot_saver.mutex);
+	{
+		screenshot_saver.stop = true;
+	}
+	Mutex_Unlock(screenshot_saver.mutex);
+
+	Waitable_Signal(screenshot_saver.workSignal);
+	Thread_Join(screenshot_saver.thread);
+	screenshot_saver.thread = NULL;
+
+	Waitable_Free(screenshot_saver.workSignal);
+	Waitable_Free(screenshot_saver.doneSignal);
+	Mutex_Free(screenshot_saver.mutex);
+}
+
+/* Reports the results of screenshots that have finished being saved */
+static void Game_CheckScreenshots(void) {
+	struct ScreenshotJob* job;
+	int state;
+	if (!screenshot_saver.thread) return;
+
+	for (;;) {
+		job = &screenshot_jobs[screenshot_saver.reportIndex];
+		Mutex_Lock(screenshot_saver.mutex);
+		{
+			state = job->state;
+		}
+		Mutex_Unlock(screenshot_saver.mutex);
+		if (state != SCREENSHOT_DONE) return;
+
+		if (job->result) {
+			Logger_SysWarn2(job->result, job->failedAction, &job->path);
+		} else {
+			Chat_Add1("&eTaken screenshot as: %s", &job->filename);
+#ifdef CC_BUILD_MOBILE
+			Platform_ShareScreenshot(&job->filename);
+#endif
+		}
+
+		Mutex_Lock(screenshot_saver.mutex);
+		{
+			job->state = SCREENSHOT_FREE;
+		}
+		Mutex_Unlock(screenshot_saver.mutex);
+		screenshot_saver.reportIndex = (screenshot_saver.reportIndex + 1) % SCREENSHOT_QUEUE_SIZE;
+	}
+}
+
+/* Returns the next free job, waiting for the oldest screenshot to be saved if the queue is full */
+static struct ScreenshotJob* Game_NextScreenshotJob(void) {
+	struct ScreenshotJob* job;
+	int state;
+	if (!screenshot_saver.thread) ScreenshotSaver_Start();
+	job = &screenshot_jobs[screenshot_saver.queueIndex];
+
+	for (;;) {
+		Game_CheckScreenshots();
+		Mutex_Lock(screenshot_saver.mutex);
+		{
+			state = job->state;
+		}
+		Mutex_Unlock(screenshot_saver.mutex);
+
+		if (state == SCREENSHOT_FREE) return job;
+		Waitable_Wait(screenshot_saver.doneSignal);
+	}
+}
+#else
+static void Game_CheckScreenshots(void) { }
+static void ScreenshotSaver_Stop(void)  { }
+#endif
+
 void Game_TakeScreenshot(void) {
 	cc_string filename; char fileBuffer[STRING_SIZE];
-	cc_string path;     char pathBuffer[FILENAME_SIZE];
 	struct DateTime now;
-	cc_result res;
 #ifdef CC_BUILD_WEB
 	char str[NATIVE_STR_LEN];
 #else
-	struct Stream stream;
+	struct ScreenshotJob* job;
+	cc_result res;
 #endif
 	Game_ScreenshotRequested = false;
 	DateTime_CurrentLocal(&now);
@@ -512,24 +673,23 @@ void Game_TakeScreenshot(void) {
 	interop_TakeScreenshot(str);
 #else
 	if (!Utils_EnsureDirectory("screenshots")) return;
-	String_InitArray(path, pathBuffer);
-	String_Format1(&path, "screenshots/%s", &filename);
-
-	res = Stream_CreateFile(&stream, &path);
-	if (res) { Logger_SysWarn2(res, "creating", &path); return; }
+	job = Game_NextScreenshotJob();
 
-	res = Gfx_TakeScreenshot(&stream);
-	if (res) { 
-		Logger_SysWarn2(res, "saving to", &path); stream.Close(&stream); return;
-	}
+	job->filename.length = 0;
+	String_AppendString(&job->filename, &filename);
+	job->path.length = 0;
+	String_Format1(&job->path, "screenshots/%s", &filename);
 
-	res = stream.Close(&stream);
-	if (res) { Logger_SysWarn2(res, "closing", &path); return; }
-	Chat_Add1("&eTaken screenshot as: %s", &filename);
+	res = Gfx_TakeScreenshot(&job->bmp);
+	if (res) { Logger_SysWarn2(res, "saving to", &job->path); return; }
 
-#ifdef CC_BUILD_MOBILE
-	Platform_ShareScreenshot(&filename);
-#endif
+	Mutex_Lock(screenshot_saver.mutex);
+	{
+		job->state = SCREENSHOT_QUEUED;
+	}
+	Mutex_Unlock(screenshot_saver.mutex);
+	Waitable_Signal(screenshot_saver.workSignal);
+	screenshot_saver.queueIndex = (screenshot_saver.queueIndex + 1) % SCREENSHOT_QUEUE_SIZE;
 #endif
 }
 
@@ -564,6 +724,7 @@ static void Game_RenderFrame(double delta) {
 	}
 
 	PerformScheduledTasks(delta);
+	TexturePack_ApplyExtracted();
 	entTask = tasks[entTaskI];
 	t = (float)(entTask.accumulator / entTask.interval);
 	LocalPlayer_SetInterpPosition(t);
@@ -586,11 +747,14 @@ static void Game_RenderFrame(double delta) {
 	Gfx_End2D();
 
 	if (Game_ScreenshotRequested) Game_TakeScreenshot();
+	Game_CheckScreenshots();
 	Gfx_EndFrame();
 }
 
 void Game_Free(void* obj) {
 	struct IGameComponent* comp;
+	/* Make sure screenshots still being encoded are written out */
+	ScreenshotSaver_Stop();
 	/* Most components will call OnContextLost in their Free functions */
 	/* Set to false so components will always free managed textures too */
 	Gfx.ManagedTextures = false;
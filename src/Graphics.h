@@ -191,8 +191,9 @@ void Gfx_CalcOrthoMatrix(float width, float height, struct Matrix* matrix);
 /* Calculates a projection matrix suitable with this backend. (usually for 3D) */
 void Gfx_CalcPerspectiveMatrix(float fov, float aspect, float zFar, struct Matrix* matrix);
 
-/* Outputs a .png screenshot of the backbuffer. */
-cc_result Gfx_TakeScreenshot(struct Stream* output);
+/* Reads the contents of the backbuffer into a newly allocated bitmap. (rows top to bottom) */
+/* NOTE: Alpha of the pixels is undefined. Caller must Mem_Free bmp->scan0 when done. */
+cc_result Gfx_TakeScreenshot(struct Bitmap* bmp);
 /* Warns in chat if the backend has problems with the user's GPU. */
 /* Returns whether legacy rendering mode for borders/sky/clouds is needed. */
 cc_bool Gfx_WarnIfNecessary(void);
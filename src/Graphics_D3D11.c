@@ -719,21 +719,11 @@ void Gfx_SetColWriteMask(cc_bool r, cc_bool g, cc_bool b, cc_bool a) {
 /*########################################################################################################################*
 *-----------------------------------------------------------Misc----------------------------------------------------------*
 *#########################################################################################################################*/
-static BitmapCol* D3D11_GetRow(struct Bitmap* bmp, int y) {
-	// You were expecting a BitmapCol*, but it was me, D3D11_MAPPED_SUBRESOURCE*!
-	//  This is necessary because the stride of the mapped backbuffer often doesn't equal width of the bitmap
-	//    e.g. with backbuffer width of 854, stride is 3456 bytes instead of expected 3416 (854*4)
-	//  Therefore have to calculate row address manually instead of using Bitmap_GetRow
-	D3D11_MAPPED_SUBRESOURCE* buffer = (D3D11_MAPPED_SUBRESOURCE*)bmp->scan0;
-
-	char* row = (char*)buffer->pData + y * buffer->RowPitch;
-	return (BitmapCol*)row;
-}
-
-cc_result Gfx_TakeScreenshot(struct Stream* output) {
-	ID3D11Texture2D* tmp;
-	struct Bitmap bmp;
+cc_result Gfx_TakeScreenshot(struct Bitmap* bmp) {
+	ID3D11Texture2D* tmp = NULL;
 	HRESULT hr;
+	int y;
+	bmp->scan0 = NULL;
 
 	ID3D11Resource* backbuffer_res;
 	D3D11_RENDER_TARGET_VIEW_DESC backbuffer_desc;
@@ -758,8 +748,14 @@ cc_result Gfx_TakeScreenshot(struct Stream* output) {
 	hr = ID3D11DeviceContext_Map(context, tmp, 0, D3D11_MAP_READ, 0, &buffer);
 	if (hr) goto finished;
 	{
-		Bitmap_Init(bmp, desc.Width, desc.Height, (BitmapCol*)&buffer);
-		hr = Png_Encode(&bmp, output, D3D11_GetRow, false);
+		Bitmap_TryAllocate(bmp, desc.Width, desc.Height);
+		if (!bmp->scan0) hr = ERR_OUT_OF_MEMORY;
+
+		// The stride of the mapped backbuffer often doesn't equal width of the bitmap
+		//   e.g. with backbuffer width of 854, stride is 3456 bytes instead of expected 3416 (854*4)
+		for (y = 0; bmp->scan0 && y < bmp->height; y++) {
+			Mem_Copy(Bitmap_GetRow(bmp, y), (char*)buffer.pData + y * buffer.RowPitch, bmp->width * 4);
+		}
 	}
 	ID3D11DeviceContext_Unmap(context, tmp, 0);
 
@@ -795,4 +791,4 @@ void Gfx_OnWindowResize(void) {
 	OM_InitTargets();
 	RS_UpdateViewport();
 }
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
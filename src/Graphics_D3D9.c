@@ -742,13 +742,14 @@ void Gfx_CalcPerspectiveMatrix(float fov, float aspect, float zFar, struct Matri
 /*########################################################################################################################*
 *-----------------------------------------------------------Misc----------------------------------------------------------*
 *#########################################################################################################################*/
-cc_result Gfx_TakeScreenshot(struct Stream* output) {
+cc_result Gfx_TakeScreenshot(struct Bitmap* bmp) {
 	IDirect3DSurface9* backbuffer = NULL;
 	IDirect3DSurface9* temp = NULL;
 	D3DSURFACE_DESC desc;
 	D3DLOCKED_RECT rect;
-	struct Bitmap bmp;
 	cc_result res;
+	int y;
+	bmp->scan0 = NULL;
 
 	res = IDirect3DDevice9_GetBackBuffer(device, 0, 0, D3DBACKBUFFER_TYPE_MONO, &backbuffer);
 	if (res) goto finished;
@@ -763,9 +764,13 @@ cc_result Gfx_TakeScreenshot(struct Stream* output) {
 	res = IDirect3DSurface9_LockRect(temp, &rect, NULL, D3DLOCK_READONLY | D3DLOCK_NO_DIRTY_UPDATE);
 	if (res) goto finished;
 	{
-		Bitmap_Init(bmp, desc.Width, desc.Height, (BitmapCol*)rect.pBits);
-		res = Png_Encode(&bmp, output, NULL, false);
-		if (res) { IDirect3DSurface9_UnlockRect(temp); goto finished; }
+		Bitmap_TryAllocate(bmp, desc.Width, desc.Height);
+		if (!bmp->scan0) { IDirect3DSurface9_UnlockRect(temp); res = ERR_OUT_OF_MEMORY; goto finished; }
+
+		/* Pitch of the locked surface might not be the same as the width of the bitmap */
+		for (y = 0; y < bmp->height; y++) {
+			Mem_Copy(Bitmap_GetRow(bmp, y), (cc_uint8*)rect.pBits + y * rect.Pitch, bmp->width * 4);
+		}
 	}
 	res = IDirect3DSurface9_UnlockRect(temp);
 	if (res) goto finished;
@@ -773,6 +778,7 @@ cc_result Gfx_TakeScreenshot(struct Stream* output) {
 finished:
 	D3D9_FreeResource(&backbuffer);
 	D3D9_FreeResource(&temp);
+	if (res) { Mem_Free(bmp->scan0); bmp->scan0 = NULL; }
 	return res;
 }
 
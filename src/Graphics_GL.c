@@ -436,26 +436,33 @@ void Gfx_SetDynamicVbData(GfxResourceID vb, void* vertices, int vCount) {
 /*########################################################################################################################*
 *-----------------------------------------------------------Misc----------------------------------------------------------*
 *#########################################################################################################################*/
-static BitmapCol* GL_GetRow(struct Bitmap* bmp, int y) { 
-	/* OpenGL stores bitmap in bottom-up order, so flip order when saving */
-	return Bitmap_GetRow(bmp, (bmp->height - 1) - y); 
+static void GL_FlipRows(struct Bitmap* bmp) {
+	BitmapCol* top;
+	BitmapCol* bottom;
+	BitmapCol tmp;
+	int x, y;
+
+	for (y = 0; y < bmp->height / 2; y++) {
+		top    = Bitmap_GetRow(bmp, y);
+		bottom = Bitmap_GetRow(bmp, (bmp->height - 1) - y);
+
+		for (x = 0; x < bmp->width; x++) {
+			tmp = top[x]; top[x] = bottom[x]; bottom[x] = tmp;
+		}
+	}
 }
-cc_result Gfx_TakeScreenshot(struct Stream* output) {
-	struct Bitmap bmp;
-	cc_result res;
+
+cc_result Gfx_TakeScreenshot(struct Bitmap* bmp) {
 	GLint vp[4];
 	
 	glGetIntegerv(GL_VIEWPORT, vp); /* { x, y, width, height } */
-	bmp.width  = vp[2]; 
-	bmp.height = vp[3];
-
-	bmp.scan0  = (BitmapCol*)Mem_TryAlloc(bmp.width * bmp.height, 4);
-	if (!bmp.scan0) return ERR_OUT_OF_MEMORY;
-	glReadPixels(0, 0, bmp.width, bmp.height, PIXEL_FORMAT, TRANSFER_FORMAT, bmp.scan0);
+	Bitmap_TryAllocate(bmp, vp[2], vp[3]);
+	if (!bmp->scan0) return ERR_OUT_OF_MEMORY;
+	glReadPixels(0, 0, bmp->width, bmp->height, PIXEL_FORMAT, TRANSFER_FORMAT, bmp->scan0);
 
-	res = Png_Encode(&bmp, output, GL_GetRow, false);
-	Mem_Free(bmp.scan0);
-	return res;
+	/* OpenGL stores bitmap in bottom-up order */
+	GL_FlipRows(bmp);
+	return 0;
 }
 
 static void AppendVRAMStats(cc_string* info) {
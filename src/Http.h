@@ -19,6 +19,21 @@ enum HttpProgress {
 	HTTP_PROGRESS_MAKING_REQUEST = -2,
 	HTTP_PROGRESS_FETCHING_DATA  = -1
 };
+/* Queued requests with higher priority are started first. */
+/* Requests with the same priority are started in the order they were queued. */
+enum HttpPriority { HTTP_PRIORITY_LOW, HTTP_PRIORITY_NORMAL, HTTP_PRIORITY_HIGH };
+
+struct HttpRequest;
+/* Receives the data of a response as it is downloaded, instead of it being buffered in memory. */
+/* (e.g. to write a large download straight to disk) */
+struct HttpConsumer {
+	/* Called on a http worker thread with each chunk of data of a 200 response. */
+	cc_result (*Write)(struct HttpConsumer* c, struct HttpRequest* req, const cc_uint8* data, cc_uint32 len);
+	/* Called once the request has finished, or when it is cancelled before it was started. */
+	/* The returned error (if any) is used as the result of the request. Typically frees the consumer. */
+	/* NOTE: May be called on a http worker thread, or on the thread that cancelled the request. */
+	cc_result (*Finish)(struct HttpConsumer* c, struct HttpRequest* req);
+};
 
 struct HttpRequest {
 	char url[URL_MAX_SIZE]; /* URL data is downloaded from/uploaded to. */
@@ -37,15 +52,24 @@ struct HttpRequest {
 	char lastModified[STRING_SIZE]; /* Time item cached at (if at all) */
 	char etag[STRING_SIZE];         /* ETag of cached item (if any) */
 	cc_uint8 requestType;           /* See the various REQUEST_TYPE_ */
+	cc_uint8 priority;              /* See the various HTTP_PRIORITY_ */
+	cc_bool diskCache;              /* Whether response is stored in and revalidated against the disk cache */
+	struct HttpConsumer* consumer;  /* Receives contents of the response, if not NULL. */
 	cc_bool success;                /* Whether Result is 0, status is 200, and data is not NULL */
 	struct StringsBuffer* cookies;  /* Cookie list sent in requests. May be modified by the response. */
 };
 
 /* Aschronously performs a http GET request to download a skin. */
 /* If url is a skin, downloads from there. (if not, downloads from SKIN_SERVER/[skinName].png) */
+/* NOTE: Skins are downloaded with HTTP_PRIORITY_LOW, other requests use HTTP_PRIORITY_NORMAL, */
+/*  or HTTP_PRIORITY_HIGH if 'priority' is true. (e.g. texture packs) */
 int Http_AsyncGetSkin(const cc_string* skinName);
 /* Asynchronously performs a http GET request. (e.g. to download data) */
 int Http_AsyncGetData(const cc_string* url, cc_bool priority);
+/* Asynchronously performs a http GET request, also storing the response in the disk cache. */
+/* If the URL was cached before, the request is conditional and the cached data is used when unchanged. */
+/* NOTE: Skins are always requested this way. */
+int Http_AsyncGetCachedData(const cc_string* url, cc_bool priority);
 /* Asynchronously performs a http HEAD request. (e.g. to get Content-Length header) */
 int Http_AsyncGetHeaders(const cc_string* url, cc_bool priority);
 /* Asynchronously performs a http POST request. (e.g. to submit data) */
@@ -54,6 +78,10 @@ int Http_AsyncPostData(const cc_string* url, cc_bool priority, const void* data,
 /* Asynchronously performs a http GET request. (e.g. to download data) */
 /* Also sets the If-Modified-Since and If-None-Match headers. (if not NULL)  */
 int Http_AsyncGetDataEx(const cc_string* url, cc_bool priority, const cc_string* lastModified, const cc_string* etag, struct StringsBuffer* cookies);
+/* Asynchronously performs a http GET request, passing the response data to the given consumer as it is downloaded. */
+/* If the consumer received the data, then data is NULL and size is the total size in the result. */
+/* NOTE: Some backends don't support this, so the data may still be buffered and returned as normal. */
+int Http_AsyncGetDataStreamed(const cc_string* url, cc_bool priority, const cc_string* lastModified, const cc_string* etag, struct HttpConsumer* consumer);
 /* Attempts to remove given request from pending and finished request lists. */
 /* NOTE: Won't cancel the request if it is currently in progress. */
 void Http_TryCancel(int reqID);
@@ -67,9 +95,11 @@ cc_bool Http_DescribeError(cc_result res, cc_string* dst);
 
 /* Attempts to retrieve a fully completed request. */
 /* NOTE: You MUST check Success for whether it completed successfully. */
+/* NOTE: Data is NULL even on success, if the data was passed to a HttpConsumer instead. */
 /* (Data may still be non NULL even on error, e.g. on a http 404 error) */
 cc_bool Http_GetResult(int reqID, struct HttpRequest* item);
-/* Retrieves information about the request currently being processed. */
+/* Retrieves information about a request currently being processed. */
+/* NOTE: Several requests may be processed at once, in which case the earliest started is returned. */
 cc_bool Http_GetCurrent(int* reqID, int* progress);
 /* Retrieves information about the download progress of the given request. */
 /* NOTE: This may return HTTP_PROGRESS_NOT_WORKING_ON if download has finished. */
@@ -53,21 +53,26 @@ cc_bool Http_DescribeError(cc_result res, cc_string* dst) { return false; }
 static void Http_StartNextDownload(void) {
 	char urlBuffer[URL_MAX_SIZE]; cc_string url;
 	char urlStr[NATIVE_STR_LEN];
+	struct HttpRequest* active[HTTP_MAX_CONCURRENCY];
 	struct HttpRequest* req;
+	int i;
 
 	/* Avoid making too many requests at once */
 	if (workingReqs.count >= HTTP_MAX_CONCURRENCY) return;
 	if (!queuedReqs.count) return;
 	String_InitArray(url, urlBuffer);
 
-	req = &queuedReqs.entries[0];
+	/* Browser already limits connections per host, so only the priority order matters here */
+	for (i = 0; i < workingReqs.count; i++) { active[i] = &workingReqs.entries[i]; }
+	i   = RequestList_NextRunnable(&queuedReqs, active, workingReqs.count, HTTP_MAX_CONCURRENCY);
+	req = &queuedReqs.entries[i];
 	Http_GetUrl(req, &url);
 	Platform_Log1("Fetching %s", &url);
 
 	Platform_EncodeUtf8(urlStr, &url);
 	interop_DownloadAsync(urlStr, req->requestType, req->id);
-	RequestList_Append(&workingReqs, req, false);
-	RequestList_RemoveAt(&queuedReqs, 0);
+	RequestList_Append(&workingReqs, req);
+	RequestList_RemoveAt(&queuedReqs, i);
 }
 
 EMSCRIPTEN_KEEPALIVE void Http_OnUpdateProgress(int reqID, int read, int total) {
@@ -96,6 +101,8 @@ EMSCRIPTEN_KEEPALIVE void Http_OnFinishedAsync(int reqID, void* data, int len, i
 		if (!status && !data) req->result = ERR_DOWNLOAD_INVALID;
 
 		if (req->data) Platform_Log1("HTTP returned data: %i bytes", &req->size);
+		/* Data is always returned all at once, so just give it to the caller as normal */
+		HttpRequest_FinishConsumer(req);
 		Http_FinishRequest(req);
 		RequestList_RemoveAt(&workingReqs, idx);
 	}
@@ -103,8 +110,8 @@ EMSCRIPTEN_KEEPALIVE void Http_OnFinishedAsync(int reqID, void* data, int len, i
 }
 
 /* Adds a req to the list of pending requests, waking up worker thread if needed */
-static void HttpBackend_Add(struct HttpRequest* req, cc_bool priority) {
-	RequestList_Append(&queuedReqs, req, priority);
+static void HttpBackend_Add(struct HttpRequest* req) {
+	RequestList_Enqueue(&queuedReqs, req);
 	Http_StartNextDownload();
 }
 
@@ -1,19 +1,44 @@
 #include "Core.h"
 #ifndef CC_BUILD_WEB
 #include "_HttpBase.h"
+#include "Errors.h"
 static void* workerWaitable;
-static void* workerThread;
 static void* pendingMutex;
 static struct RequestList pendingReqs;
 
-static void* curRequestMutex;
-static struct HttpRequest http_curRequest;
-static volatile int http_curProgress = HTTP_PROGRESS_NOT_WORKING_ON;
+#if defined CC_BUILD_ANDROID
+/* Java side of the backend only supports one request at a time */
+#define HTTP_MAX_WORKERS 1
+#else
+#define HTTP_MAX_WORKERS 8
+#endif
+#define HTTP_DEF_WORKERS 4
+#define HTTP_DEF_HOST_LIMIT 2
+
+/* Thread that downloads requests from the shared pending list */
+struct HttpWorker {
+	struct HttpRequest request; /* Request being processed. NOTE: Must be first, see Http_WorkerOf */
+	volatile int progress;      /* Progress of request being processed, see HTTP_PROGRESS_ */
+	cc_bool busy;               /* Whether request is being processed */
+	void* thread;
+	cc_uint32 streamed;         /* Number of bytes of data passed to the request's consumer */
+	cc_result streamRes;        /* First error returned by the request's consumer */
+};
+static struct HttpWorker http_workers[HTTP_MAX_WORKERS];
+static int http_workersCount, http_workersStarted, http_hostLimit;
+/* Only requests being processed by workers are passed to HttpBackend_Do */
+#define Http_WorkerOf(req) ((struct HttpWorker*)(req))
+/* Whether response data is passed to the request's consumer instead of being buffered */
+#define Http_IsStreaming(req) ((req)->consumer && (req)->statusCode == 200)
+#define HTTP_STREAM_BUFFER_SIZE (64 * 1024)
 
 /* Allocates initial data buffer to store response contents */
 static void Http_BufferInit(struct HttpRequest* req) {
-	http_curProgress = 0;
+	Http_WorkerOf(req)->progress = 0;
 	req->_capacity = req->contentLength ? req->contentLength : 1;
+	/* Buffer only needs to hold one chunk at a time when streaming */
+	if (Http_IsStreaming(req)) req->_capacity = min(req->_capacity, HTTP_STREAM_BUFFER_SIZE);
+
 	req->data      = (cc_uint8*)Mem_Alloc(req->_capacity, 1, "http data");
 	req->size      = 0;
 }
@@ -27,10 +52,38 @@ static void Http_BufferEnsure(struct HttpRequest* req, cc_uint32 amount) {
 	req->data      = (cc_uint8*)Mem_Realloc(req->data, newSize, 1, "http data+");
 }
 
+/* Passes the buffered data to the request's consumer, then empties the buffer */
+static void Http_StreamData(struct HttpRequest* req) {
+	struct HttpWorker* w = Http_WorkerOf(req);
+	/* Keep downloading after an error, but don't pass any more data to the consumer */
+	if (!w->streamRes) w->streamRes = req->consumer->Write(req->consumer, req, req->data, req->size);
+
+	w->streamed += req->size;
+	req->size    = 0;
+}
+
 /* Increases size and updates current progress */
 static void Http_BufferExpanded(struct HttpRequest* req, cc_uint32 read) {
+	struct HttpWorker* w = Http_WorkerOf(req);
 	req->size += read;
-	if (req->contentLength) http_curProgress = (int)(100.0f * req->size / req->contentLength);
+	if (req->contentLength) w->progress = (int)(100.0f * (w->streamed + req->size) / req->contentLength);
+	if (Http_IsStreaming(req)) Http_StreamData(req);
+}
+
+/* Updates state after all the data of a request has been downloaded */
+static void Http_EndStreaming(struct HttpRequest* req) {
+	struct HttpWorker* w = Http_WorkerOf(req);
+	/* Some backends only know the status code after all the data has been downloaded */
+	if (Http_IsStreaming(req) && req->size) Http_StreamData(req);
+
+	if (w->streamed) {
+		Mem_Free(req->data);
+		req->data = NULL;
+		req->size = w->streamed;
+	}
+
+	if (!req->result) req->result = w->streamRes;
+	HttpRequest_FinishConsumer(req);
 }
 
 
@@ -41,13 +94,6 @@ static void Http_BufferExpanded(struct HttpRequest* req, cc_uint32 read) {
 static void Http_BeginRequest(struct HttpRequest* req, cc_string* url) {
 	Http_GetUrl(req, url);
 	Platform_Log2("Fetching %s (type %b)", url, &req->requestType);
-
-	Mutex_Lock(curRequestMutex);
-	{
-		http_curRequest  = *req;
-		http_curProgress = HTTP_PROGRESS_MAKING_REQUEST;
-	}
-	Mutex_Unlock(curRequestMutex);
 }
 
 static void Http_ParseCookie(struct HttpRequest* req, const cc_string* value) {
@@ -120,10 +166,10 @@ static void Http_SetRequestHeaders(struct HttpRequest* req) {
 static void Http_SignalWorker(void) { Waitable_Signal(workerWaitable); }
 
 /* Adds a req to the list of pending requests, waking up worker thread if needed */
-static void HttpBackend_Add(struct HttpRequest* req, cc_bool priority) {
+static void HttpBackend_Add(struct HttpRequest* req) {
 	Mutex_Lock(pendingMutex);
 	{	
-		RequestList_Append(&pendingReqs, req, priority);
+		RequestList_Enqueue(&pendingReqs, req);
 	}
 	Mutex_Unlock(pendingMutex);
 	Http_SignalWorker();
@@ -146,20 +192,36 @@ cc_bool Http_GetResult(int reqID, struct HttpRequest* item) {
 }
 
 cc_bool Http_GetCurrent(int* reqID, int* progress) {
-	Mutex_Lock(curRequestMutex);
+	struct HttpWorker* w;
+	int i;
+	*reqID    = 0;
+	*progress = HTTP_PROGRESS_NOT_WORKING_ON;
+
+	Mutex_Lock(pendingMutex);
 	{
-		*reqID    = http_curRequest.id;
-		*progress = http_curProgress;
+		for (i = 0; i < http_workersCount; i++) {
+			w = &http_workers[i];
+			if (!w->busy || (*reqID && w->request.id > *reqID)) continue;
+
+			*reqID    = w->request.id;
+			*progress = w->progress;
+		}
 	}
-	Mutex_Unlock(curRequestMutex);
+	Mutex_Unlock(pendingMutex);
 	return *reqID != 0;
 }
 
 int Http_CheckProgress(int reqID) {
-	int curReqID, progress;
-	Http_GetCurrent(&curReqID, &progress);
+	int i, progress = HTTP_PROGRESS_NOT_WORKING_ON;
 
-	if (reqID != curReqID) progress = HTTP_PROGRESS_NOT_WORKING_ON;
+	Mutex_Lock(pendingMutex);
+	{
+		for (i = 0; i < http_workersCount; i++) {
+			if (!http_workers[i].busy || http_workers[i].request.id != reqID) continue;
+			progress = http_workers[i].progress;
+		}
+	}
+	Mutex_Unlock(pendingMutex);
 	return progress;
 }
 
@@ -194,6 +256,7 @@ void Http_TryCancel(int reqID) {
 #include <stddef.h>
 /* === BEGIN CURL HEADERS === */
 typedef void CURL;
+typedef void CURLSH;
 struct curl_slist;
 typedef int CURLcode;
 
@@ -215,6 +278,20 @@ typedef int CURLcode;
 #define CURLOPT_MAXREDIRS      (0     + 68)
 #define CURLOPT_HEADERFUNCTION (20000 + 79)
 #define CURLOPT_HTTPGET        (0     + 80)
+#define CURLOPT_SHARE          (10000 + 100)
+
+#define CURLSHOPT_SHARE      1
+#define CURLSHOPT_LOCKFUNC   3
+#define CURLSHOPT_UNLOCKFUNC 4
+#define CURL_LOCK_DATA_DNS         3
+#define CURL_LOCK_DATA_SSL_SESSION 4
+
+#define CURLINFO_TOTAL_TIME         (0x300000 + 3)
+#define CURLINFO_NAMELOOKUP_TIME    (0x300000 + 4)
+#define CURLINFO_CONNECT_TIME       (0x300000 + 5)
+#define CURLINFO_STARTTRANSFER_TIME (0x300000 + 17)
+#define CURLINFO_NUM_CONNECTS       (0x200000 + 26)
+#define CURLINFO_APPCONNECT_TIME    (0x300000 + 33)
 
 #if defined _WIN32
 #define APIENTRY __cdecl
@@ -231,6 +308,9 @@ static void     (APIENTRY *_curl_easy_cleanup)(CURL* c);
 static void     (APIENTRY *_curl_slist_free_all)(struct curl_slist* l);
 static struct curl_slist* (APIENTRY *_curl_slist_append)(struct curl_slist* l, const char* v);
 static const char* (APIENTRY *_curl_easy_strerror)(CURLcode res);
+static CURLcode (APIENTRY *_curl_easy_getinfo)(CURL* c, int info, ...);
+static CURLSH*  (APIENTRY *_curl_share_init)(void);
+static int      (APIENTRY *_curl_share_setopt)(CURLSH* s, int opt, ...);
 /* === END CURL HEADERS === */
 
 #if defined CC_BUILD_WIN
@@ -254,8 +334,11 @@ static cc_bool LoadCurlFuncs(void) {
 		DynamicLib_Sym(curl_easy_setopt),    DynamicLib_Sym(curl_easy_cleanup),
 		DynamicLib_Sym(curl_slist_free_all), DynamicLib_Sym(curl_slist_append)
 	};
-	/* Non-essential function missing in older curl versions */
-	static const struct DynamicLibSym optFuncs[] = { DynamicLib_Sym(curl_easy_strerror) };
+	/* Non-essential functions missing in older curl versions */
+	static const struct DynamicLibSym optFuncs[] = {
+		DynamicLib_Sym(curl_easy_strerror), DynamicLib_Sym(curl_easy_getinfo),
+		DynamicLib_Sym(curl_share_init),    DynamicLib_Sym(curl_share_setopt)
+	};
 
 	void* lib = DynamicLib_Load2(&curlLib);
 	if (!lib) { 
@@ -269,8 +352,14 @@ static cc_bool LoadCurlFuncs(void) {
 	return DynamicLib_GetAll(lib, funcs, Array_Elems(funcs));
 }
 
-static CURL* curl;
+/* Each worker has its own handle, as curl handles can't be used by multiple threads at once */
+/* Handles are reused for every request, so that their keep-alive connections are reused too */
+static CURL* curlHandles[HTTP_MAX_WORKERS];
 static cc_bool curlSupported;
+/* DNS cache and TLS sessions shared between all the handles */
+/* NOTE: Connections aren't shared, as curl doesn't support sharing them between threads */
+static CURLSH* curlShare;
+static void* curlShareLocks[8];
 
 cc_bool Http_DescribeError(cc_result res, cc_string* dst) {
 	const char* err;
@@ -283,16 +372,43 @@ cc_bool Http_DescribeError(cc_result res, cc_string* dst) {
 	return true;
 }
 
+static void Http_LockShare(CURL* c, int data, int access, void* userptr) {
+	Mutex_Lock(curlShareLocks[data & 7]);
+}
+static void Http_UnlockShare(CURL* c, int data, void* userptr) {
+	Mutex_Unlock(curlShareLocks[data & 7]);
+}
+
+static void Http_InitShare(void) {
+	int i;
+	if (!_curl_share_init || !(curlShare = _curl_share_init())) return;
+
+	for (i = 0; i < Array_Elems(curlShareLocks); i++) {
+		curlShareLocks[i] = Mutex_Create();
+	}
+	_curl_share_setopt(curlShare, CURLSHOPT_LOCKFUNC,   Http_LockShare);
+	_curl_share_setopt(curlShare, CURLSHOPT_UNLOCKFUNC, Http_UnlockShare);
+
+	_curl_share_setopt(curlShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+	_curl_share_setopt(curlShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+}
+
 static void HttpBackend_Init(void) {
 	static const cc_string msg = String_FromConst("Failed to init libcurl. All HTTP requests will therefore fail.");
 	CURLcode res;
 
+	int i;
+
 	if (!LoadCurlFuncs()) { Logger_WarnFunc(&msg); return; }
 	res = _curl_global_init(CURL_GLOBAL_DEFAULT);
 	if (res) { Logger_SimpleWarn(res, "initing curl"); return; }
 
-	curl = _curl_easy_init();
-	if (!curl) { Logger_SimpleWarn(res, "initing curl_easy"); return; }
+	Http_InitShare();
+	for (i = 0; i < http_workersCount; i++) {
+		curlHandles[i] = _curl_easy_init();
+		if (!curlHandles[i]) { Logger_SimpleWarn(res, "initing curl_easy"); return; }
+		if (curlShare) _curl_easy_setopt(curlHandles[i], CURLOPT_SHARE, curlShare);
+	}
 	curlSupported = true;
 }
 
@@ -332,7 +448,7 @@ static size_t Http_ProcessData(char *buffer, size_t size, size_t nitems, void* u
 }
 
 /* Sets general curl options for a request */
-static void Http_SetCurlOpts(struct HttpRequest* req) {
+static void Http_SetCurlOpts(CURL* curl, struct HttpRequest* req) {
 	_curl_easy_setopt(curl, CURLOPT_USERAGENT,      GAME_APP_NAME);
 	_curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
 	_curl_easy_setopt(curl, CURLOPT_MAXREDIRS,      20L);
@@ -345,6 +461,7 @@ static void Http_SetCurlOpts(struct HttpRequest* req) {
 
 static cc_result HttpBackend_Do(struct HttpRequest* req, cc_string* url) {
 	char urlStr[NATIVE_STR_LEN];
+	CURL* curl      = curlHandles[Http_WorkerOf(req) - http_workers];
 	void* post_data = req->data;
 	CURLcode res;
 	if (!curlSupported) return ERR_NOT_SUPPORTED;
@@ -353,7 +470,7 @@ static cc_result HttpBackend_Do(struct HttpRequest* req, cc_string* url) {
 	Http_SetRequestHeaders(req);
 	_curl_easy_setopt(curl, CURLOPT_HTTPHEADER, req->meta);
 
-	Http_SetCurlOpts(req);
+	Http_SetCurlOpts(curl, req);
 	Platform_EncodeUtf8(urlStr, url);
 	_curl_easy_setopt(curl, CURLOPT_URL, urlStr);
 
@@ -372,16 +489,48 @@ static cc_result HttpBackend_Do(struct HttpRequest* req, cc_string* url) {
 		_curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
 	}
 
-	req->_capacity   = 0;
-	http_curProgress = HTTP_PROGRESS_FETCHING_DATA;
+	req->_capacity = 0;
+	Http_WorkerOf(req)->progress = HTTP_PROGRESS_FETCHING_DATA;
 	res = _curl_easy_perform(curl);
-	http_curProgress = 100;
+	Http_WorkerOf(req)->progress = 100;
 
 	_curl_slist_free_all((struct curl_slist*)req->meta);
 	/* can free now that request has finished */
 	Mem_Free(post_data);
 	return res;
 }
+
+#define Http_TimeMS(secs) ((secs) > 0 ? (int)((secs) * 1000) : 0)
+/* Logs how long each stage of the given request took */
+static void HttpBackend_LogTimings(struct HttpRequest* req) {
+	char msgBuffer[128]; cc_string msg;
+	CURL* curl = curlHandles[Http_WorkerOf(req) - http_workers];
+	double dns = 0, connect = 0, tls = 0, start = 0, total = 0;
+	int dnsMS, connectMS, tlsMS, ttfbMS, transferMS;
+	long connects = 0;
+	if (!_curl_easy_getinfo || !curl) return;
+
+	/* NOTE: All these times are from when the request started */
+	_curl_easy_getinfo(curl, CURLINFO_NAMELOOKUP_TIME,    &dns);
+	_curl_easy_getinfo(curl, CURLINFO_CONNECT_TIME,       &connect);
+	_curl_easy_getinfo(curl, CURLINFO_APPCONNECT_TIME,    &tls);
+	_curl_easy_getinfo(curl, CURLINFO_STARTTRANSFER_TIME, &start);
+	_curl_easy_getinfo(curl, CURLINFO_TOTAL_TIME,         &total);
+	_curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS,       &connects);
+
+	dnsMS      = Http_TimeMS(dns);
+	connectMS  = Http_TimeMS(connect - dns);
+	tlsMS      = tls ? Http_TimeMS(tls - connect) : 0;
+	ttfbMS     = Http_TimeMS(start - max(connect, tls));
+	transferMS = Http_TimeMS(total - start);
+
+	String_InitArray(msg, msgBuffer);
+	String_Format3(&msg, "HTTP: dns %i, connect %i, tls %i", &dnsMS, &connectMS, &tlsMS);
+	String_Format2(&msg, ", ttfb %i, transfer %i ms", &ttfbMS, &transferMS);
+	/* No new connections were needed, i.e. a kept-alive connection was reused */
+	if (!connects && !req->result) String_AppendConst(&msg, " (reused connection)");
+	Platform_Log(msg.buffer, msg.length);
+}
 #elif defined CC_BUILD_WININET
 /*########################################################################################################################*
 *-----------------------------------------------------WinINet backend-----------------------------------------------------*
@@ -437,10 +586,13 @@ struct HttpCacheEntry {
 	cc_string Address; /* Address of server. (e.g. "classicube.net") */
 	cc_uint16 Port;    /* Port server is listening on. (e.g 80) */
 	cc_bool Https;     /* Whether HTTPS or just HTTP protocol. */
+	int Users;         /* Number of workers currently making requests using this connection. */
 	char _addressBuffer[STRING_SIZE + 1];
 };
+/* NOTE: Must be more than HTTP_MAX_WORKERS, so there's always an unused entry to evict */
 #define HTTP_CACHE_ENTRIES 10
 static struct HttpCacheEntry http_cache[HTTP_CACHE_ENTRIES];
+static void* http_cacheMutex;
 static HINTERNET hInternet;
 
 /* Converts characters to UTF8, then calls Http_URlEncode on them. */
@@ -494,6 +646,7 @@ static cc_result HttpCache_Insert(int i, struct HttpCacheEntry* e) {
 	if (!conn) return GetLastError();
 
 	e->Handle     = conn;
+	e->Users      = 0;
 	http_cache[i] = *e;
 
 	/* otherwise address buffer points to stack buffer */
@@ -501,28 +654,57 @@ static cc_result HttpCache_Insert(int i, struct HttpCacheEntry* e) {
 	return 0;
 }
 
-/* Finds or inserts the given entry into the cache */
-static cc_result HttpCache_Lookup(struct HttpCacheEntry* e) {
+/* Finds the index of the given entry in the cache, inserting it if necessary */
+static cc_result HttpCache_Find(struct HttpCacheEntry* e, int* index) {
 	struct HttpCacheEntry* c;
-	int i;
+	int i, j;
 
 	for (i = 0; i < HTTP_CACHE_ENTRIES; i++) {
 		c = &http_cache[i];
 		if (c->Https == e->Https && String_Equals(&c->Address, &e->Address) && c->Port == e->Port) {
-			e->Handle = c->Handle;
-			return 0;
+			*index = i; return 0;
 		}
 	}
 
 	for (i = 0; i < HTTP_CACHE_ENTRIES; i++) {
 		if (http_cache[i].Handle) continue;
-		return HttpCache_Insert(i, e);
+		*index = i; return HttpCache_Insert(i, e);
 	}
 
 	/* TODO: Should we be consistent in which entry gets evicted? */
 	i = (cc_uint8)Stopwatch_Measure() % HTTP_CACHE_ENTRIES;
+	/* Connection might still be in use by another worker */
+	for (j = 0; j < HTTP_CACHE_ENTRIES && http_cache[i].Users; j++) {
+		i = (i + 1) % HTTP_CACHE_ENTRIES;
+	}
+
 	InternetCloseHandle(http_cache[i].Handle);
-	return HttpCache_Insert(i, e);
+	*index = i; return HttpCache_Insert(i, e);
+}
+
+/* Finds or inserts the given entry into the cache, then marks it as being in use */
+static cc_result HttpCache_Lookup(struct HttpCacheEntry* e, int* index) {
+	cc_result res;
+	Mutex_Lock(http_cacheMutex);
+	{
+		res = HttpCache_Find(e, index);
+		if (!res) {
+			e->Handle = http_cache[*index].Handle;
+			http_cache[*index].Users++;
+		}
+	}
+	Mutex_Unlock(http_cacheMutex);
+	if (res) *index = -1;
+	return res;
+}
+
+/* Marks the entry at the given index as no longer being in use */
+static void HttpCache_Release(int index) {
+	Mutex_Lock(http_cacheMutex);
+	{
+		http_cache[index].Users--;
+	}
+	Mutex_Unlock(http_cacheMutex);
 }
 
 cc_bool Http_DescribeError(cc_result res, cc_string* dst) {
@@ -533,6 +715,7 @@ static void HttpBackend_Init(void) {
 	/* TODO: Should we use INTERNET_OPEN_TYPE_PRECONFIG instead? */
 	hInternet = InternetOpenA(GAME_APP_NAME, INTERNET_OPEN_TYPE_DIRECT, NULL, NULL, 0);
 	if (!hInternet) Logger_Abort2(GetLastError(), "Failed to init WinINet");
+	http_cacheMutex = Mutex_Create();
 }
 
 static void Http_AddHeader(struct HttpRequest* req, const char* key, const cc_string* value) {
@@ -545,7 +728,7 @@ static void Http_AddHeader(struct HttpRequest* req, const char* key, const cc_st
 }
 
 /* Creates and sends a HTTP request */
-static cc_result Http_StartRequest(struct HttpRequest* req, cc_string* url, HINTERNET* handle) {
+static cc_result Http_StartRequest(struct HttpRequest* req, cc_string* url, HINTERNET* handle, int* cacheIndex) {
 	static const char* verbs[3] = { "GET", "HEAD", "POST" };
 	struct HttpCacheEntry entry;
 	cc_string path; char pathBuffer[URL_MAX_SIZE + 1];
@@ -555,7 +738,7 @@ static cc_result Http_StartRequest(struct HttpRequest* req, cc_string* url, HINT
 	String_InitArray_NT(path, pathBuffer);
 	HttpCache_MakeEntry(url, &entry, &path);
 	pathBuffer[path.length] = '\0';
-	if ((res = HttpCache_Lookup(&entry))) return res;
+	if ((res = HttpCache_Lookup(&entry, cacheIndex))) return res;
 
 	flags = INTERNET_FLAG_NO_CACHE_WRITE | INTERNET_FLAG_NO_UI | INTERNET_FLAG_RELOAD | INTERNET_FLAG_NO_COOKIES;
 	if (entry.Https) flags |= INTERNET_FLAG_SECURE;
@@ -605,17 +788,17 @@ static cc_result Http_DownloadData(struct HttpRequest* req, HINTERNET handle) {
 		Http_BufferExpanded(req, read);
 	}
 
- 	http_curProgress = 100;
+ 	Http_WorkerOf(req)->progress = 100;
 	return 0;
 }
 
-static cc_result HttpBackend_Do(struct HttpRequest* req, cc_string* url) {
+static cc_result Http_PerformRequest(struct HttpRequest* req, cc_string* url, int* cacheIndex) {
 	HINTERNET handle;
-	cc_result res = Http_StartRequest(req, url, &handle);
+	cc_result res = Http_StartRequest(req, url, &handle, cacheIndex);
 	HttpRequest_Free(req);
 	if (res) return res;
 
-	http_curProgress = HTTP_PROGRESS_FETCHING_DATA;
+	Http_WorkerOf(req)->progress = HTTP_PROGRESS_FETCHING_DATA;
 	res = Http_ProcessHeaders(req, handle);
 	if (res) { InternetCloseHandle(handle); return res; }
 
@@ -626,6 +809,14 @@ static cc_result HttpBackend_Do(struct HttpRequest* req, cc_string* url) {
 
 	return InternetCloseHandle(handle) ? 0 : GetLastError();
 }
+
+static cc_result HttpBackend_Do(struct HttpRequest* req, cc_string* url) {
+	int cacheIndex = -1;
+	cc_result res  = Http_PerformRequest(req, url, &cacheIndex);
+
+	if (cacheIndex >= 0) HttpCache_Release(cacheIndex);
+	return res;
+}
 #elif defined CC_BUILD_ANDROID
 /*########################################################################################################################*
 *-----------------------------------------------------Android backend-----------------------------------------------------*
@@ -739,10 +930,10 @@ static cc_result HttpBackend_Do(struct HttpRequest* req, cc_string* url) {
 	Http_AddHeader(req, "User-Agent", &userAgent);
 	if (req->data && (res = Http_SetData(env, req))) return res;
 
-	req->_capacity   = 0;
-	http_curProgress = HTTP_PROGRESS_FETCHING_DATA;
+	req->_capacity = 0;
+	Http_WorkerOf(req)->progress = HTTP_PROGRESS_FETCHING_DATA;
 	res = JavaSCall_Int(env, JAVA_httpPerform, NULL);
-	http_curProgress = 100;
+	Http_WorkerOf(req)->progress = 100;
 	return res;
 }
 #elif defined CC_BUILD_CFNETWORK
@@ -845,32 +1036,276 @@ static cc_result HttpBackend_Do(struct HttpRequest* req, cc_string* url) {
 }
 #endif
 
-static void ClearCurrentRequest(void) {
-	Mutex_Lock(curRequestMutex);
+#ifndef CC_BUILD_CURL
+/* Other backends don't provide a timing breakdown */
+static void HttpBackend_LogTimings(struct HttpRequest* req) { }
+#endif
+
+/*########################################################################################################################*
+*-----------------------------------------------------Http disk cache-----------------------------------------------------*
+*#########################################################################################################################*/
+/* Responses are stored in httpcache/[CRC32 of URL], in the format: */
+/*   "CCHC" [u32 data length] [u16 URL length][URL] [u8 ETag length][ETag] [u8 Last-Modified length][Last-Modified] [data] */
+/* The URL is also stored so that URLs with the same CRC32 don't get each other's data. */
+#define DISKCACHE_DIR "httpcache"
+#define DISKCACHE_USED_TXT DISKCACHE_DIR "/used.txt"
+#define DISKCACHE_HEADER_SIZE (4 + 4 + 2 + URL_MAX_SIZE + 1 + STRING_SIZE + 1 + STRING_SIZE)
+/* Least recently used cache files are deleted once the total size of all of them exceeds this */
+#define DISKCACHE_LIMIT (512 * 1024 * 1024)
+static void* diskCacheMutex;
+/* Entries of "[CRC32 of URL] [file size]", from least to most recently used cache file */
+static struct StringsBuffer diskCacheUsed;
+
+struct DiskCacheEntry {
+	cc_uint8* file;  /* Contents of the whole cache file. (NULL if not cached) */
+	cc_uint8* data;  /* Cached response data, points within file. */
+	cc_uint32 size;  /* Size of cached response data. */
+	cc_string etag, lastModified;
+};
+
+static cc_uint32 DiskCache_Key(struct HttpRequest* req) {
+	cc_string url = String_FromRawArray(req->url);
+	return Utils_CRC32((const cc_uint8*)url.buffer, url.length);
+}
+
+static void DiskCache_MakePath(struct HttpRequest* req, cc_string* path) {
+	String_AppendConst(path, DISKCACHE_DIR "/");
+	String_AppendUInt32(path, DiskCache_Key(req));
+}
+
+static cc_uint64 DiskCache_UsedSize(int i, cc_string* name) {
+	cc_string entry = StringsBuffer_UNSAFE_Get(&diskCacheUsed, i);
+	cc_string size;
+	cc_uint64 value;
+
+	String_UNSAFE_Separate(&entry, ' ', name, &size);
+	return Convert_ParseUInt64(&size, &value) ? value : 0;
+}
+
+/* Marks the cache file for the request's URL as the most recently used one, */
+/*  then deletes the least recently used cache files if the total size is too large */
+/* NOTE: Must be called with diskCacheMutex held */
+static void DiskCache_MarkUsed(struct HttpRequest* req, cc_uint32 size) {
+	cc_string key;  char keyBuffer[STRING_INT_CHARS];
+	cc_string used; char usedBuffer[STRING_INT_CHARS];
+	cc_string path; char pathBuffer[FILENAME_SIZE];
+	cc_string name;
+	cc_uint64 total = 0;
+	cc_result res;
+	int i;
+
+	String_InitArray(key,  keyBuffer);
+	String_AppendUInt32(&key, DiskCache_Key(req));
+	String_InitArray(used, usedBuffer);
+	String_AppendUInt32(&used, size);
+	/* NOTE: This moves the entry to the end of the list */
+	EntryList_Set(&diskCacheUsed, &key, &used, ' ');
+
+	for (i = 0; i < diskCacheUsed.count; i++) {
+		total += DiskCache_UsedSize(i, &name);
+	}
+
+	/* The cache file that was just used is always kept */
+	while (total > DISKCACHE_LIMIT && diskCacheUsed.count > 1) {
+		total -= DiskCache_UsedSize(0, &name);
+		String_InitArray(path, pathBuffer);
+		String_Format1(&path, DISKCACHE_DIR "/%s", &name);
+
+		res = File_Delete(&path);
+		if (res && res != ReturnCode_FileNotFound) Logger_SysWarn2(res, "deleting", &path);
+		StringsBuffer_Remove(&diskCacheUsed, 0);
+	}
+	EntryList_Save(&diskCacheUsed, DISKCACHE_USED_TXT);
+}
+
+/* Reads the whole of the given file into memory */
+static cc_result DiskCache_ReadFile(const cc_string* path, cc_uint8** data, cc_uint32* size) {
+	struct Stream s;
+	cc_result res;
+	if ((res = Stream_OpenFile(&s, path))) return res;
+
+	if (!(res = s.Length(&s, size))) {
+		*data = (cc_uint8*)Mem_TryAlloc(*size, 1);
+		res   = *data ? Stream_Read(&s, *data, *size) : ERR_OUT_OF_MEMORY;
+		if (res) { Mem_Free(*data); *data = NULL; }
+	}
+	s.Close(&s);
+	return res;
+}
+
+/* Reads and validates a string field in a cache file */
+static int DiskCache_ReadString(cc_uint8* file, int offset, int len, cc_uint32 fileSize, cc_string* str) {
+	if (offset + len > fileSize) return -1;
+	*str = String_Init((char*)&file[offset], len, len);
+	return offset + len;
+}
+
+/* Attempts to load the cached response for the request's URL */
+static void DiskCache_Load(struct HttpRequest* req, struct DiskCacheEntry* e) {
+	cc_string path; char pathBuffer[FILENAME_SIZE];
+	cc_string url, cachedUrl;
+	cc_uint8* file = NULL;
+	cc_uint32 fileSize;
+	cc_result res;
+	int offset;
+
+	String_InitArray(path, pathBuffer);
+	DiskCache_MakePath(req, &path);
+	Mem_Set(e, 0, sizeof(*e));
+
+	Mutex_Lock(diskCacheMutex);
 	{
-		http_curRequest.id = 0;
-		http_curProgress   = HTTP_PROGRESS_NOT_WORKING_ON;
+		res = DiskCache_ReadFile(&path, &file, &fileSize);
+		if (!res) DiskCache_MarkUsed(req, fileSize);
 	}
-	Mutex_Unlock(curRequestMutex);
+	Mutex_Unlock(diskCacheMutex);
+
+	if (res == ReturnCode_FileNotFound) return;
+	if (res) { Logger_SysWarn2(res, "reading cache for", &path); return; }
+	if (fileSize < 12 || !Mem_Equal(file, "CCHC", 4)) goto invalid;
+	
+	offset = DiskCache_ReadString(file, 10, Stream_GetU16_LE(file + 8), fileSize, &cachedUrl);
+	if (offset < 0 || offset >= fileSize) goto invalid;
+	offset = DiskCache_ReadString(file, offset + 1, file[offset], fileSize, &e->etag);
+	if (offset < 0 || offset >= fileSize) goto invalid;
+	offset = DiskCache_ReadString(file, offset + 1, file[offset], fileSize, &e->lastModified);
+	if (offset < 0 || offset + Stream_GetU32_LE(file + 4) != fileSize) goto invalid;
+
+	/* Different URL that happens to have the same CRC32 */
+	url = String_FromRawArray(req->url);
+	if (!String_Equals(&url, &cachedUrl)) { Mem_Free(file); return; }
+
+	e->file = file;
+	e->data = file + offset;
+	e->size = fileSize - offset;
+	return;
+
+invalid:
+	Platform_Log1("Ignoring invalid cache entry %s", &path);
+	Mem_Free(file);
+}
+
+/* Saves the response data and validators for the request's URL */
+static void DiskCache_Save(struct HttpRequest* req) {
+	cc_string path; char pathBuffer[FILENAME_SIZE];
+	cc_string tmp;  char tmpBuffer[FILENAME_SIZE];
+	cc_uint8 header[DISKCACHE_HEADER_SIZE];
+	cc_string url, etag, lastModified;
+	struct Stream s;
+	cc_result res, closeRes;
+	int offset;
+
+	url  = String_FromRawArray(req->url);
+	etag = String_FromRawArray(req->etag);
+	lastModified = String_FromRawArray(req->lastModified);
+	/* No point caching responses which can't be revalidated */
+	if (!etag.length && !lastModified.length) return;
+
+	Mem_Copy(header, "CCHC", 4);
+	Stream_SetU32_LE(header + 4, req->size);
+	Stream_SetU16_LE(header + 8, url.length);
+	Mem_Copy(header + 10, url.buffer, url.length);
+	offset = 10 + url.length;
+
+	header[offset++] = etag.length;
+	Mem_Copy(header + offset, etag.buffer, etag.length);
+	offset += etag.length;
+	header[offset++] = lastModified.length;
+	Mem_Copy(header + offset, lastModified.buffer, lastModified.length);
+	offset += lastModified.length;
+
+	String_InitArray(path, pathBuffer);
+	DiskCache_MakePath(req, &path);
+	/* Written to a separate file first, so that readers never see a partially written entry */
+	/* The request ID is included so that requests for the same URL don't write the same file */
+	String_InitArray(tmp, tmpBuffer);
+	String_Format2(&tmp, "%s.%i.tmp", &path, &req->id);
+
+	res = Stream_CreateFile(&s, &tmp);
+	if (res) { Logger_SysWarn2(res, "creating", &tmp); return; }
+
+	res = Stream_Write(&s, header, offset);
+	if (!res) res = Stream_Write(&s, req->data, req->size);
+	closeRes = s.Close(&s);
+	if (!res) res = closeRes;
+	if (res) { Logger_SysWarn2(res, "caching", &url); File_Delete(&tmp); return; }
+
+	Mutex_Lock(diskCacheMutex);
+	{
+		res = File_Rename(&tmp, &path);
+		if (!res) DiskCache_MarkUsed(req, offset + req->size);
+	}
+	Mutex_Unlock(diskCacheMutex);
+
+	if (res) { Logger_SysWarn2(res, "renaming", &tmp); File_Delete(&tmp); }
+}
+
+/* Makes the request conditional if its URL has been cached before */
+static void DiskCache_BeginRequest(struct HttpRequest* req, struct DiskCacheEntry* e) {
+	DiskCache_Load(req, e);
+	if (!e->file) return;
+
+	String_CopyToRawArray(req->etag,         &e->etag);
+	String_CopyToRawArray(req->lastModified, &e->lastModified);
+}
+
+/* Uses the cached data if the response wasn't modified, otherwise updates the cache */
+static void DiskCache_EndRequest(struct HttpRequest* req, struct DiskCacheEntry* e) {
+	if (req->result) {
+		/* ignore failed requests */
+	} else if (req->statusCode == 304 && e->file) {
+		HttpRequest_Free(req);
+		req->data = (cc_uint8*)Mem_Alloc(e->size, 1, "http cached data");
+		req->size = e->size;
+		Mem_Copy(req->data, e->data, e->size);
+		req->statusCode = 200;
+	} else if (req->statusCode == 200 && req->data && req->size) {
+		DiskCache_Save(req);
+	}
+	Mem_Free(e->file);
+}
+
+
+/* Takes the next request that can be started off the pending list */
+static cc_bool Http_TakeRequest(struct HttpWorker* w) {
+	struct HttpRequest* active[HTTP_MAX_WORKERS];
+	int i, count = 0;
+
+	for (i = 0; i < http_workersCount; i++) {
+		if (http_workers[i].busy) active[count++] = &http_workers[i].request;
+	}
+
+	i = RequestList_NextRunnable(&pendingReqs, active, count, http_hostLimit);
+	if (i == -1) return false;
+
+	w->request  = pendingReqs.entries[i];
+	w->progress = HTTP_PROGRESS_MAKING_REQUEST;
+	w->busy     = true;
+	w->streamed  = 0;
+	w->streamRes = 0;
+	RequestList_RemoveAt(&pendingReqs, i);
+	return true;
 }
 
 static void WorkerLoop(void) {
 	char urlBuffer[URL_MAX_SIZE]; cc_string url;
-	struct HttpRequest request;
-	cc_bool hasRequest;
+	struct DiskCacheEntry cached;
+	struct HttpWorker* w;
+	cc_bool hasRequest, hasMore;
 	cc_uint64 beg, end;
 	int elapsed;
 
-	for (;;) {
-		hasRequest = false;
+	Mutex_Lock(pendingMutex);
+	{
+		w = &http_workers[http_workersStarted++];
+	}
+	Mutex_Unlock(pendingMutex);
 
+	for (;;) {
 		Mutex_Lock(pendingMutex);
 		{
-			if (pendingReqs.count) {
-				request    = pendingReqs.entries[0];
-				hasRequest = true;
-				RequestList_RemoveAt(&pendingReqs, 0);
-			}
+			hasRequest = Http_TakeRequest(w);
+			hasMore    = pendingReqs.count > 0;
 		}
 		Mutex_Unlock(pendingMutex);
 
@@ -880,20 +1315,32 @@ static void WorkerLoop(void) {
 			Waitable_Wait(workerWaitable);
 			continue;
 		}
+		/* Signals coalesce, so make sure another idle worker checks for remaining requests */
+		if (hasMore) Http_SignalWorker();
 
 		String_InitArray(url, urlBuffer);
-		Http_BeginRequest(&request, &url);
+		Http_BeginRequest(&w->request, &url);
+		if (w->request.diskCache) DiskCache_BeginRequest(&w->request, &cached);
 
 		beg = Stopwatch_Measure();
-		request.result = HttpBackend_Do(&request, &url);
+		w->request.result = HttpBackend_Do(&w->request, &url);
+		if (w->request.consumer) Http_EndStreaming(&w->request);
 		end = Stopwatch_Measure();
 
 		elapsed = Stopwatch_ElapsedMS(beg, end);
 		Platform_Log4("HTTP: result %i (http %i) in %i ms (%i bytes)",
-					&request.result, &request.statusCode, &elapsed, &request.size);
+					&w->request.result, &w->request.statusCode, &elapsed, &w->request.size);
+		HttpBackend_LogTimings(&w->request);
 
-		Http_FinishRequest(&request);
-		ClearCurrentRequest();
+		if (w->request.diskCache) DiskCache_EndRequest(&w->request, &cached);
+
+		Http_FinishRequest(&w->request);
+		Mutex_Lock(pendingMutex);
+		{
+			w->busy     = false;
+			w->progress = HTTP_PROGRESS_NOT_WORKING_ON;
+		}
+		Mutex_Unlock(pendingMutex);
 	}
 }
 
@@ -902,19 +1349,29 @@ static void WorkerLoop(void) {
 *-----------------------------------------------------Http component------------------------------------------------------*
 *#########################################################################################################################*/
 static void Http_Init(void) {
+	int i;
 	httpOnly = Options_GetBool(OPT_HTTP_ONLY, false);
 	ScheduledTask_Add(30, Http_CleanCacheTask);
 	/* Http component gets initialised multiple times on Android */
-	if (workerThread) return;
+	if (http_workersCount) return;
+
+	http_workersCount = Options_GetInt(OPT_HTTP_WORKERS, 1, HTTP_MAX_WORKERS, 
+										min(HTTP_DEF_WORKERS, HTTP_MAX_WORKERS));
+	http_hostLimit    = Options_GetInt(OPT_HTTP_HOST_LIMIT, 1, HTTP_MAX_WORKERS, HTTP_DEF_HOST_LIMIT);
 
 	HttpBackend_Init();
 	workerWaitable = Waitable_Create();
 	RequestList_Init(&pendingReqs);
 	RequestList_Init(&processedReqs);
 
-	pendingMutex    = Mutex_Create();
-	processedMutex  = Mutex_Create();
-	curRequestMutex = Mutex_Create();
-	workerThread    = Thread_Start(WorkerLoop);
+	pendingMutex   = Mutex_Create();
+	processedMutex = Mutex_Create();
+	diskCacheMutex = Mutex_Create();
+	Utils_EnsureDirectory(DISKCACHE_DIR);
+	EntryList_UNSAFE_Load(&diskCacheUsed, DISKCACHE_USED_TXT);
+	for (i = 0; i < http_workersCount; i++) {
+		http_workers[i].progress = HTTP_PROGRESS_NOT_WORKING_ON;
+		http_workers[i].thread   = Thread_Start(WorkerLoop);
+	}
 }
 #endif
@@ -619,7 +619,7 @@ static void FetchFlagsTask_DownloadNext(void) {
 			&flags[FetchFlagsTask.count].country[0], &flags[FetchFlagsTask.count].country[1]);
 
 	FetchFlagsTask.Base.Handle = FetchFlagsTask_Handle;
-	FetchFlagsTask.Base.reqID  = Http_AsyncGetData(&url, false);
+	FetchFlagsTask.Base.reqID  = Http_AsyncGetCachedData(&url, false);
 }
 
 static void FetchFlagsTask_Ensure(void) {
@@ -82,6 +82,7 @@ static const char* GetCCErrorDesc(cc_result res) {
 
 	case ERR_DOWNLOAD_INVALID: return "Website denied download or doesn't exist";
 	case ERR_NO_AUDIO_OUTPUT: return "No audio output devices plugged in";
+	case NET_ERR_CAPTURE_SIG: return "Not a packet capture or unsupported version";
 	}
 	return NULL;
 }
@@ -45,6 +45,8 @@ static int renderChunksCount;
 static cc_uint32* distances;
 /* Maximum number of chunk updates that can be performed in one frame. */
 static int maxChunkUpdates;
+/* Whether any chunks have been built since all chunks were last deleted. */
+static cc_bool anyChunksBuilt;
 
 static void ChunkInfo_Reset(struct ChunkInfo* chunk, int x, int y, int z) {
 	chunk->CentreX = x + HALF_CHUNK_SIZE; chunk->CentreY = y + HALF_CHUNK_SIZE; 
@@ -355,6 +357,7 @@ static void BuildChunk(struct ChunkInfo* info, int* chunkUpdates) {
 	Game.ChunkUpdates++;
 	(*chunkUpdates)++;
 	info->PendingDelete = false;
+	anyChunksBuilt      = true;
 	Builder_MakeChunk(info);
 
 	if (!info->NormalParts && !info->TranslucentParts) {
@@ -467,6 +470,7 @@ static void DeleteChunks(void) {
 		DeleteChunk(&mapChunks[i]);
 	}
 	ResetPartCounts();
+	anyChunksBuilt = false;
 }
 
 void MapRenderer_Refresh(void) {
@@ -744,7 +748,11 @@ static void OnTerrainAtlasChanged(void* obj) {
 }
 
 static void OnBlockDefinitionChanged(void* obj) {
-	MapRenderer_Refresh();
+	/* Chunks that haven't been built yet will use the new definitions anyways */
+	/* (e.g. when servers send block definitions before or just after the map) */
+	if (anyChunksBuilt || MapRenderer_UsedAtlases() != MapRenderer_1DUsedCount) {
+		MapRenderer_Refresh();
+	}
 	MapRenderer_1DUsedCount = MapRenderer_UsedAtlases();
 	ResetPartFlags();
 }
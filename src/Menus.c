@@ -1342,12 +1342,18 @@ static void DownloadMap(const cc_string* path) {
 static void SaveLevelScreen_SaveMap(struct SaveLevelScreen* s, const cc_string* path) {
 	static const cc_string cw = String_FromConst(".cw");
 	struct Stream stream, compStream;
-	struct GZipState state;
+	struct GZipState* state;
 	cc_result res;
 
 	res = Stream_CreateFile(&stream, path);
 	if (res) { Logger_SysWarn2(res, "creating", path); return; }
-	GZip_MakeStream(&compStream, &state, &stream);
+	/* Compressing large maps is slow, so try to use multiple threads */
+	state = NULL;
+	if (GZip_MakeParallelStream(&compStream, &stream, 4)) {
+		/* Compression state is too large to safely put on the stack */
+		state = (struct GZipState*)Mem_Alloc(1, sizeof(struct GZipState), "map compressor");
+		GZip_MakeStream(&compStream, state, &stream);
+	}
 
 #ifdef CC_BUILD_WEB
 	res = Cw_Save(&compStream);
@@ -1360,11 +1366,15 @@ static void SaveLevelScreen_SaveMap(struct SaveLevelScreen* s, const cc_string*
 #endif
 
 	if (res) {
+		compStream.Close(&compStream);
 		stream.Close(&stream);
+		Mem_Free(state);
 		Logger_SysWarn2(res, "encoding", path); return;
 	}
 
-	if ((res = compStream.Close(&compStream))) {
+	res = compStream.Close(&compStream);
+	Mem_Free(state);
+	if (res) {
 		stream.Close(&stream);
 		Logger_SysWarn2(res, "closing", path); return;
 	}
@@ -65,13 +65,23 @@
 #define OPT_CLASSIC_ARM_MODEL "nostalgia-classicarm"
 #define OPT_CLASSIC_CHAT "nostalgia-classicchat"
 #define OPT_MAX_CHUNK_UPDATES "gfx-maxchunkupdates"
+#define OPT_LIQUID_ANIM_LOOP "gfx-liquidanimloop"
 #define OPT_CAMERA_MASS "cameramass"
 #define OPT_CAMERA_SMOOTH "camera-smooth"
 #define OPT_GRAB_CURSOR "win-grab-cursor"
 #define OPT_TOUCH_BUTTONS "gui-touchbuttons"
 #define OPT_TOUCH_SCALE "gui-touchscale"
 #define OPT_HTTP_ONLY "http-no-https"
+#define OPT_HTTP_WORKERS "http-workers"
+#define OPT_HTTP_HOST_LIMIT "http-hostlimit"
 #define OPT_RAW_INPUT "win-raw-input"
+#define OPT_CAPTURE_PACKETS "net-capture"
+#define OPT_REPLAY_MAX_SPEED "net-replay-maxspeed"
+#define OPT_LOOPBACK_CPE "net-loopback-cpe"
+#define OPT_LOOPBACK_SIZE "net-loopback-size"
+#define OPT_LOOPBACK_BOTS "net-loopback-bots"
+#define OPT_LOOPBACK_MOVES "net-loopback-moves"
+#define OPT_LOOPBACK_BLOCKS "net-loopback-blocks"
 
 #define LOPT_SESSION  "launcher-session"
 #define LOPT_USERNAME "launcher-cc-username"
@@ -181,6 +181,12 @@ cc_result File_Seek(cc_file file, int offset, int seekType);
 cc_result File_Position(cc_file file, cc_uint32* pos);
 /* Attempts to retrieve the length of the given file. */
 cc_result File_Length(cc_file file, cc_uint32* len);
+/* Attempts to rename the given file, replacing the destination file if it already exists. */
+/* NOTE: Not supported in the web client. */
+cc_result File_Rename(const cc_string* src, const cc_string* dst);
+/* Attempts to delete the given file. */
+/* NOTE: Not supported in the web client. */
+cc_result File_Delete(const cc_string* path);
 
 /* Blocks the current thread for the given number of milliseconds. */
 CC_API void Thread_Sleep(cc_uint32 milliseconds);
@@ -237,6 +243,8 @@ CC_API cc_result Socket_Close(cc_socket s);
 /* NOTE: A closed socket is still considered readable. */
 /* NOTE: A socket is considered writable once it has finished connecting. */
 CC_API cc_result Socket_Poll(cc_socket s, int mode, cc_bool* success);
+/* Same as Socket_Poll, but blocks for up to the given number of milliseconds until readable/writable. */
+CC_API cc_result Socket_PollFor(cc_socket s, int mode, cc_uint32 milliseconds, cc_bool* success);
 
 #ifdef CC_BUILD_MOBILE
 void Platform_ShareScreenshot(const cc_string* filename);
@@ -226,6 +226,14 @@ cc_result File_Length(cc_file file, cc_uint32* len) {
 	}
 }
 
+cc_result File_Rename(const cc_string* src, const cc_string* dst) {
+	return ERR_NOT_SUPPORTED;
+}
+
+cc_result File_Delete(const cc_string* path) {
+	return ERR_NOT_SUPPORTED;
+}
+
 
 /*########################################################################################################################*
 *--------------------------------------------------------Threading--------------------------------------------------------*
@@ -353,6 +361,11 @@ cc_result Socket_Poll(cc_socket s, int mode, cc_bool* success) {
 	}
 }
 
+/* Blocking isn't possible on the web, so just polls once instead */
+cc_result Socket_PollFor(cc_socket s, int mode, cc_uint32 milliseconds, cc_bool* success) {
+	return Socket_Poll(s, mode, success);
+}
+
 
 /*########################################################################################################################*
 *-----------------------------------------------------Process/Module------------------------------------------------------*
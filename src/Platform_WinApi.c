@@ -284,6 +284,35 @@ cc_result File_Length(cc_file file, cc_uint32* len) {
 	return *len != INVALID_FILE_SIZE ? 0 : GetLastError();
 }
 
+cc_result File_Rename(const cc_string* src, const cc_string* dst) {
+	WCHAR srcStr[NATIVE_STR_LEN], dstStr[NATIVE_STR_LEN];
+	cc_result res;
+	Platform_EncodeUtf16(srcStr, src);
+	Platform_EncodeUtf16(dstStr, dst);
+
+	if (MoveFileExW(srcStr, dstStr, MOVEFILE_REPLACE_EXISTING)) return 0;
+	if ((res = GetLastError()) != ERROR_CALL_NOT_IMPLEMENTED) return res;
+
+	/* Windows 9x does not support W API functions, nor MoveFileEx */
+	Platform_Utf16ToAnsi(srcStr);
+	Platform_Utf16ToAnsi(dstStr);
+	DeleteFileA((LPCSTR)dstStr);
+	return MoveFileA((LPCSTR)srcStr, (LPCSTR)dstStr) ? 0 : GetLastError();
+}
+
+cc_result File_Delete(const cc_string* path) {
+	WCHAR str[NATIVE_STR_LEN];
+	cc_result res;
+	Platform_EncodeUtf16(str, path);
+
+	if (DeleteFileW(str)) return 0;
+	if ((res = GetLastError()) != ERROR_CALL_NOT_IMPLEMENTED) return res;
+
+	/* Windows 9x does not support W API functions */
+	Platform_Utf16ToAnsi(str);
+	return DeleteFileA((LPCSTR)str) ? 0 : GetLastError();
+}
+
 
 /*########################################################################################################################*
 *--------------------------------------------------------Threading--------------------------------------------------------*
@@ -515,11 +544,13 @@ cc_result Socket_Close(cc_socket s) {
 	return res;
 }
 
-cc_result Socket_Poll(cc_socket s, int mode, cc_bool* success) {
+cc_result Socket_PollFor(cc_socket s, int mode, cc_uint32 milliseconds, cc_bool* success) {
 	fd_set set;
-	struct timeval time = { 0 };
+	struct timeval time;
 	int selectCount;
 
+	time.tv_sec     = milliseconds / 1000;
+	time.tv_usec    = (milliseconds % 1000) * 1000;
 	set.fd_count    = 1;
 	set.fd_array[0] = s;
 
@@ -534,6 +565,10 @@ cc_result Socket_Poll(cc_socket s, int mode, cc_bool* success) {
 	*success = set.fd_count != 0; return 0;
 }
 
+cc_result Socket_Poll(cc_socket s, int mode, cc_bool* success) {
+	return Socket_PollFor(s, mode, 0, success);
+}
+
 
 /*########################################################################################################################*
 *-----------------------------------------------------Process/Module------------------------------------------------------*
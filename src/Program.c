@@ -9,6 +9,7 @@
 #include "Launcher.h"
 #include "Server.h"
 #include "Options.h"
+#include "Deflate.h"
 
 static void RunGame(void) {
 	cc_string title; char titleBuffer[STRING_SIZE];
@@ -64,6 +65,7 @@ static void SetupProgram(int argc, char** argv) {
 	Platform_LogConst("Starting " GAME_APP_NAME " ..");
 	String_InitArray(Server.Address, ipBuffer);
 	Options_Load();
+	Deflate_Init();
 }
 
 static int RunProgram(int argc, char** argv) {
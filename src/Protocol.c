@@ -416,35 +416,212 @@ static void MapState_Init(struct MapState* m) {
 	m->allocFailed = false;
 }
 
-static void FreeMapStates(void) {
-	Mem_Free(map.blocks);
-	map.blocks  = NULL;
-#ifdef EXTENDED_BLOCKS
-	Mem_Free(map2.blocks);
-	map2.blocks = NULL;
-#endif
-}
-
-static void MapState_Read(struct MapState* m) {
+static cc_result MapState_Read(struct MapState* m) {
 	cc_uint32 left, read;
 	cc_result res;
-	if (m->allocFailed) return;
+	if (m->allocFailed) return 0;
 
 	if (!m->blocks) {
 		m->blocks = (BlockRaw*)Mem_TryAlloc(map_volume, 1);
 		/* unlikely but possible */
-		if (!m->blocks) {
-			Window_ShowDialog("Out of memory", "Not enough free memory to join that map.\nTry joining a different map.");
-			m->allocFailed = true;
-			return;
-		}
+		if (!m->blocks) { m->allocFailed = true; return 0; }
 	}
 
 	left = map_volume - m->index;
 	res  = m->stream.Read(&m->stream, &m->blocks[m->index], left, &read);
-
-	if (res) DisconnectInvalidMap(res);
 	m->index += read;
+	return res;
+}
+
+/* Decompresses a LevelDataChunk packet's data into the map's blocks array */
+static cc_result MapState_ReadChunk(cc_uint8* data, int usedLength, cc_bool upper) {
+	cc_uint32 left, read;
+	cc_result res;
+
+	map_part.Meta.Mem.Cur    = data;
+	map_part.Meta.Mem.Base   = data;
+	map_part.Meta.Mem.Left   = usedLength;
+	map_part.Meta.Mem.Length = usedLength;
+
+	if (!map_gzHeader.done) {
+		res = GZipHeader_Read(&map_part, &map_gzHeader);
+		if (res && res != ERR_END_OF_STREAM) return res;
+	}
+	if (!map_gzHeader.done) return 0;
+
+	if (map_sizeIndex < MAP_SIZE_LEN) {
+		left = MAP_SIZE_LEN - map_sizeIndex;
+		res  = map.stream.Read(&map.stream, &map_size[map_sizeIndex], left, &read); 
+
+		if (res) return res;
+		map_sizeIndex += read;
+	}
+	if (map_sizeIndex < MAP_SIZE_LEN) return 0;
+	if (!map_volume) map_volume = Stream_GetU32_BE(map_size);
+
+#ifdef EXTENDED_BLOCKS
+	if (upper) return MapState_Read(&map2);
+#endif
+	return MapState_Read(&map);
+}
+
+static float MapState_Progress(void) {
+	return !map.blocks ? 0.0f : (float)map.index / map_volume;
+}
+
+static cc_bool MapState_AllocFailed(void) {
+#ifdef EXTENDED_BLOCKS
+	if (map2.allocFailed) return true;
+#endif
+	return map.allocFailed;
+}
+
+#ifndef CC_BUILD_WEB
+#define MAP_DECODE_THREAD
+/* Map data is decompressed on a background thread, so that inflating */
+/*  doesn't take time away from the main thread while receiving the map */
+static struct MapDecoder {
+	void* thread;
+	void* mutex;
+	void* signal;
+	/* Chunks not yet decompressed, stored as 1 byte 'upper' + 2 byte length + data */
+	/* (main thread appends to pending, decoder thread swaps it with work) */
+	cc_uint8* pending; int pendingLen, pendingCapacity;
+	cc_uint8* work;    int workCapacity;
+	cc_bool finishing, stop;
+	/* Copy of decoder thread's state, updated after each batch of chunks */
+	cc_result result;
+	cc_bool allocFailed;
+	float progress;
+} map_decoder;
+
+static void MapDecoder_Main(void) {
+	cc_uint8* data;
+	cc_uint8* end;
+	cc_uint8* tmp;
+	cc_result res = 0;
+	int len, chunkLen, capacity;
+
+	for (;;) {
+		Mutex_Lock(map_decoder.mutex);
+		for (;;) {
+			if (map_decoder.stop)       { Mutex_Unlock(map_decoder.mutex); return; }
+			if (map_decoder.pendingLen) break;
+			if (map_decoder.finishing)  { Mutex_Unlock(map_decoder.mutex); return; }
+
+			Mutex_Unlock(map_decoder.mutex);
+			Waitable_Wait(map_decoder.signal);
+			Mutex_Lock(map_decoder.mutex);
+		}
+
+		tmp = map_decoder.work; capacity = map_decoder.workCapacity;
+		map_decoder.work         = map_decoder.pending;
+		map_decoder.workCapacity = map_decoder.pendingCapacity;
+		len = map_decoder.pendingLen;
+
+		map_decoder.pending         = tmp;
+		map_decoder.pendingCapacity = capacity;
+		map_decoder.pendingLen      = 0;
+		Mutex_Unlock(map_decoder.mutex);
+
+		/* once an error occurs, the rest of the map data is just ignored */
+		for (data = map_decoder.work, end = data + len; data < end && !res; data += 3 + chunkLen) {
+			chunkLen = data[1] | (data[2] << 8);
+			res      = MapState_ReadChunk(data + 3, chunkLen, data[0]);
+		}
+
+		Mutex_Lock(map_decoder.mutex);
+		map_decoder.result      = res;
+		map_decoder.allocFailed = MapState_AllocFailed();
+		map_decoder.progress    = MapState_Progress();
+		Mutex_Unlock(map_decoder.mutex);
+	}
+}
+
+static void MapDecoder_Start(void) {
+	if (!map_decoder.mutex) {
+		map_decoder.mutex  = Mutex_Create();
+		map_decoder.signal = Waitable_Create();
+	}
+	map_decoder.pendingLen  = 0;
+	map_decoder.finishing   = false;
+	map_decoder.stop        = false;
+	map_decoder.result      = 0;
+	map_decoder.allocFailed = false;
+	map_decoder.progress    = 0.0f;
+	map_decoder.thread      = Thread_Start(MapDecoder_Main);
+}
+
+/* Queues a chunk of map data to be decompressed */
+static void MapDecoder_Submit(cc_uint8* data, int usedLength, cc_bool upper) {
+	int required;
+	cc_uint8* dst;
+	if (!map_decoder.thread) MapDecoder_Start();
+
+	Mutex_Lock(map_decoder.mutex);
+	{
+		required = map_decoder.pendingLen + 3 + usedLength;
+		if (required > map_decoder.pendingCapacity) {
+			map_decoder.pendingCapacity = max(required, map_decoder.pendingCapacity * 2);
+			map_decoder.pending = (cc_uint8*)Mem_Realloc(map_decoder.pending, map_decoder.pendingCapacity,
+														1, "map decoder queue");
+		}
+
+		dst    = map_decoder.pending + map_decoder.pendingLen;
+		dst[0] = upper;
+		dst[1] = (cc_uint8)usedLength; dst[2] = (cc_uint8)(usedLength >> 8);
+		Mem_Copy(dst + 3, data, usedLength);
+		map_decoder.pendingLen = required;
+	}
+	Mutex_Unlock(map_decoder.mutex);
+	Waitable_Signal(map_decoder.signal);
+}
+
+/* Waits for the decoder thread to either finish decompressing all queued data, or to stop */
+static void MapDecoder_Join(cc_bool stop) {
+	if (!map_decoder.thread) return;
+
+	Mutex_Lock(map_decoder.mutex);
+	{
+		map_decoder.finishing = true;
+		map_decoder.stop      = stop;
+	}
+	Mutex_Unlock(map_decoder.mutex);
+
+	Waitable_Signal(map_decoder.signal);
+	Thread_Join(map_decoder.thread);
+	map_decoder.thread = NULL;
+}
+
+static void MapDecoder_Free(void) {
+	MapDecoder_Join(true);
+	Mem_Free(map_decoder.pending);
+	Mem_Free(map_decoder.work);
+	map_decoder.pending = NULL; map_decoder.pendingCapacity = 0;
+	map_decoder.work    = NULL; map_decoder.workCapacity    = 0;
+}
+#endif
+
+static void FreeMapStates(void) {
+#ifdef MAP_DECODE_THREAD
+	/* decoder thread might still be writing into the blocks arrays */
+	MapDecoder_Free();
+#endif
+	Mem_Free(map.blocks);
+	map.blocks  = NULL;
+#ifdef EXTENDED_BLOCKS
+	Mem_Free(map2.blocks);
+	map2.blocks = NULL;
+#endif
+}
+
+static void MapState_CheckAllocFailed(cc_bool failed) {
+	static cc_bool shown;
+	if (!failed) { shown = false; return; }
+	if (shown) return;
+
+	Window_ShowDialog("Out of memory", "Not enough free memory to join that map.\nTry joining a different map.");
+	shown = true;
 }
 
 static void Classic_StartLoading(void) {
@@ -465,6 +642,7 @@ static void Classic_StartLoading(void) {
 #ifdef EXTENDED_BLOCKS
 	MapState_Init(&map2);
 #endif
+	MapState_CheckAllocFailed(false);
 }
 
 static void Classic_LevelInit(cc_uint8* data) {
@@ -483,7 +661,7 @@ static void Classic_LevelInit(cc_uint8* data) {
 static void Classic_LevelDataChunk(cc_uint8* data) {
 	int usedLength;
 	float progress;
-	cc_uint32 left, read;
+	cc_bool upper, allocFailed;
 	cc_uint8 value;
 	cc_result res;
 
@@ -491,44 +669,31 @@ static void Classic_LevelDataChunk(cc_uint8* data) {
 	if (!map_begunLoading) Classic_StartLoading();
 	usedLength = Stream_GetU16_BE(data); data += 2;
 
-	map_part.Meta.Mem.Cur    = data;
-	map_part.Meta.Mem.Base   = data;
-	map_part.Meta.Mem.Left   = usedLength;
-	map_part.Meta.Mem.Length = usedLength;
-
-	data += 1024;
-	value = *data; /* progress in original classic, but we ignore it */
+	value = data[1024]; /* progress in original classic, but we ignore it */
+#ifdef EXTENDED_BLOCKS
+	upper = cpe_extBlocks && value;
+#else
+	upper = false;
+#endif
 
-	if (!map_gzHeader.done) {
-		res = GZipHeader_Read(&map_part, &map_gzHeader);
-		if (res && res != ERR_END_OF_STREAM) { DisconnectInvalidMap(res); return; }
+#ifdef MAP_DECODE_THREAD
+	MapDecoder_Submit(data, usedLength, upper);
+	/* NOTE: Errors are only noticed once the decoder thread gets around to that data */
+	Mutex_Lock(map_decoder.mutex);
+	{
+		res         = map_decoder.result;
+		progress    = map_decoder.progress;
+		allocFailed = map_decoder.allocFailed;
 	}
-
-	if (map_gzHeader.done) {
-		if (map_sizeIndex < MAP_SIZE_LEN) {
-			left = MAP_SIZE_LEN - map_sizeIndex;
-			res  = map.stream.Read(&map.stream, &map_size[map_sizeIndex], left, &read); 
-
-			if (res) { DisconnectInvalidMap(res); return; }
-			map_sizeIndex += read;
-		}
-
-		if (map_sizeIndex == MAP_SIZE_LEN) {
-			if (!map_volume) map_volume = Stream_GetU32_BE(map_size);
-
-#ifndef EXTENDED_BLOCKS
-			MapState_Read(&map);
+	Mutex_Unlock(map_decoder.mutex);
 #else
-			if (cpe_extBlocks && value) {
-				MapState_Read(&map2);
-			} else {
-				MapState_Read(&map);
-			}
+	res         = MapState_ReadChunk(data, usedLength, upper);
+	progress    = MapState_Progress();
+	allocFailed = MapState_AllocFailed();
 #endif
-		}
-	}
 
-	progress = !map.blocks ? 0.0f : (float)map.index / map_volume;
+	if (res) { DisconnectInvalidMap(res); return; }
+	MapState_CheckAllocFailed(allocFailed);
 	Event_RaiseFloat(&WorldEvents.Loading, progress);
 }
 
@@ -536,6 +701,15 @@ static void Classic_LevelFinalise(cc_uint8* data) {
 	int width, height, length;
 	cc_uint64 end;
 	int delta;
+#ifdef MAP_DECODE_THREAD
+	cc_result res;
+
+	/* wait for the rest of the map data to be decompressed */
+	MapDecoder_Join(false);
+	res = map_decoder.result;
+	if (res) { DisconnectInvalidMap(res); return; }
+	MapState_CheckAllocFailed(MapState_AllocFailed());
+#endif
 
 	end   = Stopwatch_Measure();
 	delta = Stopwatch_ElapsedMS(map_receiveBeg, end);
@@ -745,7 +919,7 @@ static void Classic_Tick(void) {
 	if (!classic_receivedFirstPos) return;
 	/* Report end position of each physics tick, rather than current position */
 	/*  (otherwise can miss landing on a block then jumping off of it again) */
-	Classic_WritePosition(p->Interp.Next.Pos, e->Yaw, e->Pitch);
+	Server.SendPosition(p->Interp.Next.Pos, e->Yaw, e->Pitch);
 }
 
 
@@ -885,63 +1059,55 @@ static void CPE_ExtInfo(cc_uint8* data) {
 	CPE_SendCpeExtInfoReply();
 }
 
-static void CPE_ExtEntry(cc_uint8* data) {
-	cc_string ext = UNSAFE_GetString(data);
-	int version   = data[67];
-	Platform_Log2("cpe ext: %s, %i", &ext, &version);
-
-	cpe_serverExtensionsCount--;
-	CPE_SendCpeExtInfoReply();	
-
-	/* update support state */
-	if (String_CaselessEqualsConst(&ext, "HeldBlock")) {
+static void CPE_ApplyExtEntry(const cc_string* ext, int version) {
+	if (String_CaselessEqualsConst(ext, "HeldBlock")) {
 		cpe_sendHeldBlock = true;
-	} else if (String_CaselessEqualsConst(&ext, "MessageTypes")) {
+	} else if (String_CaselessEqualsConst(ext, "MessageTypes")) {
 		cpe_useMessageTypes = true;
-	} else if (String_CaselessEqualsConst(&ext, "ExtPlayerList")) {
+	} else if (String_CaselessEqualsConst(ext, "ExtPlayerList")) {
 		Server.SupportsExtPlayerList = true;
-	} else if (String_CaselessEqualsConst(&ext, "BlockPermissions")) {
+	} else if (String_CaselessEqualsConst(ext, "BlockPermissions")) {
 		cpe_blockPerms = true;
-	} else if (String_CaselessEqualsConst(&ext, "PlayerClick")) {
+	} else if (String_CaselessEqualsConst(ext, "PlayerClick")) {
 		Server.SupportsPlayerClick = true;
-	} else if (String_CaselessEqualsConst(&ext, "EnvMapAppearance")) {
+	} else if (String_CaselessEqualsConst(ext, "EnvMapAppearance")) {
 		cpe_envMapVer = version;
 		if (version == 1) return;
 		Protocol.Sizes[OPCODE_ENV_SET_MAP_APPEARANCE] += 4;
-	} else if (String_CaselessEqualsConst(&ext, "LongerMessages")) {
+	} else if (String_CaselessEqualsConst(ext, "LongerMessages")) {
 		Server.SupportsPartialMessages = true;
-	} else if (String_CaselessEqualsConst(&ext, "FullCP437")) {
+	} else if (String_CaselessEqualsConst(ext, "FullCP437")) {
 		Server.SupportsFullCP437 = true;
-	} else if (String_CaselessEqualsConst(&ext, "BlockDefinitionsExt")) {
+	} else if (String_CaselessEqualsConst(ext, "BlockDefinitionsExt")) {
 		cpe_blockDefsExtVer = version;
 		if (version == 1) return;
 		Protocol.Sizes[OPCODE_DEFINE_BLOCK_EXT] += 3;
-	} else if (String_CaselessEqualsConst(&ext, "ExtEntityPositions")) {
+	} else if (String_CaselessEqualsConst(ext, "ExtEntityPositions")) {
 		Protocol.Sizes[OPCODE_ENTITY_TELEPORT] += 6;
 		Protocol.Sizes[OPCODE_ADD_ENTITY]      += 6;
 		Protocol.Sizes[OPCODE_EXT_ADD_ENTITY2] += 6;
 		Protocol.Sizes[OPCODE_SET_SPAWNPOINT]  += 6;
 		cpe_extEntityPos = true;
-	} else if (String_CaselessEqualsConst(&ext, "TwoWayPing")) {
+	} else if (String_CaselessEqualsConst(ext, "TwoWayPing")) {
 		cpe_twoWayPing = true;
-	} else if (String_CaselessEqualsConst(&ext, "FastMap")) {
+	} else if (String_CaselessEqualsConst(ext, "FastMap")) {
 		Protocol.Sizes[OPCODE_LEVEL_BEGIN] += 4;
 		cpe_fastMap = true;
-	} else if (String_CaselessEqualsConst(&ext, "CustomModels")) {
+	} else if (String_CaselessEqualsConst(ext, "CustomModels")) {
 		cpe_customModelsVer = min(2, version);
 		if (version == 2) {
 			Protocol.Sizes[OPCODE_DEFINE_MODEL_PART] = 167;
 		}
 	}
 #ifdef EXTENDED_TEXTURES
-	else if (String_CaselessEqualsConst(&ext, "ExtendedTextures")) {
+	else if (String_CaselessEqualsConst(ext, "ExtendedTextures")) {
 		Protocol.Sizes[OPCODE_DEFINE_BLOCK]     += 3;
 		Protocol.Sizes[OPCODE_DEFINE_BLOCK_EXT] += 6;
 		cpe_extTextures = true;
 	}
 #endif
 #ifdef EXTENDED_BLOCKS
-	else if (String_CaselessEqualsConst(&ext, "ExtendedBlocks")) {
+	else if (String_CaselessEqualsConst(ext, "ExtendedBlocks")) {
 		if (!Game_AllowCustomBlocks) return;
 		cpe_extBlocks = true;
 
@@ -958,6 +1124,18 @@ static void CPE_ExtEntry(cc_uint8* data) {
 #endif
 }
 
+static void CPE_ExtEntry(cc_uint8* data) {
+	cc_string ext = UNSAFE_GetString(data);
+	int version   = data[67];
+	Platform_Log2("cpe ext: %s, %i", &ext, &version);
+
+	/* NOTE: Packet sizes must be updated before replying, as the server may */
+	/*  start sending packets using the new sizes as soon as it receives the reply */
+	CPE_ApplyExtEntry(&ext, version);
+	cpe_serverExtensionsCount--;
+	CPE_SendCpeExtInfoReply();
+}
+
 static void CPE_SetClickDistance(cc_uint8* data) {
 	LocalPlayer_Instance.ReachDistance = Stream_GetU16_BE(data) / 32.0f;
 }
@@ -1693,7 +1871,7 @@ static void BlockDefs_UndefineBlock(cc_uint8* data) {
 	if (block < BLOCK_CPE_COUNT) { Inventory_AddDefault(block); }
 
 	Block_SetCustomDefined(block, false);
-	Event_RaiseVoid(&BlockEvents.BlockDefChanged);
+	Block_RaiseDefChanged();
 	/* Update sprite BoundingBox if necessary */
 	if (Blocks.Draw[block] == DRAW_SPRITE) Block_RecalculateBB(block);
 }
@@ -1733,6 +1911,26 @@ static void Protocol_Reset(void) {
 	WoM_Reset();
 }
 
+static const char* const opcode_names[OPCODE_COUNT] = {
+	"Handshake", "Ping", "LevelInit", "LevelDataChunk", "LevelFinalise",
+	"SetBlockClient", "SetBlock", "AddEntity", "EntityTeleport",
+	"RelPosAndOrientationUpdate", "RelPosUpdate", "OrientationUpdate", "RemoveEntity",
+	"Message", "Kick", "SetPermission",
+	"ExtInfo", "ExtEntry", "SetClickDistance", "CustomBlockSupportLevel",
+	"HoldThis", "SetTextHotKey", "ExtAddPlayerName", "ExtAddEntity",
+	"ExtRemovePlayerName", "EnvSetColor", "MakeSelection", "RemoveSelection",
+	"SetBlockPermission", "ChangeModel", "EnvSetMapAppearance", "EnvSetWeatherType",
+	"HackControl", "ExtAddEntity2", "PlayerClicked", "DefineBlock",
+	"RemoveBlockDefinition", "DefineBlockExt", "BulkBlockUpdate", "SetTextColor",
+	"SetMapEnvUrl", "SetMapEnvProperty", "SetEntityProperty", "TwoWayPing",
+	"SetInventoryOrder", "SetHotbar", "SetSpawnpoint", "VelocityControl",
+	"DefineEffect", "SpawnEffect", "DefineModel", "DefineModelPart", "UndefineModel"
+};
+
+const char* Protocol_OpcodeName(cc_uint8 opcode) {
+	return opcode < OPCODE_COUNT ? opcode_names[opcode] : NULL;
+}
+
 void Protocol_Tick(void) {
 	Classic_Tick();
 	CPE_Tick();
@@ -56,6 +56,8 @@ extern struct IGameComponent Protocol_Component;
 
 void Protocol_RemoveEntity(EntityID id);
 void Protocol_Tick(void);
+/* Returns the name of the given packet opcode, or NULL if unknown. */
+const char* Protocol_OpcodeName(cc_uint8 opcode);
 
 extern cc_bool cpe_needD3Fix;
 void Classic_SendChat(const cc_string* text, cc_bool partial);
@@ -78,7 +78,7 @@ static struct HUDScreen {
 
 static void HUDScreen_UpdateLine1(struct HUDScreen* s) {
 	cc_string status; char statusBuffer[STRING_SIZE * 2];
-	int indices, ping;
+	int indices, ping, bytes, packets, queued, peak, coalesced;
 	int fps = (int)(s->frames / s->accumulator);
 
 	String_InitArray(status, statusBuffer);
@@ -98,6 +98,14 @@ static void HUDScreen_UpdateLine1(struct HUDScreen* s) {
 
 		ping = Ping_AveragePingMS();
 		if (ping) String_Format1(&status, ", ping %i ms", &ping);
+
+		Net_GetReceiveRate(&bytes, &packets);
+		bytes /= 1024;
+		if (packets) String_Format2(&status, ", %i KB/s (%i packets/s)", &bytes, &packets);
+
+		Net_GetSendBacklog(&queued, &peak, &coalesced);
+		queued /= 1024;
+		if (queued) String_Format1(&status, ", %i KB unsent", &queued);
 	}
 	TextWidget_Set(&s->line1, &status, &s->font);
 }
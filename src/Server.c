@@ -24,6 +24,10 @@
 #include "Platform.h"
 #include "Input.h"
 #include "Errors.h"
+#include "Options.h"
+#include "Utils.h"
+#include "Stream.h"
+#include "Deflate.h"
 
 static char nameBuffer[STRING_SIZE];
 static char motdBuffer[STRING_SIZE];
@@ -210,27 +214,202 @@ static void SPConnection_Init(void) {
 /*########################################################################################################################*
 *--------------------------------------------------Multiplayer connection-------------------------------------------------*
 *#########################################################################################################################*/
+/* Reading from the socket and splitting the data into packets happens on a dedicated thread, */
+/*  so that slow frames don't delay receiving data (and vice versa). Packets are then passed */
+/*  to the main thread through a single producer single consumer ring buffer. */
+/* NOTE: The receive thread reads Protocol.Sizes/Handlers without locking. This is fine because */
+/*  these only change while processing ExtInfo/ExtEntry, and the server can only start using */
+/*  the new packet sizes after it has received the client's reply to those packets. */
+#if defined CC_BUILD_WEB
+/* Threads are not supported */
+#elif defined __ATOMIC_ACQUIRE
+#define NET_RECV_THREAD
+#define NetRing_Load(var)       __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#define NetRing_Store(var, val) __atomic_store_n(&(var), val, __ATOMIC_RELEASE)
+#elif defined _MSC_VER && (defined _M_IX86 || defined _M_X64)
+#define NET_RECV_THREAD
+/* MSVC gives volatile accesses acquire/release semantics on x86 */
+#define NetRing_Load(var)       (var)
+#define NetRing_Store(var, val) (var) = (val)
+#endif
+
 static cc_socket net_socket;
-static cc_uint8  net_readBuffer[4096 * 5];
 static cc_uint8  net_writeBuffer[131];
-static cc_uint8* net_readCurrent;
+#ifndef NET_RECV_THREAD
+/* Received data that hasn't been processed yet (grows when lots of data arrives at once) */
+static cc_uint8  net_defaultBuffer[4096 * 5];
+static cc_uint8* net_readBuffer   = net_defaultBuffer;
+static cc_uint32 net_readCapacity = sizeof(net_defaultBuffer);
+static cc_uint32 net_readUsed;
+#endif
+/* Time budget per tick for processing received packets */
+#define NET_TICK_BUDGET_US 5000
 
 static cc_bool net_writeFailed;
 static double lastPacket;
 static cc_uint8 lastOpcode;
 
+/* Bytes and packets processed since start of current measurement period */
+static struct NetStats {
+	cc_uint32 bytes, packets;
+	int bytesRate, packetsRate;
+	double start;
+} net_stats;
+#define NetStats_Add(size) net_stats.bytes += (size); net_stats.packets++;
+
+static void NetStats_Reset(void) {
+	net_stats.bytes   = 0; net_stats.bytesRate   = 0;
+	net_stats.packets = 0; net_stats.packetsRate = 0;
+	net_stats.start   = Game.Time;
+}
+
+static void NetStats_Update(void) {
+	double elapsed = Game.Time - net_stats.start;
+	if (elapsed < 1.0) return;
+
+	net_stats.bytesRate   = (int)(net_stats.bytes   / elapsed);
+	net_stats.packetsRate = (int)(net_stats.packets / elapsed);
+	net_stats.bytes   = 0;
+	net_stats.packets = 0;
+	net_stats.start   = Game.Time;
+}
+
+void Net_GetReceiveRate(int* bytesPerSec, int* packetsPerSec) {
+	*bytesPerSec   = net_stats.bytesRate;
+	*packetsPerSec = net_stats.packetsRate;
+}
+
+/* Packet captures are a header, followed by a record for each received packet in order of processing */
+/* Each record is the time in milliseconds since capture started, the packet length, then the packet */
+static const cc_uint8 capture_magic[8] = { 'C','C','N','E','T','C','A','P' };
+#define CAPTURE_VERSION     1
+#define CAPTURE_HEADER_SIZE 12
+#define CAPTURE_RECORD_SIZE 6
+
+static struct NetCapture {
+	struct Stream file;
+	cc_uint8* buffer;
+	cc_uint32 used;
+	cc_uint64 start;
+} net_capture;
+#define NET_CAPTURE_SIZE (64 * 1024)
+
+static void NetCapture_Close(void);
+static void NetCapture_Flush(void) {
+	cc_result res;
+	if (!net_capture.used) return;
+
+	res = Stream_Write(&net_capture.file, net_capture.buffer, net_capture.used);
+	net_capture.used = 0;
+	if (!res) return;
+
+	Logger_SysWarn(res, "writing packet capture");
+	NetCapture_Close();
+}
+
+static void NetCapture_Open(void) {
+	cc_string path; char pathBuffer[FILENAME_SIZE];
+	struct DateTime now;
+	cc_result res;
+	/* Finish off the capture from the previous connection */
+	NetCapture_Close();
+	if (!Options_GetBool(OPT_CAPTURE_PACKETS, false)) return;
+	if (!Utils_EnsureDirectory("captures")) return;
+
+	DateTime_CurrentLocal(&now);
+	String_InitArray(path, pathBuffer);
+	String_Format3(&path, "captures/%p4-%p2-%p2", &now.year, &now.month, &now.day);
+	String_Format3(&path, "-%p2-%p2-%p2.cap", &now.hour, &now.minute, &now.second);
+
+	res = Stream_CreateFile(&net_capture.file, &path);
+	if (res) { Logger_SysWarn2(res, "creating", &path); return; }
+
+	net_capture.buffer = (cc_uint8*)Mem_Alloc(NET_CAPTURE_SIZE, 1, "packet capture buffer");
+	net_capture.start  = Stopwatch_Measure();
+
+	Mem_Copy(net_capture.buffer, capture_magic, sizeof(capture_magic));
+	Stream_SetU32_LE(net_capture.buffer + 8, CAPTURE_VERSION);
+	net_capture.used = CAPTURE_HEADER_SIZE;
+	Platform_Log1("Capturing packets to %s", &path);
+}
+
+static void NetCapture_Packet(const cc_uint8* data, int len) {
+	cc_uint32 time;
+	if (!net_capture.buffer) return;
+
+	if (net_capture.used + CAPTURE_RECORD_SIZE + len > NET_CAPTURE_SIZE) {
+		NetCapture_Flush();
+		if (!net_capture.buffer) return;
+	}
+	time = (cc_uint32)(Stopwatch_ElapsedMicroseconds(net_capture.start, Stopwatch_Measure()) / 1000);
+
+	Stream_SetU32_LE(net_capture.buffer + net_capture.used,     time);
+	Stream_SetU16_LE(net_capture.buffer + net_capture.used + 4, len);
+	Mem_Copy(net_capture.buffer + net_capture.used + CAPTURE_RECORD_SIZE, data, len);
+	net_capture.used += CAPTURE_RECORD_SIZE + len;
+}
+
+static void NetCapture_Close(void) {
+	cc_uint8* buffer = net_capture.buffer;
+	cc_result res;
+	if (!buffer) return;
+
+	NetCapture_Flush();
+	/* flushing might have failed and already closed the capture */
+	if (!net_capture.buffer) return;
+
+	net_capture.buffer = NULL;
+	Mem_Free(buffer);
+	res = net_capture.file.Close(&net_capture.file);
+	if (res) Logger_SysWarn(res, "closing packet capture");
+}
+
+cc_bool Net_ProfilePackets;
+struct NetPacketProfile Net_PacketProfiles[256];
+
+/* Calls the handler for a received packet, updating statistics */
+static void Net_HandlePacket(Net_Handler handler, cc_uint8* packet, int len) {
+	struct NetPacketProfile* prof;
+	cc_uint8 opcode = packet[0];
+	cc_uint32 elapsed;
+	cc_uint64 beg;
+
+	NetStats_Add(len);
+	NetCapture_Packet(packet, len);
+	if (!Net_ProfilePackets) { handler(packet + 1); return; } /* skip opcode */
+
+	beg = Stopwatch_Measure();
+	handler(packet + 1);
+	elapsed = (cc_uint32)Stopwatch_ElapsedMicroseconds(beg, Stopwatch_Measure());
+
+	prof = &Net_PacketProfiles[opcode];
+	prof->packets++;
+	prof->bytes       += len;
+	prof->totalMicros += elapsed;
+	prof->maxMicros    = max(prof->maxMicros, elapsed);
+}
+
 static cc_bool net_connecting;
 static double net_connectTimeout;
 #define NET_TIMEOUT_SECS 15
 
 static void OnClose(void);
+#ifdef NET_RECV_THREAD
+static void NetRecv_Start(void);
+#endif
 static void MPConnection_FinishConnect(void) {
 	net_connecting = false;
 	Event_RaiseVoid(&NetEvents.Connected);
 	Event_RaiseFloat(&WorldEvents.Loading, 0.0f);
 
-	net_readCurrent    = net_readBuffer;
 	Server.WriteBuffer = net_writeBuffer;
+#ifdef NET_RECV_THREAD
+	NetRecv_Start();
+#else
+	net_readUsed       = 0;
+#endif
+	NetStats_Reset();
+	NetCapture_Open();
 
 	Classic_SendLogin();
 	lastPacket = Game.Time;
@@ -308,6 +487,105 @@ static void MPConnection_BeginConnect(void) {
 	}
 }
 
+/* Data that could not be written to the socket yet (send buffer full) */
+static struct NetSendQueue {
+	cc_uint8* buffer;
+	cc_uint32 used, capacity;
+	/* Offset and length of last queued position packet that hasn't started being sent */
+	cc_uint32 posOffset, posLen;
+	/* Backpressure statistics for current connection */
+	cc_uint32 peak, coalesced;
+} net_send;
+/* Server has stopped reading if this much data is backed up */
+#define NET_MAX_SEND (512 * 1024)
+
+/* Writes as much data as possible without blocking, returning number of bytes written */
+static cc_uint32 NetSend_Write(const cc_uint8* data, cc_uint32 len) {
+	cc_uint32 wrote, total = 0;
+	cc_result res;
+
+	while (len) {
+		res = Socket_Write(net_socket, data, len, &wrote);
+		if (res == ReturnCode_SocketInProgess || res == ReturnCode_SocketWouldBlock) break;
+
+		/* NOTE: Not immediately disconnecting here, as otherwise we sometimes miss out on kick messages */
+		if (res || !wrote) { net_writeFailed = true; break; }
+		data += wrote; len -= wrote; total += wrote;
+	}
+	return total;
+}
+
+/* Writes as much queued data as possible without blocking */
+static void NetSend_Flush(void) {
+	cc_uint32 i, wrote;
+	if (!net_send.used || net_writeFailed) return;
+
+	wrote = NetSend_Write(net_send.buffer, net_send.used);
+	if (!wrote) return;
+	net_send.used -= wrote;
+	for (i = 0; i < net_send.used; i++) {
+		net_send.buffer[i] = net_send.buffer[wrote + i];
+	}
+
+	if (net_send.posOffset < wrote) {
+		net_send.posLen = 0;
+	} else {
+		net_send.posOffset -= wrote;
+	}
+}
+
+static void NetSend_Enqueue(const cc_uint8* data, cc_uint32 len) {
+	cc_uint32 required = net_send.used + len;
+	cc_uint32 capacity;
+
+	if (required > NET_MAX_SEND) { net_writeFailed = true; return; }
+	if (required > net_send.capacity) {
+		capacity = max(net_send.capacity * 2, max(required, 4096));
+		if (net_send.buffer) {
+			net_send.buffer = (cc_uint8*)Mem_Realloc(net_send.buffer, capacity, 1, "network send buffer");
+		} else {
+			net_send.buffer = (cc_uint8*)Mem_Alloc(capacity, 1, "network send buffer");
+		}
+		net_send.capacity = capacity;
+	}
+
+	Mem_Copy(net_send.buffer + net_send.used, data, len);
+	net_send.used = required;
+	net_send.peak = max(net_send.peak, required);
+}
+
+static void NetSend_Free(void) {
+	if (net_send.peak) {
+		Platform_Log2("Outbound data backed up by up to %i bytes, %i stale positions dropped",
+			&net_send.peak, &net_send.coalesced);
+	}
+	Mem_Free(net_send.buffer);
+	Mem_Set(&net_send, 0, sizeof(net_send));
+}
+
+static void MPConnection_QueueData(const cc_uint8* data, cc_uint32 len, cc_bool isPosition) {
+	cc_uint32 wrote;
+	if (Server.Disconnected || net_writeFailed) return;
+	NetSend_Flush();
+
+	if (!net_send.used) {
+		wrote = NetSend_Write(data, len);
+		data += wrote; len -= wrote;
+		if (!len || net_writeFailed) return;
+	} else if (isPosition && net_send.posLen == len) {
+		/* Only the most recent position matters, so overwrite the stale one still waiting to be sent */
+		Mem_Copy(net_send.buffer + net_send.posOffset, data, len);
+		net_send.coalesced++;
+		return;
+	}
+
+	if (isPosition) {
+		net_send.posOffset = net_send.used;
+		net_send.posLen    = len;
+	}
+	NetSend_Enqueue(data, len);
+}
+
 static void MPConnection_SendBlock(int x, int y, int z, BlockID old, BlockID now) {
 	if (now == BLOCK_AIR) {
 		now = Inventory_SelectedBlock;
@@ -331,8 +609,12 @@ static void MPConnection_SendChat(const cc_string* text) {
 }
 
 static void MPConnection_SendPosition(Vec3 pos, float yaw, float pitch) {
+	cc_uint32 len;
 	Classic_WritePosition(pos, yaw, pitch);
-	Net_SendPacket();
+
+	len = (cc_uint32)(Server.WriteBuffer - net_writeBuffer);
+	Server.WriteBuffer = net_writeBuffer;
+	MPConnection_QueueData(net_writeBuffer, len, true);
 }
 
 static void MPConnection_CheckDisconnection(void) {
@@ -360,77 +642,391 @@ static void DisconnectInvalidOpcode(cc_uint8 opcode) {
 	Game_Disconnect(&title, &tmp); return;
 }
 
-static void MPConnection_Tick(struct ScheduledTask* task) {
-	static const cc_string title_lost  = String_FromConst("&eLost connection to the server");
-	static const cc_string reason_err  = String_FromConst("I/O error when reading packets");
-	cc_string msg; char msgBuffer[STRING_SIZE * 2];
-	cc_uint32 pending;
-	cc_uint8* readEnd;
-	Net_Handler handler;
-	int i, remaining;
-	cc_result res;
+#ifdef NET_RECV_THREAD
+/* Size of the ring buffer (must be a power of two) */
+#define NET_RING_SIZE (256 * 1024)
+#define NET_RING_MASK (NET_RING_SIZE - 1)
+#define NET_RECV_SIZE (64 * 1024)
+
+/* Each packet in the ring buffer is prefixed by a 2 byte header, and padded to 2 byte alignment */
+/* The lower bits of the header are the packet length, the upper bits are flags */
+/* Header of 0 means rest of ring buffer is unused, and the next packet starts at the beginning */
+#define NET_RECORD_WRAP    0x0000
+#define NET_RECORD_LENGTH  0x3FFF
+/* Set when the record is a bogus byte from D3 servers that was skipped (see NetRecv_FramePackets) */
+#define NET_RECORD_D3SKIP  0x4000
+/* Set when a packet was processed ahead of the packets before it */
+#define NET_RECORD_HANDLED 0x8000
+#define NetRecord_Size(header) ((2 + ((header) & NET_RECORD_LENGTH) + 1) & ~1)
+
+enum NET_RECV_STATUS { NET_RECV_RUNNING, NET_RECV_ERROR, NET_RECV_CLOSED, NET_RECV_INVALID };
+static struct NetRecvThread {
+	void* handle;
+	cc_uint8* ring;
+	cc_uint8* buffer;
+	/* head is only written by the receive thread, tail is only written by the main thread */
+	/* NOTE: Other thread must access these through NetRing_Load/NetRing_Store */
+	volatile cc_uint32 head, tail;
+	volatile cc_bool stop;
+	volatile int status;
+	cc_result result;
+	cc_uint8 invalidOpcode, lastOpcode;
+} net_recv;
+
+/* Copies a packet into the ring buffer, blocking until there's enough space free */
+static cc_bool NetRing_Push(const cc_uint8* data, int len, int flags) {
+	cc_uint32 head = net_recv.head, tail, offset;
+	int size = NetRecord_Size(len), required;
+	cc_uint8* dst;
+
+	offset   = head & NET_RING_MASK;
+	/* packet must be contiguous, so may need to wrap around to start of buffer */
+	required = (NET_RING_SIZE - offset) < size ? (NET_RING_SIZE - offset) + size : size;
+
+	for (;;) {
+		tail = NetRing_Load(net_recv.tail);
+		if (NET_RING_SIZE - (head - tail) >= required) break;
+
+		/* main thread hasn't caught up yet */
+		if (NetRing_Load(net_recv.stop)) return false;
+		Thread_Sleep(1);
+	}
 
-	if (Server.Disconnected) return;
-	if (net_connecting) { MPConnection_TickConnect(); return; }
+	if (required != size) {
+		dst = net_recv.ring + offset;
+		dst[0] = NET_RECORD_WRAP; dst[1] = NET_RECORD_WRAP;
+		head  += NET_RING_SIZE - offset;
+		offset = 0;
+	}
 
-	/* Over 30 seconds since last packet, connection likely dropped */
-	if (lastPacket + 30 < Game.Time) MPConnection_CheckDisconnection();
-	if (Server.Disconnected) return;
+	dst = net_recv.ring + offset;
+	flags |= len;
+	dst[0] = (cc_uint8)flags; dst[1] = (cc_uint8)(flags >> 8);
+	Mem_Copy(dst + 2, data, len);
+
+	/* NOTE: Release store, so packet data is visible to main thread before the new head is */
+	NetRing_Store(net_recv.head, head + size);
+	return true;
+}
+
+static void NetRecv_Fail(int status, cc_result res) {
+	net_recv.result = res;
+	/* NOTE: Release store, so packets pushed before this are visible to main thread first */
+	NetRing_Store(net_recv.status, status);
+}
+
+/* Splits received data into packets, returning number of bytes consumed */
+static int NetRecv_FramePackets(cc_uint8* data, int len) {
+	cc_uint8* cur = data;
+	cc_uint8* end = data + len;
+	cc_uint8 opcode;
+	int size;
+
+	while (cur < end) {
+		opcode = cur[0];
+
+		/* Workaround for older D3 servers which wrote one byte too many for HackControl packets */
+		if (cpe_needD3Fix && net_recv.lastOpcode == OPCODE_HACK_CONTROL && (opcode == 0x00 || opcode == 0xFF)) {
+			if (!NetRing_Push(cur, 1, NET_RECORD_D3SKIP)) break;
+			cur++; continue;
+		}
+
+		if (!Protocol.Handlers[opcode]) {
+			net_recv.invalidOpcode = opcode;
+			NetRecv_Fail(NET_RECV_INVALID, 0);
+			break;
+		}
+
+		size = Protocol.Sizes[opcode];
+		if (cur + size > end) break;
+		if (!NetRing_Push(cur, size, 0)) break;
 
-	pending = 0;
-	res     = Socket_Available(net_socket, &pending);
-	readEnd = net_readCurrent; /* todo change to int remaining instead */
+		net_recv.lastOpcode = opcode;
+		cur += size;
+	}
+	return (int)(cur - data);
+}
+
+static void NetRecv_ThreadMain(void) {
+	int i, used = 0, consumed;
+	cc_uint32 read;
+	cc_bool readable;
+	cc_result res;
+
+	while (!NetRing_Load(net_recv.stop)) {
+		res = Socket_PollFor(net_socket, SOCKET_POLL_READ, 50, &readable);
+		if (res) { NetRecv_Fail(NET_RECV_ERROR, res); return; }
+		if (!readable) continue;
 
-	if (!res && pending) {
-		/* NOTE: Always using a read call that is a multiple of 4096 (appears to?) improve read performance */	
-		res = Socket_Read(net_socket, net_readCurrent, 4096 * 4, &pending);
+		res = Socket_Read(net_socket, net_recv.buffer + used, NET_RECV_SIZE - used, &read);
 		/* Ignore errors for 'no data available for non-blocking read' */
-		if (res) {
-			if (res == ReturnCode_SocketInProgess)  return;
-			if (res == ReturnCode_SocketWouldBlock) return;
+		if (res == ReturnCode_SocketInProgess || res == ReturnCode_SocketWouldBlock) continue;
+
+		if (res)   { NetRecv_Fail(NET_RECV_ERROR,  res); return; }
+		/* 0 bytes read from a readable socket means the server closed the connection */
+		if (!read) { NetRecv_Fail(NET_RECV_CLOSED, 0);   return; }
+
+		used    += read;
+		consumed = NetRecv_FramePackets(net_recv.buffer, used);
+		if (NetRing_Load(net_recv.status) == NET_RECV_INVALID) return;
+
+		/* Protocol packets might be split up across TCP packets */
+		/* If so, copy last few unprocessed bytes back to beginning of buffer */
+		used -= consumed;
+		for (i = 0; i < used; i++) {
+			net_recv.buffer[i] = net_recv.buffer[consumed + i];
 		}
-		readEnd += pending;
 	}
+}
 
-	if (res) {
+static void NetRecv_Start(void) {
+	net_recv.ring   = (cc_uint8*)Mem_Alloc(NET_RING_SIZE, 1, "network ring buffer");
+	net_recv.buffer = (cc_uint8*)Mem_Alloc(NET_RECV_SIZE, 1, "network receive buffer");
+	net_recv.head   = 0;
+	net_recv.tail   = 0;
+	net_recv.stop   = false;
+	net_recv.status = NET_RECV_RUNNING;
+	net_recv.lastOpcode = 0;
+	net_recv.handle = Thread_Start(NetRecv_ThreadMain);
+}
+
+static void NetRecv_Stop(void) {
+	if (!net_recv.handle) return;
+	NetRing_Store(net_recv.stop, true);
+	Thread_Join(net_recv.handle);
+	net_recv.handle = NULL;
+
+	Mem_Free(net_recv.ring);
+	Mem_Free(net_recv.buffer);
+	net_recv.ring   = NULL;
+	net_recv.buffer = NULL;
+}
+
+/* Whether the given packet should still be processed once the tick's time budget is used up */
+/* (these packets are small and cheap to process, but are very noticeable if delayed) */
+static cc_bool NetRecv_IsUrgent(cc_uint8 opcode) {
+	return opcode == OPCODE_SET_BLOCK          || opcode == OPCODE_BULK_BLOCK_UPDATE
+		|| opcode == OPCODE_ENTITY_TELEPORT    || opcode == OPCODE_RELPOS_AND_ORI_UPDATE
+		|| opcode == OPCODE_RELPOS_UPDATE      || opcode == OPCODE_ORI_UPDATE
+		|| opcode == OPCODE_PING               || opcode == OPCODE_TWO_WAY_PING;
+}
+
+/* Processes a packet from the ring buffer, returning false if connection was closed */
+static cc_bool NetRecv_Handle(cc_uint8* data, int header) {
+	cc_uint8 opcode = data[0];
+	int len = header & NET_RECORD_LENGTH;
+	Net_Handler handler;
+
+	if (header & NET_RECORD_D3SKIP) {
+		Platform_LogConst("Skipping invalid HackControl byte from D3 server");
+		LocalPlayer_ResetJumpVelocity();
+		return true;
+	}
+
+	handler = Protocol.Handlers[opcode];
+	if (!handler) { DisconnectInvalidOpcode(opcode); return false; }
+
+	lastOpcode = opcode;
+	lastPacket = Game.Time;
+	Net_HandlePacket(handler, data, len);
+	/* handler might have disconnected (e.g. kick packet), which also frees the ring buffer */
+	return !Server.Disconnected;
+}
+
+/* Processes packets received by the network thread, until out of packets or time budget */
+/* Once out of time, urgent packets are still processed, even if they are queued behind */
+/*  map data packets (which is safe since map data packets just decompress into a buffer) */
+static void NetRecv_Process(void) {
+	static const cc_string title_lost = String_FromConst("&eLost connection to the server");
+	static const cc_string reason_err = String_FromConst("I/O error when reading packets");
+	static const cc_string title_dc   = String_FromConst("Disconnected!");
+	static const cc_string reason_dc  = String_FromConst("You've lost connection to the server");
+	cc_string msg; char msgBuffer[STRING_SIZE * 2];
+	cc_uint32 head, tail, cur;
+	cc_bool outOfTime = false, skipping = false;
+	cc_uint64 beg = Stopwatch_Measure();
+	cc_uint8* data;
+	int status, header, size;
+	cc_result res;
+
+	/* NOTE: Status must be read first, so that all packets pushed before it changed are visible */
+	status = NetRing_Load(net_recv.status);
+	head   = NetRing_Load(net_recv.head);
+	tail   = net_recv.tail;
+
+	for (cur = tail; cur != head; cur += size) {
+		data = net_recv.ring + (cur & NET_RING_MASK);
+		header = data[0] | (data[1] << 8);
+
+		if (header == NET_RECORD_WRAP) {
+			size = NET_RING_SIZE - (cur & NET_RING_MASK);
+		} else {
+			size = NetRecord_Size(header);
+			if (header & NET_RECORD_HANDLED) {
+				/* already processed earlier */
+			} else if (!outOfTime || NetRecv_IsUrgent(data[2])) {
+				if (!NetRecv_Handle(data + 2, header)) return;
+				/* mark as processed, so it's skipped over when the map data before it is processed */
+				if (skipping) data[1] |= NET_RECORD_HANDLED >> 8;
+
+				outOfTime = Stopwatch_ElapsedMicroseconds(beg, Stopwatch_Measure()) >= NET_TICK_BUDGET_US;
+			} else if (data[2] == OPCODE_LEVEL_DATA) {
+				skipping = true;
+			} else {
+				break;
+			}
+		}
+		if (!skipping) tail = cur + size;
+	}
+
+	NetRing_Store(net_recv.tail, tail);
+	if (tail != head || status == NET_RECV_RUNNING) return;
+
+	/* Only act on receive thread failing after all the packets before it have been processed */
+	if (status == NET_RECV_INVALID) {
+		DisconnectInvalidOpcode(net_recv.invalidOpcode);
+	} else if (status == NET_RECV_CLOSED) {
+		Game_Disconnect(&title_dc, &reason_dc);
+	} else {
+		res = net_recv.result;
 		String_InitArray(msg, msgBuffer);
 		String_Format3(&msg, "Error reading from %s:%i: %i" _NL, &Server.Address, &Server.Port, &res);
 
 		Logger_Log(&msg);
 		Game_Disconnect(&title_lost, &reason_err);
-		return;
 	}
+}
+#endif
 
-	net_readCurrent = net_readBuffer;
-	while (net_readCurrent < readEnd) {
-		cc_uint8 opcode = net_readCurrent[0];
+#ifndef NET_RECV_THREAD
+/* Largest amount of data read from the socket in one call */
+#define NET_MAX_READ (256 * 1024)
+
+static void MPConnection_GrowReadBuffer(cc_uint32 required) {
+	cc_uint32 capacity = max(net_readCapacity * 2, required);
+
+	if (net_readBuffer == net_defaultBuffer) {
+		net_readBuffer = (cc_uint8*)Mem_Alloc(capacity, 1, "network read buffer");
+		Mem_Copy(net_readBuffer, net_defaultBuffer, net_readUsed);
+	} else {
+		net_readBuffer = (cc_uint8*)Mem_Realloc(net_readBuffer, capacity, 1, "network read buffer");
+	}
+	net_readCapacity = capacity;
+}
+
+static void MPConnection_FreeReadBuffer(void) {
+	if (net_readBuffer != net_defaultBuffer) Mem_Free(net_readBuffer);
+	net_readBuffer   = net_defaultBuffer;
+	net_readCapacity = sizeof(net_defaultBuffer);
+	net_readUsed     = 0;
+}
+
+/* Processes all complete packets in the read buffer, until out of time budget */
+/* Returns false if the connection was closed while processing a packet */
+static cc_bool MPConnection_ProcessPackets(cc_uint64 beg) {
+	cc_uint8* cur = net_readBuffer;
+	cc_uint8* end = net_readBuffer + net_readUsed;
+	Net_Handler handler;
+	cc_uint8 opcode;
+	cc_uint32 i;
+	int size;
+
+	while (cur < end) {
+		opcode = cur[0];
 
 		/* Workaround for older D3 servers which wrote one byte too many for HackControl packets */
 		if (cpe_needD3Fix && lastOpcode == OPCODE_HACK_CONTROL && (opcode == 0x00 || opcode == 0xFF)) {
 			Platform_LogConst("Skipping invalid HackControl byte from D3 server");
-			net_readCurrent++;
+			cur++;
 			LocalPlayer_ResetJumpVelocity();
 			continue;
 		}
 
-		if (net_readCurrent + Protocol.Sizes[opcode] > readEnd) break;
+		size = Protocol.Sizes[opcode];
+		if (cur + size > end) break;
 		handler = Protocol.Handlers[opcode];
-		if (!handler) { DisconnectInvalidOpcode(opcode); return; }
+		if (!handler) { DisconnectInvalidOpcode(opcode); return false; }
 
 		lastOpcode = opcode;
 		lastPacket = Game.Time;
-		handler(net_readCurrent + 1); /* skip opcode */
-		net_readCurrent += Protocol.Sizes[opcode];
+		Net_HandlePacket(handler, cur, size);
+		cur += size;
+
+		/* handler might have disconnected (e.g. kick packet), which also frees the read buffer */
+		if (Server.Disconnected) return false;
+		if (Stopwatch_ElapsedMicroseconds(beg, Stopwatch_Measure()) >= NET_TICK_BUDGET_US) break;
 	}
 
 	/* Protocol packets might be split up across TCP packets */
 	/* If so, copy last few unprocessed bytes back to beginning of buffer */
 	/* These bytes are then later combined with subsequently read TCP packet data */
-	remaining = (int)(readEnd - net_readCurrent);
-	for (i = 0; i < remaining; i++) {
-		net_readBuffer[i] = net_readCurrent[i];
+	net_readUsed = (cc_uint32)(end - cur);
+	for (i = 0; i < net_readUsed; i++) {
+		net_readBuffer[i] = cur[i];
 	}
-	net_readCurrent = net_readBuffer + remaining;
+	return true;
+}
+
+/* Reads and processes all available data, until out of time budget */
+static void MPConnection_ReadPackets(void) {
+	static const cc_string title_lost  = String_FromConst("&eLost connection to the server");
+	static const cc_string reason_err  = String_FromConst("I/O error when reading packets");
+	cc_string msg; char msgBuffer[STRING_SIZE * 2];
+	cc_uint64 beg = Stopwatch_Measure();
+	cc_uint32 read;
+	int pending;
+	cc_result res = 0;
+
+	/* Process packets left over from last tick first */
+	if (!MPConnection_ProcessPackets(beg)) return;
+
+	while (Stopwatch_ElapsedMicroseconds(beg, Stopwatch_Measure()) < NET_TICK_BUDGET_US) {
+		pending = 0;
+		res     = Socket_Available(net_socket, &pending);
+		if (res || pending <= 0) break;
+
+		pending = min(pending, NET_MAX_READ);
+		if (net_readCapacity - net_readUsed < (cc_uint32)pending) {
+			MPConnection_GrowReadBuffer(net_readUsed + pending);
+		}
+
+		res = Socket_Read(net_socket, net_readBuffer + net_readUsed, net_readCapacity - net_readUsed, &read);
+		/* Ignore errors for 'no data available for non-blocking read' */
+		if (res == ReturnCode_SocketInProgess || res == ReturnCode_SocketWouldBlock) { res = 0; break; }
+		if (res || !read) break;
+
+		net_readUsed += read;
+		if (!MPConnection_ProcessPackets(beg)) return;
+	}
+	if (!res) return;
+
+	String_InitArray(msg, msgBuffer);
+	String_Format3(&msg, "Error reading from %s:%i: %i" _NL, &Server.Address, &Server.Port, &res);
+
+	Logger_Log(&msg);
+	Game_Disconnect(&title_lost, &reason_err);
+}
+#endif
+
+static void MPConnection_Tick(struct ScheduledTask* task) {
+	if (Server.Disconnected) return;
+	if (net_connecting) { MPConnection_TickConnect(); return; }
+
+	/* Over 30 seconds since last packet, connection likely dropped */
+	if (lastPacket + 30 < Game.Time) MPConnection_CheckDisconnection();
+	if (Server.Disconnected) return;
+
+	/* Servers often send many block definitions at once, so only update culling once afterwards */
+	Block_BeginDeferredUpdates();
+#ifdef NET_RECV_THREAD
+	NetRecv_Process();
+#else
+	MPConnection_ReadPackets();
+#endif
+	Block_EndDeferredUpdates();
+	if (Server.Disconnected) return;
+	NetStats_Update();
+	NetSend_Flush();
 
 	/* Network is ticked 60 times a second. We only send position updates 20 times a second */
 	if ((ticks % 3) == 0) {
@@ -443,25 +1039,7 @@ static void MPConnection_Tick(struct ScheduledTask* task) {
 }
 
 static void MPConnection_SendData(const cc_uint8* data, cc_uint32 len) {
-	cc_uint32 wrote;
-	cc_result res;
-	int tries = 0;
-	if (Server.Disconnected) return;
-
-	while (len) {
-		res = Socket_Write(net_socket, data, len, &wrote);
-		/* If sending would block (send buffer full), retry for a bit up to 10 seconds */
-		/* TODO: Avoid doing this and manually buffer data when this happens */
-		if (res && tries < 1000 && (res == ReturnCode_SocketInProgess || res == ReturnCode_SocketWouldBlock)) {
-			Thread_Sleep(10);
-			tries++;
-			continue;
-		}
-
-		/* NOTE: Not immediately disconnecting here, as otherwise we sometimes miss out on kick messages */
-		if (res || !wrote) { net_writeFailed = true; return; }
-		data += wrote; len -= wrote;
-	}
+	MPConnection_QueueData(data, len, false);
 }
 
 void Net_SendPacket(void) {
@@ -470,6 +1048,12 @@ void Net_SendPacket(void) {
 	Server.SendData(net_writeBuffer, len);
 }
 
+void Net_GetSendBacklog(int* queuedBytes, int* peakBytes, int* coalesced) {
+	*queuedBytes = net_send.used;
+	*peakBytes   = net_send.peak;
+	*coalesced   = net_send.coalesced;
+}
+
 static void MPConnection_Init(void) {
 	Server_ResetState();
 	Server.IsSinglePlayer = false;
@@ -481,11 +1065,636 @@ static void MPConnection_Init(void) {
 	Server.SendPosition = MPConnection_SendPosition;
 	Server.SendData     = MPConnection_SendData;
 
-	net_readCurrent    = net_readBuffer;
 	Server.WriteBuffer = net_writeBuffer;
 }
 
 
+/*########################################################################################################################*
+*----------------------------------------------------Replay connection----------------------------------------------------*
+*#########################################################################################################################*/
+/* Feeds the packets from a packet capture back through the protocol handlers */
+/*  (either at the speed they were originally received, or as fast as possible) */
+static struct ReplayState {
+	cc_uint8* data;
+	cc_uint32 length, offset;
+	cc_uint32 packets;
+	cc_uint64 start;
+	cc_bool maxSpeed, finished;
+} replay;
+
+static cc_bool ReplayConnection_IsCapture(const cc_string* path) {
+	static const cc_string ext = String_FromConst(".cap");
+	return String_CaselessEnds(path, &ext) && File_Exists(path);
+}
+
+static cc_result ReplayConnection_Load(const cc_string* path) {
+	struct Stream stream;
+	cc_result res;
+	if ((res = Stream_OpenFile(&stream, path))) return res;
+
+	if (!(res = stream.Length(&stream, &replay.length))) {
+		replay.data = (cc_uint8*)Mem_TryAlloc(replay.length, 1);
+		if (!replay.data) {
+			res = ERR_OUT_OF_MEMORY;
+		} else {
+			res = Stream_Read(&stream, replay.data, replay.length);
+		}
+	}
+	stream.Close(&stream);
+	if (res) return res;
+
+	if (replay.length < CAPTURE_HEADER_SIZE || !Mem_Equal(replay.data, capture_magic, sizeof(capture_magic))
+		|| Stream_GetU32_LE(replay.data + 8) != CAPTURE_VERSION) return NET_ERR_CAPTURE_SIG;
+	return 0;
+}
+
+static void ReplayConnection_BeginConnect(void) {
+	static const cc_string title  = String_FromConst("Failed to replay packet capture");
+	static const cc_string reason  = String_FromConst("The capture file could not be read");
+	static const cc_string logName = String_FromConst("Replay");
+	cc_string path = Game_Username;
+	cc_result res;
+
+	Blocks.CanPlace[BLOCK_AIR] = false;
+	Chat_SetLogName(&logName);
+	Event_RaiseVoid(&NetEvents.Connected);
+
+	res = ReplayConnection_Load(&path);
+	if (res) {
+		Logger_SysWarn2(res, "loading", &path);
+		Game_Disconnect(&title, &reason);
+		return;
+	}
+
+	replay.offset   = CAPTURE_HEADER_SIZE;
+	replay.maxSpeed = Options_GetBool(OPT_REPLAY_MAX_SPEED, false);
+	replay.start    = Stopwatch_Measure();
+	NetStats_Reset();
+}
+
+static void ReplayConnection_Finish(void) {
+	int elapsed = (int)(Stopwatch_ElapsedMicroseconds(replay.start, Stopwatch_Measure()) / 1000);
+	replay.finished = true;
+	Chat_Add2("&eFinished replaying %i packets in %i ms", &replay.packets, &elapsed);
+}
+
+/* Processes packets whose recorded time has been reached, until out of time budget */
+static void ReplayConnection_ReadPackets(void) {
+	cc_uint64 beg = Stopwatch_Measure();
+	cc_uint32 elapsed, time;
+	Net_Handler handler;
+	cc_uint8* packet;
+	cc_uint8 opcode;
+	int len;
+	elapsed = (cc_uint32)(Stopwatch_ElapsedMicroseconds(replay.start, beg) / 1000);
+
+	while (replay.offset + CAPTURE_RECORD_SIZE <= replay.length) {
+		time   = Stream_GetU32_LE(replay.data + replay.offset);
+		len    = Stream_GetU16_LE(replay.data + replay.offset + 4);
+		packet = replay.data + replay.offset + CAPTURE_RECORD_SIZE;
+
+		if (!replay.maxSpeed && time > elapsed) return;
+		if (!len || replay.offset + CAPTURE_RECORD_SIZE + len > replay.length) break;
+
+		opcode  = packet[0];
+		handler = Protocol.Handlers[opcode];
+		if (!handler) { DisconnectInvalidOpcode(opcode); return; }
+
+		replay.offset += CAPTURE_RECORD_SIZE + len;
+		replay.packets++;
+		lastOpcode = opcode;
+		Net_HandlePacket(handler, packet, len);
+
+		if (Server.Disconnected) return;
+		if (Stopwatch_ElapsedMicroseconds(beg, Stopwatch_Measure()) >= NET_TICK_BUDGET_US) return;
+	}
+	ReplayConnection_Finish();
+}
+
+static void ReplayConnection_Tick(struct ScheduledTask* task) {
+	if (Server.Disconnected || !replay.data) return;
+	Block_BeginDeferredUpdates();
+	if (!replay.finished) ReplayConnection_ReadPackets();
+	Block_EndDeferredUpdates();
+	if (Server.Disconnected) return;
+	NetStats_Update();
+
+	if ((ticks % 3) == 0) {
+		TexturePack_CheckPending();
+		Protocol_Tick();
+		Server.WriteBuffer = net_writeBuffer;
+	}
+	ticks++;
+}
+
+static void ReplayConnection_SendPosition(Vec3 pos, float yaw, float pitch) { }
+static void ReplayConnection_SendData(const cc_uint8* data, cc_uint32 len) { }
+
+static void ReplayConnection_Init(void) {
+	Server_ResetState();
+	Server.IsSinglePlayer = false;
+
+	Server.BeginConnect = ReplayConnection_BeginConnect;
+	Server.Tick         = ReplayConnection_Tick;
+	Server.SendBlock    = MPConnection_SendBlock;
+	Server.SendChat     = MPConnection_SendChat;
+	Server.SendPosition = ReplayConnection_SendPosition;
+	Server.SendData     = ReplayConnection_SendData;
+
+	Server.WriteBuffer = net_writeBuffer;
+}
+
+static void ReplayConnection_Close(void) {
+	Mem_Free(replay.data);
+	Mem_Set(&replay, 0, sizeof(replay));
+	Server.Disconnected = true;
+}
+
+
+/*########################################################################################################################*
+*---------------------------------------------------Loopback connection---------------------------------------------------*
+*#########################################################################################################################*/
+/* Minimal in-process stand-in for a Classic/CPE server, for load testing without a real network */
+/* Packets sent by the client are parsed, and packets sent to the client are fed through the protocol handlers */
+struct LoopbackBuffer { cc_uint8* data; cc_uint32 used, capacity; };
+
+enum LOOPBACK_STATE { LOOPBACK_LOGIN, LOOPBACK_EXTENSIONS, LOOPBACK_PLAYING };
+static struct LoopbackServer {
+	struct LoopbackBuffer in;  /* data sent by the client, that hasn't been parsed yet */
+	struct LoopbackBuffer out; /* packets for the client, each prefixed by 2 byte length */
+	cc_uint32 outRead;
+	int state, clientExts;
+	cc_bool cpe, fastMap;
+	int width, height, length, bots;
+	float movesPerTick, blocksPerTick, moves, blocks;
+	int moveTicks;
+	RNGState rnd;
+} loopback;
+
+/* Extensions that the loopback server supports */
+static const char* loopback_exts[] = { "FastMap", "BulkBlockUpdate", "LongerMessages", "FullCP437" };
+
+static void LoopbackBuffer_Append(struct LoopbackBuffer* buf, const cc_uint8* data, cc_uint32 len) {
+	cc_uint32 capacity;
+	if (buf->used + len > buf->capacity) {
+		capacity = max(buf->capacity * 2, max(buf->used + len, 4096));
+		if (buf->data) {
+			buf->data = (cc_uint8*)Mem_Realloc(buf->data, capacity, 1, "loopback buffer");
+		} else {
+			buf->data = (cc_uint8*)Mem_Alloc(capacity, 1, "loopback buffer");
+		}
+		buf->capacity = capacity;
+	}
+	Mem_Copy(buf->data + buf->used, data, len);
+	buf->used += len;
+}
+
+static void LoopbackBuffer_Free(struct LoopbackBuffer* buf) {
+	Mem_Free(buf->data);
+	buf->data     = NULL;
+	buf->used     = 0;
+	buf->capacity = 0;
+}
+
+static void Loopback_Send(const cc_uint8* packet, int len) {
+	cc_uint8 header[2];
+	Stream_SetU16_LE(header, len);
+	LoopbackBuffer_Append(&loopback.out, header, 2);
+	LoopbackBuffer_Append(&loopback.out, packet, len);
+}
+
+static void Loopback_WriteString(cc_uint8* data, const cc_string* str) {
+	int i;
+	for (i = 0; i < STRING_SIZE; i++) {
+		data[i] = i < str->length ? str->buffer[i] : ' ';
+	}
+}
+
+static void Loopback_SendMessage(const cc_string* text) {
+	cc_uint8 data[66];
+	data[0] = OPCODE_MESSAGE;
+	data[1] = 0;
+	Loopback_WriteString(&data[2], text);
+	Loopback_Send(data, 66);
+}
+
+static void Loopback_SendExtensions(void) {
+	static const cc_string appName = String_FromConst(GAME_APP_NAME " loopback");
+	cc_uint8 data[69];
+	cc_string name;
+	int i;
+
+	data[0] = OPCODE_EXT_INFO;
+	Loopback_WriteString(&data[1], &appName);
+	Stream_SetU16_BE(&data[65], Array_Elems(loopback_exts));
+	Loopback_Send(data, 67);
+
+	for (i = 0; i < Array_Elems(loopback_exts); i++) {
+		name    = String_FromReadonly(loopback_exts[i]);
+		data[0] = OPCODE_EXT_ENTRY;
+		Loopback_WriteString(&data[1], &name);
+		Stream_SetU32_BE(&data[65], 1);
+		Loopback_Send(data, 69);
+	}
+}
+
+/* Height of the generated terrain surface at the given coordinates */
+static int Loopback_SurfaceHeight(int x, int z) {
+	float hills = Math_SinF(x / 16.0f) * Math_CosF(z / 16.0f) * 8.0f;
+	return loopback.height / 2 + (int)hills;
+}
+
+static void Loopback_GenerateMap(cc_uint8* blocks) {
+	int x, y, z, height;
+	cc_uint8* col;
+
+	for (z = 0; z < loopback.length; z++) {
+		for (x = 0; x < loopback.width; x++) {
+			height = Loopback_SurfaceHeight(x, z);
+			col    = blocks + z * loopback.width + x;
+
+			for (y = 0; y < loopback.height; y++) {
+				if (y < height - 3) {
+					*col = BLOCK_STONE;
+				} else if (y < height) {
+					*col = BLOCK_DIRT;
+				} else if (y == height) {
+					*col = BLOCK_GRASS;
+				} else {
+					*col = BLOCK_AIR;
+				}
+				col += loopback.width * loopback.length;
+			}
+		}
+	}
+}
+
+/* Splits compressed map data into level data chunk packets */
+static struct LoopbackChunker {
+	cc_uint8 packet[1028];
+	cc_uint32 used;
+	cc_uint8 percent; /* how much of the map has been compressed so far */
+} loopback_chunker;
+
+static void LoopbackChunker_Flush(void) {
+	struct LoopbackChunker* c = &loopback_chunker;
+	if (!c->used) return;
+
+	c->packet[0] = OPCODE_LEVEL_DATA;
+	Stream_SetU16_BE(&c->packet[1], c->used);
+	Mem_Set(&c->packet[3 + c->used], 0, 1024 - c->used);
+	c->packet[1027] = c->percent;
+
+	Loopback_Send(c->packet, 1028);
+	c->used = 0;
+}
+
+static cc_result LoopbackChunker_Write(struct Stream* s, const cc_uint8* data, cc_uint32 count, cc_uint32* modified) {
+	struct LoopbackChunker* c = &loopback_chunker;
+	cc_uint32 len = min(count, 1024 - c->used);
+
+	Mem_Copy(&c->packet[3 + c->used], data, len);
+	c->used += len;
+	if (c->used == 1024) LoopbackChunker_Flush();
+
+	*modified = len;
+	return 0;
+}
+
+static void Loopback_SendMap(void) {
+	static const cc_string name = String_FromConst("Loopback test server");
+	static const cc_string motd = String_FromConst("Generated map");
+	cc_uint32 volume = loopback.width * loopback.height * loopback.length;
+	struct Stream chunker, compStream;
+	struct GZipState* state;
+	cc_uint8 data[131];
+	cc_uint8* blocks;
+	cc_uint32 i, count;
+	cc_result res;
+
+	data[0] = OPCODE_HANDSHAKE;
+	data[1] = 7;
+	Loopback_WriteString(&data[2],  &name);
+	Loopback_WriteString(&data[66], &motd);
+	data[130] = 0x64; /* op */
+	Loopback_Send(data, 131);
+
+	data[0] = OPCODE_LEVEL_BEGIN;
+	Stream_SetU32_BE(&data[1], volume);
+	Loopback_Send(data, loopback.fastMap ? 5 : 1);
+
+	blocks = (cc_uint8*)Mem_Alloc(volume, 1, "loopback map");
+	state  = (struct GZipState*)Mem_Alloc(1, sizeof(struct GZipState), "loopback compressor");
+	Loopback_GenerateMap(blocks);
+
+	Stream_Init(&chunker);
+	chunker.Write = LoopbackChunker_Write;
+	loopback_chunker.used    = 0;
+	loopback_chunker.percent = 0;
+
+	/* Fast map is raw DEFLATE of just the blocks, classic is GZIP of the volume followed by blocks */
+	if (loopback.fastMap) {
+		Deflate_MakeStream(&compStream, &state->Base, &chunker);
+		res = 0;
+	} else {
+		GZip_MakeStream(&compStream, state, &chunker);
+		Stream_SetU32_BE(data, volume);
+		res = Stream_Write(&compStream, data, 4);
+	}
+	state->Base.Level = DEFLATE_LEVEL_FAST;
+
+	for (i = 0; !res && i < volume; i += count) {
+		count = min(volume - i, 64 * 1024);
+		loopback_chunker.percent = (cc_uint8)(i * 100.0f / volume);
+		res = Stream_Write(&compStream, blocks + i, count);
+	}
+	if (!res) res = compStream.Close(&compStream);
+	if (res) Logger_SysWarn(res, "compressing loopback map");
+	LoopbackChunker_Flush();
+
+	Mem_Free(state);
+	Mem_Free(blocks);
+
+	data[0] = OPCODE_LEVEL_END;
+	Stream_SetU16_BE(&data[1], loopback.width);
+	Stream_SetU16_BE(&data[3], loopback.height);
+	Stream_SetU16_BE(&data[5], loopback.length);
+	Loopback_Send(data, 7);
+}
+
+static void Loopback_SendTeleport(int id, int x, int y, int z, cc_uint8 yaw) {
+	cc_uint8 data[10];
+	data[0] = OPCODE_ENTITY_TELEPORT;
+	data[1] = id;
+	Stream_SetU16_BE(&data[2], x);
+	Stream_SetU16_BE(&data[4], y);
+	Stream_SetU16_BE(&data[6], z);
+	data[8] = yaw;
+	data[9] = 0;
+	Loopback_Send(data, 10);
+}
+
+static void Loopback_SpawnEntities(void) {
+	cc_string name; char nameBuffer[STRING_SIZE];
+	cc_uint8 data[74];
+	int i, x, z;
+
+	for (i = -1; i < loopback.bots; i++) {
+		String_InitArray(name, nameBuffer);
+		if (i == -1) {
+			String_AppendString(&name, &Game_Username);
+		} else {
+			String_Format1(&name, "Bot%i", &i);
+		}
+		x = Random_Next(&loopback.rnd, loopback.width);
+		z = Random_Next(&loopback.rnd, loopback.length);
+
+		data[0] = OPCODE_ADD_ENTITY;
+		data[1] = i == -1 ? ENTITIES_SELF_ID : i;
+		Loopback_WriteString(&data[2], &name);
+		Stream_SetU16_BE(&data[66], x * 32 + 16);
+		Stream_SetU16_BE(&data[68], (Loopback_SurfaceHeight(x, z) + 1) * 32 + 51);
+		Stream_SetU16_BE(&data[70], z * 32 + 16);
+		data[72] = 0;
+		data[73] = 0;
+		Loopback_Send(data, 74);
+	}
+}
+
+static void Loopback_BeginPlaying(void) {
+	Loopback_SendMap();
+	Loopback_SpawnEntities();
+	loopback.state = LOOPBACK_PLAYING;
+}
+
+static void Loopback_HandleLogin(cc_uint8* data) {
+	if (loopback.cpe && data[130] == 0x42) {
+		Loopback_SendExtensions();
+		loopback.state = LOOPBACK_EXTENSIONS;
+	} else {
+		loopback.cpe     = false;
+		loopback.fastMap = false;
+		Loopback_BeginPlaying();
+	}
+}
+
+static void Loopback_HandleSetBlock(cc_uint8* data) {
+	cc_uint8 reply[8];
+	reply[0] = OPCODE_SET_BLOCK;
+	Mem_Copy(&reply[1], &data[1], 6);
+	reply[7] = data[7] ? data[8] : BLOCK_AIR;
+	Loopback_Send(reply, 8);
+}
+
+static void Loopback_HandleMessage(cc_uint8* data) {
+	cc_string text; char textBuffer[STRING_SIZE * 2];
+	cc_string msg = String_Init((char*)&data[2], STRING_SIZE, STRING_SIZE);
+	String_UNSAFE_TrimEnd(&msg);
+
+	String_InitArray(text, textBuffer);
+	String_Format2(&text, "%s: &f%s", &Game_Username, &msg);
+	text.length = min(text.length, STRING_SIZE);
+	Loopback_SendMessage(&text);
+}
+
+/* Returns size of a packet sent by the client, or 0 if opcode is unknown */
+static int Loopback_ClientPacketSize(cc_uint8 opcode) {
+	switch (opcode) {
+	case OPCODE_HANDSHAKE:        return 131;
+	case OPCODE_SET_BLOCK_CLIENT: return 9;
+	case OPCODE_ENTITY_TELEPORT:  return 10;
+	case OPCODE_MESSAGE:          return 66;
+	case OPCODE_EXT_INFO:         return 67;
+	case OPCODE_EXT_ENTRY:        return 69;
+	}
+	return 0;
+}
+
+static void Loopback_ParseClientData(void) {
+	cc_uint8* cur = loopback.in.data;
+	cc_uint8* end = loopback.in.data + loopback.in.used;
+	int size;
+
+	for (; cur < end; cur += size) {
+		size = Loopback_ClientPacketSize(cur[0]);
+		if (!size) {
+			Platform_Log1("Loopback server got unknown packet %b", &cur[0]);
+			break;
+		}
+		if (cur + size > end) break; /* client never sends partial packets */
+
+		switch (cur[0]) {
+		case OPCODE_HANDSHAKE:
+			Loopback_HandleLogin(cur); break;
+		case OPCODE_SET_BLOCK_CLIENT:
+			Loopback_HandleSetBlock(cur); break;
+		case OPCODE_MESSAGE:
+			Loopback_HandleMessage(cur); break;
+		case OPCODE_EXT_INFO:
+			loopback.clientExts = Stream_GetU16_BE(&cur[65]);
+			if (!loopback.clientExts) Loopback_BeginPlaying();
+			break;
+		case OPCODE_EXT_ENTRY:
+			if (--loopback.clientExts == 0) Loopback_BeginPlaying();
+			break;
+		}
+	}
+	loopback.in.used = 0;
+}
+
+/* Moves bots around in circles, and randomly places/deletes blocks on the surface */
+static void Loopback_Simulate(void) {
+	cc_uint8 data[1282];
+	int i, n, x, y, z, id, radius;
+	float angle;
+
+	loopback.moves += loopback.movesPerTick;
+	for (n = (int)loopback.moves; n > 0 && loopback.bots; n--) {
+		id    = loopback.moveTicks % loopback.bots;
+		angle = loopback.moveTicks * 0.05f + id;
+		radius = min(id % 64 + 8, loopback.width / 2 - 1);
+		loopback.moveTicks++;
+
+		x = (int)((loopback.width  / 2 + Math_CosF(angle) * radius) * 32);
+		z = (int)((loopback.length / 2 + Math_SinF(angle) * radius) * 32);
+		y = (Loopback_SurfaceHeight(x / 32, z / 32) + 2) * 32 + 51;
+		Loopback_SendTeleport(id, x, y, z, (cc_uint8)(angle * 40.74f));
+	}
+	loopback.moves -= (int)loopback.moves;
+
+	loopback.blocks += loopback.blocksPerTick;
+	n = (int)loopback.blocks;
+	loopback.blocks -= n;
+
+	while (n > 0) {
+		/* Bulk block update holds up to 256 changes (indices, then blocks) */
+		int count = loopback.cpe ? min(n, 256) : 1;
+		for (i = 0; i < count; i++) {
+			x = Random_Next(&loopback.rnd, loopback.width);
+			z = Random_Next(&loopback.rnd, loopback.length);
+			y = Loopback_SurfaceHeight(x, z) + 1;
+			id = Random_Next(&loopback.rnd, 2) ? Random_Next(&loopback.rnd, BLOCK_OBSIDIAN) + 1 : BLOCK_AIR;
+
+			if (loopback.cpe) {
+				Stream_SetU32_BE(&data[2 + i * 4], (y * loopback.length + z) * loopback.width + x);
+				data[2 + 256 * 4 + i] = id;
+			} else {
+				data[0] = OPCODE_SET_BLOCK;
+				Stream_SetU16_BE(&data[1], x);
+				Stream_SetU16_BE(&data[3], y);
+				Stream_SetU16_BE(&data[5], z);
+				data[7] = id;
+				Loopback_Send(data, 8);
+			}
+		}
+
+		if (loopback.cpe) {
+			data[0] = OPCODE_BULK_BLOCK_UPDATE;
+			data[1] = count - 1;
+			Loopback_Send(data, 1282);
+		}
+		n -= count;
+	}
+}
+
+/* Feeds packets for the client through the protocol handlers, until out of time budget */
+static void Loopback_ProcessPackets(void) {
+	cc_uint64 beg = Stopwatch_Measure();
+	Net_Handler handler;
+	cc_uint8* packet;
+	cc_uint8 opcode;
+	int len;
+
+	while (loopback.outRead < loopback.out.used) {
+		len    = Stream_GetU16_LE(loopback.out.data + loopback.outRead);
+		packet = loopback.out.data + loopback.outRead + 2;
+		loopback.outRead += 2 + len;
+
+		opcode  = packet[0];
+		handler = Protocol.Handlers[opcode];
+		if (!handler) { DisconnectInvalidOpcode(opcode); return; }
+
+		lastOpcode = opcode;
+		Net_HandlePacket(handler, packet, len);
+
+		if (Server.Disconnected) return;
+		if (Stopwatch_ElapsedMicroseconds(beg, Stopwatch_Measure()) >= NET_TICK_BUDGET_US) return;
+	}
+	loopback.out.used = 0;
+	loopback.outRead  = 0;
+}
+
+static void LoopbackConnection_BeginConnect(void) {
+	Blocks.CanPlace[BLOCK_AIR] = false;
+	Event_RaiseVoid(&NetEvents.Connected);
+
+	loopback.cpe     = Game_UseCPE && Options_GetBool(OPT_LOOPBACK_CPE, true);
+	loopback.fastMap = loopback.cpe;
+	loopback.width   = Options_GetInt(OPT_LOOPBACK_SIZE, 16, 1024, 256);
+	loopback.length  = loopback.width;
+	loopback.height  = 64;
+	loopback.bots    = Options_GetInt(OPT_LOOPBACK_BOTS, 0, 254, 32);
+	/* network is ticked 60 times a second */
+	loopback.movesPerTick  = Options_GetInt(OPT_LOOPBACK_MOVES,  0, 1000000, 640) / 60.0f;
+	loopback.blocksPerTick = Options_GetInt(OPT_LOOPBACK_BLOCKS, 0, 1000000, 100) / 60.0f;
+	Random_Seed(&loopback.rnd, 1);
+
+	loopback.state = LOOPBACK_LOGIN;
+	NetStats_Reset();
+	Classic_SendLogin();
+}
+
+static void LoopbackConnection_Tick(struct ScheduledTask* task) {
+	if (Server.Disconnected) return;
+	Loopback_ParseClientData();
+	/* Only simulate once everything that was previously sent has been processed */
+	if (loopback.state == LOOPBACK_PLAYING && !loopback.out.used) Loopback_Simulate();
+
+	Block_BeginDeferredUpdates();
+	Loopback_ProcessPackets();
+	Block_EndDeferredUpdates();
+	if (Server.Disconnected) return;
+	NetStats_Update();
+
+	if ((ticks % 3) == 0) {
+		TexturePack_CheckPending();
+		Protocol_Tick();
+		if (Server.WriteBuffer != net_writeBuffer) Net_SendPacket();
+	}
+	ticks++;
+}
+
+static void LoopbackConnection_SendPosition(Vec3 pos, float yaw, float pitch) {
+	Classic_WritePosition(pos, yaw, pitch);
+	Net_SendPacket();
+}
+
+static void LoopbackConnection_SendData(const cc_uint8* data, cc_uint32 len) {
+	LoopbackBuffer_Append(&loopback.in, data, len);
+}
+
+static void LoopbackConnection_Init(void) {
+	Server_ResetState();
+	Server.IsSinglePlayer = false;
+
+	Server.BeginConnect = LoopbackConnection_BeginConnect;
+	Server.Tick         = LoopbackConnection_Tick;
+	Server.SendBlock    = MPConnection_SendBlock;
+	Server.SendChat     = MPConnection_SendChat;
+	Server.SendPosition = LoopbackConnection_SendPosition;
+	Server.SendData     = LoopbackConnection_SendData;
+
+	Server.WriteBuffer = net_writeBuffer;
+}
+
+static void LoopbackConnection_Close(void) {
+	LoopbackBuffer_Free(&loopback.in);
+	LoopbackBuffer_Free(&loopback.out);
+	loopback.outRead    = 0;
+	Server.Disconnected = true;
+}
+
+
 static void OnNewMap(void) {
 	int i;
 	if (Server.IsSinglePlayer) return;
@@ -501,7 +1710,11 @@ static void OnInit(void) {
 	String_InitArray(Server.MOTD,    motdBuffer);
 	String_InitArray(Server.AppName, appBuffer);
 
-	if (!Server.Address.length) {
+	if (String_CaselessEqualsConst(&Server.Address, "loopback")) {
+		LoopbackConnection_Init();
+	} else if (!Server.Address.length && ReplayConnection_IsCapture(&Game_Username)) {
+		ReplayConnection_Init();
+	} else if (!Server.Address.length) {
 		SPConnection_Init();
 	} else {
 		MPConnection_Init();
@@ -531,8 +1744,20 @@ static void OnFree(void) {
 static void OnClose(void) {
 	if (Server.IsSinglePlayer) {
 		Physics_Free();
+	} else if (Server.Tick == ReplayConnection_Tick) {
+		ReplayConnection_Close();
+	} else if (Server.Tick == LoopbackConnection_Tick) {
+		LoopbackConnection_Close();
 	} else {
 		Ping_Reset();
+#ifdef NET_RECV_THREAD
+		/* NOTE: Must be stopped before socket is closed and before Protocol component is reset */
+		NetRecv_Stop();
+#else
+		MPConnection_FreeReadBuffer();
+#endif
+		NetSend_Free();
+		NetCapture_Close();
 		if (Server.Disconnected) return;
 
 		Socket_Close(net_socket);
@@ -15,6 +15,21 @@ int Ping_NextPingId(void);
 void Ping_Update(int id);
 /* Calculates average ping time based on most recent ping entries. */
 int Ping_AveragePingMS(void);
+/* Retrieves how many bytes and packets per second were received over the last second. */
+void Net_GetReceiveRate(int* bytesPerSec, int* packetsPerSec);
+/* Retrieves how many bytes are waiting to be sent, the most that were ever waiting, */
+/*  and how many stale position updates were dropped because of this, for the current connection. */
+void Net_GetSendBacklog(int* queuedBytes, int* peakBytes, int* coalesced);
+
+/* Statistics for handling received packets with a particular opcode */
+struct NetPacketProfile {
+	cc_uint32 packets, maxMicros;
+	cc_uint64 bytes, totalMicros;
+};
+/* Whether statistics are collected for each received packet. (false by default) */
+extern cc_bool Net_ProfilePackets;
+/* Statistics for each opcode, only updated when Net_ProfilePackets is true. */
+extern struct NetPacketProfile Net_PacketProfiles[256];
 
 /* Data for currently active connection to a server. */
 CC_VAR extern struct _ServerConnectionData {
@@ -14,6 +14,8 @@
 #include "Options.h"
 #include "Logger.h"
 #include "Utils.h"
+#include "Bitmap.h"
+#include "Errors.h"
 #include "Chat.h" /* TODO avoid this include */
 
 /*########################################################################################################################*
@@ -258,16 +260,23 @@ CC_NOINLINE static void SetCachedTag(const cc_string* url, struct StringsBuffer*
 	EntryList_Save(list, file);
 }
 
+/* Updates cached ETag and Last-Modified for the given URL */
+static void UpdateCachedTags(struct HttpRequest* req) {
+	cc_string tag, url;
+	url = String_FromRawArray(req->url);
+
+	tag = String_FromRawArray(req->etag);
+	SetCachedTag(&url, &etagCache, &tag, ETAGS_TXT);
+	tag = String_FromRawArray(req->lastModified);
+	SetCachedTag(&url, &lastModCache, &tag, LASTMOD_TXT);
+}
+
 /* Updates cached data, ETag, and Last-Modified for the given URL */
 static void UpdateCache(struct HttpRequest* req) {
 	cc_string path, url; char pathBuffer[FILENAME_SIZE];
 	cc_result res;
 	url = String_FromRawArray(req->url);
-
-	path = String_FromRawArray(req->etag);
-	SetCachedTag(&url, &etagCache, &path, ETAGS_TXT);
-	path = String_FromRawArray(req->lastModified);
-	SetCachedTag(&url, &lastModCache, &path, LASTMOD_TXT);
+	UpdateCachedTags(req);
 
 	String_InitArray(path, pathBuffer);
 	MakeCachePath(&path, &url);
@@ -275,6 +284,74 @@ static void UpdateCache(struct HttpRequest* req) {
 	if (res) { Logger_SysWarn2(res, "caching", &url); }
 }
 
+/* Writes texture pack data directly to the cache as it is downloaded */
+/* NOTE: Called on a http worker thread, so must not touch any game state */
+struct CacheWriter {
+	struct HttpConsumer base;
+	struct Stream file;
+	cc_bool opened;
+};
+
+/* The request ID is included so that overlapping downloads of the same URL never write the same file */
+static void MakeCacheTempPath(cc_string* path, const cc_string* url, int reqID) {
+	MakeCachePath(path, url);
+	String_Format1(path, ".%i.tmp", &reqID);
+}
+
+static cc_result CacheWriter_Write(struct HttpConsumer* c, struct HttpRequest* req, const cc_uint8* data, cc_uint32 len) {
+	struct CacheWriter* w = (struct CacheWriter*)c;
+	cc_string path, url; char pathBuffer[FILENAME_SIZE];
+	cc_result res;
+
+	/* Data is written to a temp file first, as the cache file might be getting read by the main thread */
+	if (!w->opened) {
+		url = String_FromRawArray(req->url);
+		String_InitArray(path, pathBuffer);
+		MakeCacheTempPath(&path, &url, req->id);
+
+		if ((res = Stream_CreateFile(&w->file, &path))) return res;
+		w->opened = true;
+	}
+	return Stream_Write(&w->file, data, len);
+}
+
+/* NOTE: The temp file is only moved over the cached data later on the main thread, */
+/*  as the cache file can't be replaced on Windows while a texture pack is still reading it */
+static cc_result CacheWriter_Finish(struct HttpConsumer* c, struct HttpRequest* req) {
+	struct CacheWriter* w = (struct CacheWriter*)c;
+	cc_string tmp, url; char tmpBuffer[FILENAME_SIZE];
+	cc_result res = 0;
+
+	if (w->opened) {
+		res = w->file.Close(&w->file);
+
+		/* Partially downloaded texture packs are never used */
+		if (res || req->result || req->statusCode != 200) {
+			url = String_FromRawArray(req->url);
+			String_InitArray(tmp, tmpBuffer);
+			MakeCacheTempPath(&tmp, &url, req->id);
+			File_Delete(&tmp);
+		}
+	}
+
+	Mem_Free(w);
+	return res;
+}
+
+/* Deletes temp files left behind by downloads which were superseded or interrupted */
+static void DeleteCacheTempFile(const cc_string* path, void* obj) {
+	static const cc_string tmp = String_FromConst(".tmp");
+	if (String_CaselessEnds(path, &tmp)) File_Delete(path);
+}
+
+static struct HttpConsumer* CacheWriter_New(void) {
+	struct CacheWriter* w = (struct CacheWriter*)Mem_Alloc(1, sizeof(struct CacheWriter), "cache writer");
+	w->base.Write  = CacheWriter_Write;
+	w->base.Finish = CacheWriter_Finish;
+	w->opened      = false;
+	return &w->base;
+}
+
 
 /*########################################################################################################################*
 *-------------------------------------------------------TexturePack-------------------------------------------------------*
@@ -297,13 +374,633 @@ static cc_result ProcessZipEntry(const cc_string* path, struct Stream* stream, s
 	return 0;
 }
 
-static cc_result ExtractZip(struct Stream* stream) {
+static cc_result ExtractZipSerial(struct Stream* stream) {
 	struct ZipState state;
 	Zip_Init(&state, stream);
 	state.ProcessEntry = ProcessZipEntry;
 	return Zip_Extract(&state);
 }
 
+#ifdef CC_BUILD_WEB
+/* Thread_Start isn't actually multithreaded in webclient */
+static cc_result ExtractZip(struct Stream* stream) { return ExtractZipSerial(stream); }
+#else
+/* Entries are read, decompressed and PNG decoded on worker threads, */
+/*  then the results are raised as events on the main thread in the same order as in the archive */
+#define EXTRACT_WORKERS 4
+#define EXTRACT_MAX_JOBS (EXTRACT_WORKERS * 2)
+enum EXTRACT_JOB_ { EXTRACT_JOB_FREE, EXTRACT_JOB_RUNNING, EXTRACT_JOB_DONE };
+
+struct ExtractJob {
+	int entry;         /* Index of the entry in the archive */
+	cc_uint8* raw;     /* Raw (possibly compressed) data of the entry */
+	cc_uint8* data;    /* Decompressed data of the entry, NULL if bitmap was read from the cache */
+	struct Bitmap bmp; /* Bitmap decoded from the data, if the entry is a .png file */
+	cc_result res;
+	cc_uint8 status;
+};
+
+/* Bitmaps decoded from an archive's .png entries are also saved to a cache file, so extracting the */
+/*  same archive again (e.g. when rejoining a server) can skip inflating and decoding those entries */
+/* File layout: header, table of entries, then the raw pixels of each bitmap in archive order */
+#define DECODED_CACHE_DIR     "texturecache/decoded"
+#define DECODED_CACHE_VERSION 1
+#define DECODED_HEADER_SIZE   32
+#define DECODED_ENTRY_SIZE    16
+/* Archives which would need a larger cache file than this are not cached */
+#define DECODED_MAX_SIZE      (256 * 1024 * 1024)
+/* Least recently used cache files are deleted once the total size of all of them exceeds this */
+#define DECODED_CACHE_LIMIT   (512 * 1024 * 1024)
+#define DECODED_USED_TXT      DECODED_CACHE_DIR "/used.txt"
+
+struct DecodedEntry { cc_uint32 entry, width, height, offset; };
+struct DecodedCache {
+	struct Stream file;
+	struct DecodedEntry* entries;
+	int count;
+	cc_uint32 offset; /* Offset in the file of the next bitmap to write */
+	cc_result res;    /* Nothing else is written after an error occurs */
+	cc_bool open, writing, tooBig;
+};
+
+/* NOTE: Only one archive can be extracted in parallel at once, since Thread_Start doesn't take an argument */
+static struct ExtractState {
+	cc_bool active, stopping, delivering, failed;
+	struct ZipIndex index;
+	int submitted, delivered;
+	void* mutex;
+	void* ioMutex;      /* Held while reading from the archive, or reading/writing the cache file */
+	void* workWaitable; /* Signalled when a job slot becomes free */
+	void* doneWaitable; /* Signalled when a job is finished */
+	void* threads[EXTRACT_WORKERS];
+	struct ExtractJob jobs[EXTRACT_MAX_JOBS];
+	struct DecodedCache cache;
+} extract;
+
+/* Checksums of the entries are used to identify an archive, rather than the whole archive's data */
+static cc_uint32 DecodedCache_Checksum(struct ZipIndex* index, cc_uint32 crc) {
+	cc_uint8 tmp[8];
+	cc_string path;
+	int i;
+
+	for (i = 0; i < index->count; i++) {
+		path = ZipIndex_GetPath(index, i);
+		Stream_SetU32_LE(tmp + 0, index->entries[i].Base.CRC32);
+		Stream_SetU32_LE(tmp + 4, index->entries[i].Base.UncompressedSize);
+
+		crc = Utils_Crc32Update(crc, (const cc_uint8*)path.buffer, path.length);
+		crc = Utils_Crc32Update(crc, tmp, sizeof(tmp));
+	}
+	return crc ^ 0xFFFFFFFFUL;
+}
+
+static void DecodedCache_MakePath(cc_string* path, struct ZipIndex* index, cc_bool temp) {
+	String_AppendConst(path, DECODED_CACHE_DIR "/");
+	String_AppendUInt32(path, DecodedCache_Checksum(index, 0xFFFFFFFFUL));
+	String_AppendConst(path, temp ? ".tmp" : ".bin");
+}
+
+/* Fills out the header of a cache file for the given archive */
+static void DecodedCache_MakeHeader(cc_uint8* header, struct ZipIndex* index, int count) {
+	/* Pixels are stored in the native BitmapCol layout, so must be invalidated if that differs */
+	BitmapCol layout = BitmapCol_Make(1, 2, 3, 4);
+	Mem_Set(header, 0, DECODED_HEADER_SIZE);
+
+	Mem_Copy(header, "CCDC", 4);
+	Stream_SetU32_LE(&header[4],  DECODED_CACHE_VERSION);
+	Mem_Copy(&header[8], &layout, 4);
+	Stream_SetU32_LE(&header[12], index->count);
+	/* Guard against two archives with the same checksum in the filename */
+	Stream_SetU32_LE(&header[16], DecodedCache_Checksum(index, 0x12345678UL));
+	Stream_SetU32_LE(&header[20], count);
+}
+
+/* Entries of "[checksum] [file size]", from least to most recently used cache file */
+static struct StringsBuffer decodedUsed;
+static cc_bool decodedUsedLoaded;
+
+static cc_uint64 DecodedCache_UsedSize(int i, cc_string* name) {
+	cc_string entry = StringsBuffer_UNSAFE_Get(&decodedUsed, i);
+	cc_string size;
+	cc_uint64 value;
+
+	String_UNSAFE_Separate(&entry, ' ', name, &size);
+	return Convert_ParseUInt64(&size, &value) ? value : 0;
+}
+
+/* Marks the cache file for the given archive as the most recently used one, */
+/*  then deletes the least recently used cache files if the total size is too large */
+static void DecodedCache_MarkUsed(struct ZipIndex* index, cc_uint32 size) {
+	cc_string key;  char keyBuffer[STRING_INT_CHARS];
+	cc_string used; char usedBuffer[STRING_INT_CHARS];
+	cc_string path; char pathBuffer[FILENAME_SIZE];
+	cc_string name;
+	cc_uint64 total = 0;
+	cc_result res;
+	int i;
+
+	if (!decodedUsedLoaded) EntryList_UNSAFE_Load(&decodedUsed, DECODED_USED_TXT);
+	decodedUsedLoaded = true;
+
+	String_InitArray(key,  keyBuffer);
+	String_AppendUInt32(&key, DecodedCache_Checksum(index, 0xFFFFFFFFUL));
+	String_InitArray(used, usedBuffer);
+	String_AppendUInt32(&used, size);
+	/* NOTE: This moves the entry to the end of the list */
+	EntryList_Set(&decodedUsed, &key, &used, ' ');
+
+	for (i = 0; i < decodedUsed.count; i++) {
+		total += DecodedCache_UsedSize(i, &name);
+	}
+
+	/* The cache file that was just used is always kept */
+	while (total > DECODED_CACHE_LIMIT && decodedUsed.count > 1) {
+		total -= DecodedCache_UsedSize(0, &name);
+		String_InitArray(path, pathBuffer);
+		String_Format1(&path, DECODED_CACHE_DIR "/%s.bin", &name);
+
+		res = File_Delete(&path);
+		if (res && res != ReturnCode_FileNotFound) Logger_SysWarn2(res, "deleting", &path);
+		StringsBuffer_Remove(&decodedUsed, 0);
+	}
+	EntryList_Save(&decodedUsed, DECODED_USED_TXT);
+}
+
+static void DecodedCache_Close(struct DecodedCache* c) {
+	if (c->open) c->file.Close(&c->file);
+	Mem_Free(c->entries);
+	c->entries = NULL;
+	c->open    = false;
+	c->writing = false;
+}
+
+/* Opens the cache file for the given archive, returning whether it exists and is valid */
+static cc_bool DecodedCache_Open(struct DecodedCache* c, struct ZipIndex* index) {
+	cc_uint8 header[DECODED_HEADER_SIZE], expected[DECODED_HEADER_SIZE];
+	cc_string path; char pathBuffer[FILENAME_SIZE];
+	struct DecodedEntry e;
+	cc_uint32 length, prev = 0;
+	cc_uint8* data;
+	int i, count;
+
+	String_InitArray(path, pathBuffer);
+	DecodedCache_MakePath(&path, index, false);
+	if (!File_Exists(&path) || Stream_OpenFile(&c->file, &path)) return false;
+	c->open = true;
+
+	if (Stream_Read(&c->file, header, DECODED_HEADER_SIZE)) goto invalid;
+	count = (int)Stream_GetU32_LE(&header[20]);
+	DecodedCache_MakeHeader(expected, index, count);
+
+	if (!Mem_Equal(header, expected, DECODED_HEADER_SIZE)) goto invalid;
+	if (count < 1 || count > index->count)                 goto invalid;
+	if (c->file.Length(&c->file, &length))                 goto invalid;
+
+	c->entries = (struct DecodedEntry*)Mem_TryAlloc(count, sizeof(struct DecodedEntry));
+	if (!c->entries) goto invalid;
+	data = (cc_uint8*)c->entries;
+	if (Stream_Read(&c->file, data, count * DECODED_ENTRY_SIZE)) goto invalid;
+
+	/* Entries are decoded in place, as sizeof(struct DecodedEntry) == DECODED_ENTRY_SIZE */
+	for (i = 0; i < count; i++, data += DECODED_ENTRY_SIZE) {
+		e.entry  = Stream_GetU32_LE(&data[0]);
+		e.width  = Stream_GetU32_LE(&data[4]);
+		e.height = Stream_GetU32_LE(&data[8]);
+		e.offset = Stream_GetU32_LE(&data[12]);
+
+		if ((i && e.entry <= prev) || e.entry >= (cc_uint32)index->count)    goto invalid;
+		if (!e.width || e.width > PNG_MAX_DIMS)                              goto invalid;
+		if (!e.height || e.height > PNG_MAX_DIMS)                            goto invalid;
+		if (e.offset > length || Bitmap_DataSize(e.width, e.height) > length - e.offset) goto invalid;
+
+		c->entries[i] = e;
+		prev = e.entry;
+	}
+	c->count = count;
+	DecodedCache_MarkUsed(index, length);
+	return true;
+
+invalid:
+	/* The cache file just gets replaced when the archive is extracted */
+	DecodedCache_Close(c);
+	return false;
+}
+
+/* Returns the cached bitmap details for the given entry, or NULL if it isn't in the cache */
+static struct DecodedEntry* DecodedCache_Find(struct DecodedCache* c, int i) {
+	int lo = 0, hi, mid;
+	/* NOTE: Must check this first, as count is changed by the worker threads while writing */
+	if (c->writing) return NULL;
+	hi = c->count - 1;
+
+	/* Entries are sorted by index in the archive */
+	while (lo <= hi) {
+		mid = (lo + hi) / 2;
+		if (c->entries[mid].entry == (cc_uint32)i) return &c->entries[mid];
+
+		if (c->entries[mid].entry < (cc_uint32)i) { lo = mid + 1; } else { hi = mid - 1; }
+	}
+	return NULL;
+}
+
+static cc_result DecodedCache_ReadBitmap(struct DecodedCache* c, struct DecodedEntry* e, struct Bitmap* bmp) {
+	cc_uint32 size = Bitmap_DataSize(e->width, e->height);
+	cc_result res;
+
+	Bitmap_TryAllocate(bmp, e->width, e->height);
+	if (!bmp->scan0) return ERR_OUT_OF_MEMORY;
+	res = c->file.Seek(&c->file, e->offset);
+	if (!res) res = Stream_Read(&c->file, (cc_uint8*)bmp->scan0, size);
+
+	if (res) { Mem_Free(bmp->scan0); bmp->scan0 = NULL; }
+	return res;
+}
+
+/* Starts writing a new cache file for the given archive */
+static void DecodedCache_Create(struct DecodedCache* c, struct ZipIndex* index) {
+	cc_string path; char pathBuffer[FILENAME_SIZE];
+
+	c->entries = (struct DecodedEntry*)Mem_TryAlloc(index->count, sizeof(struct DecodedEntry));
+	if (!c->entries || !Utils_EnsureDirectory(DECODED_CACHE_DIR)) return;
+
+	String_InitArray(path, pathBuffer);
+	DecodedCache_MakePath(&path, index, true);
+	if ((c->res = Stream_CreateFile(&c->file, &path))) return;
+	c->open    = true;
+	c->writing = true;
+
+	/* Header and table of entries are written last, once all the bitmaps have been written */
+	c->offset = DECODED_HEADER_SIZE + index->count * DECODED_ENTRY_SIZE;
+	c->res    = c->file.Seek(&c->file, c->offset);
+}
+
+static void DecodedCache_Append(struct DecodedCache* c, int i, struct Bitmap* bmp) {
+	static const cc_uint8 padding[16] = { 0 };
+	cc_uint32 size = Bitmap_DataSize(bmp->width, bmp->height);
+	cc_uint32 pad  = (16 - (size & 15)) & 15;
+	struct DecodedEntry* e;
+	if (!c->writing || c->res || c->tooBig) return;
+
+	if (size > DECODED_MAX_SIZE - c->offset) { c->tooBig = true; return; }
+	c->res = Stream_Write(&c->file, (cc_uint8*)bmp->scan0, size);
+	if (!c->res) c->res = Stream_Write(&c->file, padding, pad);
+	if (c->res) return;
+
+	/* Pixels of each bitmap start on a 16 byte boundary */
+	e = &c->entries[c->count++];
+	e->entry  = i;
+	e->width  = bmp->width;
+	e->height = bmp->height;
+	e->offset = c->offset;
+	c->offset += size + pad;
+}
+
+/* Bitmaps are appended by the worker threads in whichever order they finish decoding, */
+/*  but entries must be sorted by index in the archive for DecodedCache_Find */
+static void DecodedCache_SortEntries(struct DecodedCache* c) {
+	struct DecodedEntry e;
+	int i, j;
+
+	/* Entries are already nearly sorted, so insertion sort is fine */
+	for (i = 1; i < c->count; i++) {
+		e = c->entries[i];
+		for (j = i - 1; j >= 0 && c->entries[j].entry > e.entry; j--) {
+			c->entries[j + 1] = c->entries[j];
+		}
+		c->entries[j + 1] = e;
+	}
+}
+
+/* Finishes writing the cache file, then replaces the old cache file with it if successful */
+static void DecodedCache_Finish(struct DecodedCache* c, struct ZipIndex* index, cc_bool success) {
+	cc_string path; char pathBuffer[FILENAME_SIZE];
+	cc_string tmp;  char tmpBuffer[FILENAME_SIZE];
+	cc_uint8 data[DECODED_HEADER_SIZE];
+	struct DecodedEntry* e;
+	cc_result res;
+	int i;
+	if (!c->writing) return;
+
+	DecodedCache_SortEntries(c);
+	if (!c->res) c->res = c->file.Seek(&c->file, 0);
+	DecodedCache_MakeHeader(data, index, c->count);
+	if (!c->res) c->res = Stream_Write(&c->file, data, DECODED_HEADER_SIZE);
+
+	for (i = 0; i < c->count && !c->res; i++) {
+		e = &c->entries[i];
+		Stream_SetU32_LE(&data[0],  e->entry);
+		Stream_SetU32_LE(&data[4],  e->width);
+		Stream_SetU32_LE(&data[8],  e->height);
+		Stream_SetU32_LE(&data[12], e->offset);
+		c->res = Stream_Write(&c->file, data, DECODED_ENTRY_SIZE);
+	}
+
+	res = c->file.Close(&c->file);
+	c->open    = false;
+	c->writing = false;
+	if (!c->res) c->res = res;
+	if (c->res) { Logger_SysWarn(c->res, "caching decoded texture pack"); return; }
+	/* The partial temp file just gets overwritten when the archive is next extracted */
+	if (!success || c->tooBig || !c->count) return;
+
+	String_InitArray(path, pathBuffer);
+	DecodedCache_MakePath(&path, index, false);
+	String_InitArray(tmp, tmpBuffer);
+	DecodedCache_MakePath(&tmp, index, true);
+
+	res = File_Rename(&tmp, &path);
+	if (res) { Logger_SysWarn(res, "caching decoded texture pack"); return; }
+	DecodedCache_MarkUsed(index, c->offset);
+}
+
+static void ExtractJob_Run(struct ExtractJob* job) {
+	static const cc_string png = String_FromConst(".png");
+	struct ZipIndexEntry* entry  = &extract.index.entries[job->entry];
+	struct DecodedEntry* cached  = DecodedCache_Find(&extract.cache, job->entry);
+	cc_string path = ZipIndex_GetPath(&extract.index, job->entry);
+	struct Stream src;
+
+	/* If reading from the cache fails, just decode the entry's data instead */
+	if (cached) {
+		Mutex_Lock(extract.ioMutex);
+		job->res = DecodedCache_ReadBitmap(&extract.cache, cached, &job->bmp);
+		Mutex_Unlock(extract.ioMutex);
+		if (!job->res) return;
+	}
+
+	job->raw  = (cc_uint8*)Mem_TryAlloc(max(entry->Base.CompressedSize,   1), 1);
+	job->data = (cc_uint8*)Mem_TryAlloc(max(entry->Base.UncompressedSize, 1), 1);
+	if (!job->raw || !job->data) { job->res = ERR_OUT_OF_MEMORY; return; }
+
+	Mutex_Lock(extract.ioMutex);
+	job->res = ZipIndex_ReadRaw(&extract.index, job->entry, job->raw);
+	Mutex_Unlock(extract.ioMutex);
+
+	if (!job->res) job->res = ZipIndex_Decompress(entry, job->raw, job->data);
+	if (job->res || !String_CaselessEnds(&path, &png)) return;
+	Stream_ReadonlyMemory(&src, job->data, entry->Base.UncompressedSize);
+
+	/* If decoding fails, handlers will just try to decode the data again on the main thread */
+	/*  (which fails again, but then also logs the reason why decoding failed) */
+	if (Png_Decode(&job->bmp, &src)) {
+		Mem_Free(job->bmp.scan0);
+		job->bmp.scan0 = NULL; return;
+	}
+
+	/* Must be cached before the event is raised, as handlers might modify the bitmap */
+	Mutex_Lock(extract.ioMutex);
+	DecodedCache_Append(&extract.cache, job->entry, &job->bmp);
+	Mutex_Unlock(extract.ioMutex);
+}
+
+static void ExtractWorker_Main(void) {
+	struct ExtractJob* job;
+	cc_bool stopping;
+
+	for (;;) {
+		job = NULL;
+		Mutex_Lock(extract.mutex);
+		{
+			stopping = extract.stopping;
+			/* Only start on the next entry when there's a free slot for its job */
+			if (!stopping && extract.submitted < extract.index.count
+					&& extract.submitted - extract.delivered < EXTRACT_MAX_JOBS) {
+				job = &extract.jobs[extract.submitted % EXTRACT_MAX_JOBS];
+				job->entry  = extract.submitted++;
+				job->status = EXTRACT_JOB_RUNNING;
+			}
+		}
+		Mutex_Unlock(extract.mutex);
+
+		/* Multiple signals may have been combined into one, so wake up another worker too */
+		if (job || stopping) Waitable_Signal(extract.workWaitable);
+		if (stopping) return;
+		if (!job) { Waitable_Wait(extract.workWaitable); continue; }
+
+		ExtractJob_Run(job);
+		Mutex_Lock(extract.mutex);
+		{
+			job->status = EXTRACT_JOB_DONE;
+		}
+		Mutex_Unlock(extract.mutex);
+		Waitable_Signal(extract.doneWaitable);
+	}
+}
+
+static void ExtractJob_Free(struct ExtractJob* job) {
+	Mem_Free(job->raw);
+	Mem_Free(job->data);
+	Mem_Free(job->bmp.scan0);
+
+	job->raw  = NULL;
+	job->data = NULL;
+	job->bmp.scan0 = NULL;
+}
+
+/* Only decompresses the data of an entry once something actually reads from the stream */
+/*  (usually nothing does, as handlers just use the bitmap that was read from the cache) */
+struct LazyEntry { struct Stream mem; cc_uint8* data; int entry; cc_result res; };
+
+static cc_result LazyEntry_Load(struct Stream* s) {
+	struct LazyEntry* lazy      = (struct LazyEntry*)s->Meta.Inflate;
+	struct ZipIndexEntry* entry = &extract.index.entries[lazy->entry];
+	cc_uint8* raw;
+	if (lazy->data || lazy->res) return lazy->res;
+
+	raw        = (cc_uint8*)Mem_TryAlloc(max(entry->Base.CompressedSize,   1), 1);
+	lazy->data = (cc_uint8*)Mem_TryAlloc(max(entry->Base.UncompressedSize, 1), 1);
+	if (!raw || !lazy->data) lazy->res = ERR_OUT_OF_MEMORY;
+
+	if (!lazy->res) {
+		Mutex_Lock(extract.ioMutex);
+		lazy->res = ZipIndex_ReadRaw(&extract.index, lazy->entry, raw);
+		Mutex_Unlock(extract.ioMutex);
+	}
+	if (!lazy->res) lazy->res = ZipIndex_Decompress(entry, raw, lazy->data);
+	Mem_Free(raw);
+
+	if (!lazy->res) Stream_ReadonlyMemory(&lazy->mem, lazy->data, entry->Base.UncompressedSize);
+	return lazy->res;
+}
+
+static cc_result LazyEntry_Read(struct Stream* s, cc_uint8* data, cc_uint32 count, cc_uint32* modified) {
+	struct Stream* mem = &((struct LazyEntry*)s->Meta.Inflate)->mem;
+	cc_result res = LazyEntry_Load(s);
+	if (res) { *modified = 0; return res; }
+	return mem->Read(mem, data, count, modified);
+}
+static cc_result LazyEntry_Skip(struct Stream* s, cc_uint32 count) {
+	struct Stream* mem = &((struct LazyEntry*)s->Meta.Inflate)->mem;
+	cc_result res = LazyEntry_Load(s);
+	return res ? res : mem->Skip(mem, count);
+}
+static cc_result LazyEntry_Seek(struct Stream* s, cc_uint32 position) {
+	struct Stream* mem = &((struct LazyEntry*)s->Meta.Inflate)->mem;
+	cc_result res = LazyEntry_Load(s);
+	return res ? res : mem->Seek(mem, position);
+}
+static cc_result LazyEntry_Position(struct Stream* s, cc_uint32* position) {
+	struct Stream* mem = &((struct LazyEntry*)s->Meta.Inflate)->mem;
+	cc_result res = LazyEntry_Load(s);
+	return res ? res : mem->Position(mem, position);
+}
+static cc_result LazyEntry_Length(struct Stream* s, cc_uint32* length) {
+	struct LazyEntry* lazy = (struct LazyEntry*)s->Meta.Inflate;
+	*length = extract.index.entries[lazy->entry].Base.UncompressedSize;
+	return 0;
+}
+
+static void LazyEntry_Make(struct Stream* s, struct LazyEntry* lazy, int entry) {
+	Stream_Init(s);
+	s->Meta.Inflate = lazy;
+	lazy->data  = NULL;
+	lazy->entry = entry;
+	lazy->res   = 0;
+
+	s->Read     = LazyEntry_Read;
+	s->Skip     = LazyEntry_Skip;
+	s->Seek     = LazyEntry_Seek;
+	s->Position = LazyEntry_Position;
+	s->Length   = LazyEntry_Length;
+}
+
+/* Raises FileChanged event for the entry of the oldest job, returning false if that job hasn't finished */
+/* NOTE: If wait is true, waits until the job has finished instead of returning false */
+static cc_bool ExtractJob_Deliver(cc_bool wait) {
+	struct ExtractJob* job = &extract.jobs[extract.delivered % EXTRACT_MAX_JOBS];
+	struct ZipIndexEntry* entry;
+	struct LazyEntry lazy;
+	struct DecodedPng png;
+	struct Stream src, stream;
+	cc_string path, name;
+	cc_uint8 status;
+
+	for (;;) {
+		Mutex_Lock(extract.mutex);
+		{
+			status = job->status;
+		}
+		Mutex_Unlock(extract.mutex);
+
+		if (status == EXTRACT_JOB_DONE) break;
+		if (!wait) return false;
+		Waitable_Wait(extract.doneWaitable);
+	}
+
+	entry = &extract.index.entries[job->entry];
+	path  = ZipIndex_GetPath(&extract.index, job->entry);
+	name  = path;
+	Utils_UNSAFE_GetFilename(&name);
+
+	if (job->data) {
+		Stream_ReadonlyMemory(&src, job->data, entry->Base.UncompressedSize);
+	} else {
+		LazyEntry_Make(&src, &lazy, job->entry);
+	}
+	extract.delivering = true;
+
+	if (job->res) {
+		Logger_SysWarn2(job->res, "extracting", &path);
+		extract.failed = true;
+	} else if (job->bmp.scan0) {
+		png.bmp = job->bmp;
+		job->bmp.scan0 = NULL;
+
+		Png_MakeDecodedStream(&stream, &png, &src);
+		Event_RaiseEntry(&TextureEvents.FileChanged, &stream, &name);
+		/* Free bitmap if no handler used it */
+		Mem_Free(png.bmp.scan0);
+	} else {
+		Event_RaiseEntry(&TextureEvents.FileChanged, &src, &name);
+	}
+
+	extract.delivering = false;
+	if (!job->data) {
+		if (lazy.res) Logger_SysWarn2(lazy.res, "extracting", &path);
+		Mem_Free(lazy.data);
+	}
+
+	ExtractJob_Free(job);
+	Mutex_Lock(extract.mutex);
+	{
+		job->status = EXTRACT_JOB_FREE;
+		extract.delivered++;
+	}
+	Mutex_Unlock(extract.mutex);
+	Waitable_Signal(extract.workWaitable);
+	return true;
+}
+
+/* Stops all the worker threads, then frees all the state */
+static void ExtractZip_Free(void) {
+	int i;
+	Mutex_Lock(extract.mutex);
+	{
+		extract.stopping = true;
+	}
+	Mutex_Unlock(extract.mutex);
+	Waitable_Signal(extract.workWaitable);
+
+	for (i = 0; i < EXTRACT_WORKERS; i++) {
+		if (extract.threads[i]) Thread_Join(extract.threads[i]);
+	}
+	for (i = 0; i < EXTRACT_MAX_JOBS; i++) {
+		ExtractJob_Free(&extract.jobs[i]);
+	}
+
+	DecodedCache_Close(&extract.cache);
+	ZipIndex_Free(&extract.index);
+	Mutex_Free(extract.mutex);
+	Mutex_Free(extract.ioMutex);
+	Waitable_Free(extract.workWaitable);
+	Waitable_Free(extract.doneWaitable);
+	Mem_Set(&extract, 0, sizeof(extract));
+}
+
+/* Starts extracting the entries of the given archive on the worker threads */
+/* NOTE: You MUST call ExtractZip_Free afterwards, even if this returns an error. */
+static cc_result ExtractZip_Begin(struct Stream* stream) {
+	cc_result res;
+	int i;
+
+	extract.active = true;
+	extract.mutex        = Mutex_Create();
+	extract.ioMutex    = Mutex_Create();
+	extract.workWaitable = Waitable_Create();
+	extract.doneWaitable = Waitable_Create();
+
+	if ((res = ZipIndex_Load(&extract.index, stream))) return res;
+	if (!DecodedCache_Open(&extract.cache, &extract.index)) {
+		DecodedCache_Create(&extract.cache, &extract.index);
+	}
+
+	for (i = 0; i < EXTRACT_WORKERS; i++) {
+		extract.threads[i] = Thread_Start(ExtractWorker_Main);
+	}
+	return 0;
+}
+
+/* Finishes writing the cache file for the archive, then frees all the state */
+static void ExtractZip_End(void) {
+	DecodedCache_Finish(&extract.cache, &extract.index, !extract.failed);
+	ExtractZip_Free();
+}
+
+static cc_result ExtractZip(struct Stream* stream) {
+	cc_result res;
+	/* e.g. texture pack changed by event handler while extracting */
+	if (extract.active) return ExtractZipSerial(stream);
+
+	if ((res = ExtractZip_Begin(stream))) {
+		ExtractZip_Free(); return res;
+	}
+	while (extract.delivered < extract.index.count) { ExtractJob_Deliver(true); }
+
+	ExtractZip_End();
+	return 0;
+}
+#endif
+
 static cc_result ExtractPng(struct Stream* stream) {
 	struct Bitmap bmp;
 	cc_result res = Png_Decode(&bmp, stream);
@@ -314,14 +1011,19 @@ static cc_result ExtractPng(struct Stream* stream) {
 }
 
 static cc_bool needReload;
-static void ExtractFrom(struct Stream* stream, const cc_string* path) {
-	cc_result res;
-
+/* Raises PackChanged event, then returns whether the texture pack's files can be loaded */
+static cc_bool BeginExtract(void) {
 	Event_RaiseVoid(&TextureEvents.PackChanged);
 	/* If context is lost, then trying to load textures will just fail */
 	/* So defer loading the texture pack until context is restored */
-	if (Gfx.LostContext) { needReload = true; return; }
+	if (Gfx.LostContext) { needReload = true; return false; }
 	needReload = false;
+	return true;
+}
+
+static void ExtractFromNow(struct Stream* stream, const cc_string* path) {
+	cc_result res;
+	if (!BeginExtract()) return;
 
 	if (String_ContainsConst(path, ".zip")) {
 		res = ExtractZip(stream);
@@ -332,6 +1034,151 @@ static void ExtractFrom(struct Stream* stream, const cc_string* path) {
 	}
 }
 
+static void CloseSource(struct Stream* stream, const cc_string* path, void* data) {
+	cc_result res = stream->Close(stream);
+	if (res) Logger_SysWarn2(res, "closing", path);
+	Mem_Free(data);
+}
+
+#ifdef CC_BUILD_WEB
+/* NOTE: Takes ownership of the stream and data, and closes/frees them once extracted */
+static void ExtractFrom(struct Stream* stream, const cc_string* path, void* data) {
+	ExtractFromNow(stream, path);
+	CloseSource(stream, path, data);
+}
+
+void TexturePack_ApplyExtracted(void) { }
+static void ClearQueuedPacks(void) { }
+static void CloseQueuedPacks(const cc_string* url) { }
+#else
+/* Texture packs to extract in the background, where the first one is currently being extracted */
+/* The main thread then applies the extracted files over several frames, instead of freezing */
+#define MAX_QUEUED_PACKS 4
+/* Maximum time spent applying extracted files each frame */
+#define APPLY_MAX_MICROSECONDS 4000
+
+struct QueuedPack {
+	struct Stream stream;
+	void* data; /* Data of the texture pack, if not being read from a file */
+	char path[FILENAME_SIZE];
+	int pathLength;
+};
+static struct QueuedPack queuedPacks[MAX_QUEUED_PACKS];
+static int queuedCount;
+static cc_bool extractingQueued;
+/* Whether packs must be extracted right away, e.g. because the context was recreated */
+static cc_bool extractNow;
+
+static void QueuedPack_RemoveAt(int index) {
+	struct QueuedPack* pack = &queuedPacks[index];
+	cc_string path = String_Init(pack->path, pack->pathLength, FILENAME_SIZE);
+	int i;
+	CloseSource(&pack->stream, &path, pack->data);
+
+	for (i = index + 1; i < queuedCount; i++) { queuedPacks[i - 1] = queuedPacks[i]; }
+	queuedCount--;
+}
+static void QueuedPack_Remove(void) { QueuedPack_RemoveAt(0); }
+
+/* Starts extracting the oldest queued texture pack, returning false if there aren't any */
+static cc_bool QueuedPack_Start(void) {
+	cc_string path;
+	cc_result res;
+
+	while (queuedCount) {
+		path = String_Init(queuedPacks[0].path, queuedPacks[0].pathLength, FILENAME_SIZE);
+		if (BeginExtract()) {
+			res = ExtractZip_Begin(&queuedPacks[0].stream);
+			if (!res) { extractingQueued = true; return true; }
+
+			Logger_SysWarn2(res, "extracting", &path);
+			ExtractZip_Free();
+		}
+		QueuedPack_Remove();
+	}
+	return false;
+}
+
+/* Applies the files of the queued texture packs which have been extracted */
+/* NOTE: If all is true, waits for all the queued texture packs to be fully extracted and applied */
+static void ApplyQueuedPacks(cc_bool all) {
+	cc_uint64 beg = Stopwatch_Measure(), end;
+
+	for (;;) {
+		if (!extractingQueued && !QueuedPack_Start()) return;
+
+		if (extract.delivered == extract.index.count) {
+			ExtractZip_End();
+			extractingQueued = false;
+			QueuedPack_Remove();
+			continue;
+		}
+
+		if (!ExtractJob_Deliver(all)) return;
+		end = Stopwatch_Measure();
+		if (!all && Stopwatch_ElapsedMicroseconds(beg, end) >= APPLY_MAX_MICROSECONDS) return;
+	}
+}
+
+void TexturePack_ApplyExtracted(void) {
+	/* Applying textures will just fail when context is lost */
+	if (Gfx.LostContext) return;
+	ApplyQueuedPacks(false);
+}
+
+static void ClearQueuedPacks(void) {
+	if (extractingQueued) ExtractZip_Free();
+	extractingQueued = false;
+	while (queuedCount) { QueuedPack_Remove(); }
+}
+
+/* Closes the queued texture packs which are still reading the cached data for the given URL */
+/* NOTE: These would be outdated by the newly downloaded texture pack anyways */
+static void CloseQueuedPacks(const cc_string* url) {
+	cc_string path, key;
+	int i;
+	/* Path of a queued texture pack gets truncated when the URL is really long */
+	key = String_UNSAFE_Substring(url, 0, min(url->length, FILENAME_SIZE));
+
+	for (i = queuedCount - 1; i >= 0; i--) {
+		path = String_Init(queuedPacks[i].path, queuedPacks[i].pathLength, FILENAME_SIZE);
+		if (queuedPacks[i].data || !String_Equals(&path, &key)) continue;
+		/* Can't stop the texture pack currently being applied by an event handler */
+		if (i == 0 && extractingQueued && extract.delivering) continue;
+
+		if (i == 0 && extractingQueued) {
+			ExtractZip_Free();
+			extractingQueued = false;
+		}
+		QueuedPack_RemoveAt(i);
+	}
+}
+
+/* NOTE: Takes ownership of the stream and data, and closes/frees them once extracted */
+static void ExtractFrom(struct Stream* stream, const cc_string* path, void* data) {
+	struct QueuedPack* pack;
+	/* When there's no textures to keep showing in the meantime (e.g. when starting the game), */
+	/*  might as well just extract the texture pack right away */
+	cc_bool async = Atlas2D.Bmp.scan0 && !extractNow && String_ContainsConst(path, ".zip");
+
+	if (async && queuedCount == MAX_QUEUED_PACKS && !extract.delivering) ApplyQueuedPacks(true);
+	if (async && queuedCount <  MAX_QUEUED_PACKS) {
+		pack = &queuedPacks[queuedCount++];
+		pack->stream = *stream;
+		pack->data   = data;
+		String_CopyToRaw(pack->path, FILENAME_SIZE, path);
+		pack->pathLength = min(path->length, FILENAME_SIZE);
+		return;
+	}
+
+	/* Earlier texture packs must be applied first, unless an event handler */
+	/*  changed the texture pack while one of their files was being applied */
+	if (!extract.delivering) ApplyQueuedPacks(true);
+	ExtractFromNow(stream, path);
+	CloseSource(stream, path, data);
+}
+#endif
+
 static void ExtractFromFile(const cc_string* filename) {
 	cc_string path; char pathBuffer[FILENAME_SIZE];
 	struct Stream stream;
@@ -345,12 +1192,9 @@ static void ExtractFromFile(const cc_string* filename) {
 		/* Game shows a dialog if default.zip is missing */
 		Game_DefaultZipMissing |= res == ReturnCode_FileNotFound
 					&& String_CaselessEquals(filename, &defaultZip);
-		Logger_SysWarn2(res, "opening", &path); return; 
+		Logger_SysWarn2(res, "opening", &path); return;
 	}
-
-	ExtractFrom(&stream, &path);
-	res = stream.Close(&stream);
-	if (res) { Logger_SysWarn2(res, "closing", &path); }
+	ExtractFrom(&stream, &path, NULL);
 }
 
 static void ExtractDefault(void) {
@@ -365,7 +1209,6 @@ static cc_bool usingDefault;
 void TexturePack_ExtractCurrent(cc_bool forceReload) {
 	cc_string url = TexturePack_Url;
 	struct Stream stream;
-	cc_result res;
 
 	/* don't pointlessly load default texture pack */
 	if (!usingDefault || forceReload) {
@@ -374,27 +1217,56 @@ void TexturePack_ExtractCurrent(cc_bool forceReload) {
 	}
 
 	if (url.length && OpenCachedData(&url, &stream)) {
-		ExtractFrom(&stream, &url);
+		ExtractFrom(&stream, &url, NULL);
 		usingDefault = false;
-
-		res = stream.Close(&stream);
-		if (res) Logger_SysWarn2(res, "closing cache for", &url);
 	}
 }
 
+/* Replaces the cached data with the texture pack the http worker streamed into the temp file */
+static cc_bool ReplaceCachedData(const cc_string* url, int reqID) {
+	cc_string path; char pathBuffer[FILENAME_SIZE];
+	cc_string tmp;  char tmpBuffer[FILENAME_SIZE];
+	cc_result res;
+
+	String_InitArray(path, pathBuffer);
+	MakeCachePath(&path, url);
+	String_InitArray(tmp, tmpBuffer);
+	MakeCacheTempPath(&tmp, url, reqID);
+
+	/* Cache file can't be replaced on Windows while it's still open */
+	CloseQueuedPacks(url);
+	res = File_Rename(&tmp, &path);
+	if (res) { Logger_SysWarn2(res, "caching", url); return false; }
+	return true;
+}
+
 /* Extracts and updates cache for the downloaded texture pack */
 static void ApplyDownloaded(struct HttpRequest* item) {
-	struct Stream mem;
+	struct Stream stream;
 	cc_string url;
-
 	url = String_FromRawArray(item->url);
+
+	/* Data was already streamed into the temp file by the http worker */
+	if (!item->data) {
+		if (!ReplaceCachedData(&url, item->id)) return;
+		UpdateCachedTags(item);
+		if (!String_Equals(&TexturePack_Url, &url)) return;
+		if (!OpenCachedData(&url, &stream)) return;
+
+		ExtractFrom(&stream, &url, NULL);
+		usingDefault = false;
+		return;
+	}
+
 	UpdateCache(item);
 	/* Took too long to download and is no longer active texture pack */
 	if (!String_Equals(&TexturePack_Url, &url)) return;
 
-	Stream_ReadonlyMemory(&mem, item->data, item->size);
-	ExtractFrom(&mem, &url);
-	usingDefault = false;
+	/* Texture pack might be extracted in the background, so take ownership of the data */
+	Stream_ReadonlyMemory(&stream, item->data, item->size);
+	ExtractFrom(&stream, &url, item->data);
+	item->data    = NULL;
+	usingDefault  = false;
 }
 
 void TexturePack_CheckPending(void) {
@@ -426,7 +1298,7 @@ static void DownloadAsync(const cc_string* url) {
 	}
 
 	Http_TryCancel(TexturePack_ReqID);
-	TexturePack_ReqID = Http_AsyncGetDataEx(url, true, &time, &etag, NULL);
+	TexturePack_ReqID = Http_AsyncGetDataStreamed(url, true, &time, &etag, CacheWriter_New());
 }
 
 void TexturePack_Extract(const cc_string* url) {
@@ -462,11 +1334,19 @@ static void OnContextLost(void* obj) {
 
 static void OnContextRecreated(void* obj) {
 	if (!Gfx.ManagedTextures || needReload) {
+#ifndef CC_BUILD_WEB
+		/* Textures were lost, so there's nothing to keep showing while extracting */
+		extractNow = true;
+		TexturePack_ExtractCurrent(true);
+		extractNow = false;
+#else
 		TexturePack_ExtractCurrent(true);
+#endif
 	}
 }
 
 static void OnInit(void) {
+	static const cc_string cacheDir = String_FromConst("texturecache");
 	Event_Register_(&TextureEvents.FileChanged,  NULL, OnFileChanged);
 	Event_Register_(&GfxEvents.ContextLost,      NULL, OnContextLost);
 	Event_Register_(&GfxEvents.ContextRecreated, NULL, OnContextRecreated);
@@ -475,6 +1355,7 @@ static void OnInit(void) {
 	Utils_EnsureDirectory("texpacks");
 	Utils_EnsureDirectory("texturecache");
 	TextureCache_Init();
+	Directory_Enum(&cacheDir, NULL, DeleteCacheTempFile);
 }
 
 static void OnReset(void) {
@@ -484,6 +1365,7 @@ static void OnReset(void) {
 }
 
 static void OnFree(void) {
+	ClearQueuedPacks();
 	OnContextLost(NULL);
 	Atlas2D_Free();
 	TexturePack_Url.length = 0;
@@ -94,6 +94,9 @@ void TexturePack_SetDefault(const cc_string* texPack);
 /* If TexturePack_Url is empty, extracts user's default texture pack. */
 /* Otherwise extracts the cached texture pack for that URL. */
 void TexturePack_ExtractCurrent(cc_bool forceReload);
+/* Applies files of texture packs which have been extracted in the background. */
+/* NOTE: Stops after a few milliseconds, so applying a large texture pack is spread over several frames. */
+void TexturePack_ApplyExtracted(void);
 /* Checks if the texture pack currently being downloaded has completed. */
 /* If completed, then applies the downloaded texture pack and updates cache */
 void TexturePack_CheckPending(void);
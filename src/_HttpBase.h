@@ -16,6 +16,17 @@ static void HttpRequest_Free(struct HttpRequest* request) {
 	request->size = 0;
 }
 
+/* Lets the consumer (if any) know that the request has finished */
+static void HttpRequest_FinishConsumer(struct HttpRequest* req) {
+	struct HttpConsumer* consumer = req->consumer;
+	cc_result res;
+	if (!consumer) return;
+
+	req->consumer = NULL;
+	res = consumer->Finish(consumer, req);
+	if (!req->result) req->result = res;
+}
+
 /*########################################################################################################################*
 *----------------------------------------------------Http requests list---------------------------------------------------*
 *#########################################################################################################################*/
@@ -33,21 +44,23 @@ static void RequestList_EnsureSpace(struct RequestList* list) {
 				sizeof(struct HttpRequest), HTTP_DEF_ELEMS, 10);
 }
 
-/* Adds a request to the list */
-static void RequestList_Append(struct RequestList* list, struct HttpRequest* item, cc_bool atFront) {
-	int i;
+/* Adds a request to the end of the list */
+static void RequestList_Append(struct RequestList* list, struct HttpRequest* item) {
 	RequestList_EnsureSpace(list);
+	list->entries[list->count++] = *item;
+}
 
-	if (atFront) {
-		/* Shift all requests right one place */
-		for (i = list->count; i > 0; i--) {
-			list->entries[i] = list->entries[i - 1];
-		}
-		/* Insert new request at start */
-		i = 0;
-	} else {
-		/* Insert new request at end */
-		i = list->count;
+/* Inserts a request after all the requests in the list with the same or higher priority */
+static void RequestList_Enqueue(struct RequestList* list, struct HttpRequest* item) {
+	int i, j;
+	RequestList_EnsureSpace(list);
+
+	for (i = 0; i < list->count; i++) {
+		if (list->entries[i].priority < item->priority) break;
+	}
+	/* Shift lower priority requests right one place */
+	for (j = list->count; j > i; j--) {
+		list->entries[j] = list->entries[j - 1];
 	}
 
 	list->entries[i] = *item;
@@ -80,9 +93,40 @@ static void RequestList_TryFree(struct RequestList* list, int id) {
 	if (i < 0) return;
 
 	Mem_Free(list->entries[i].data);
+	HttpRequest_FinishConsumer(&list->entries[i]);
 	RequestList_RemoveAt(list, i);
 }
 
+/* Returns the [server name]:[server port] part of the request's URL */
+static cc_string Http_GetHost(struct HttpRequest* req) {
+	cc_string url = String_FromRawArray(req->url);
+	int i = String_IndexOfConst(&url, "://");
+
+	if (i >= 0) url = String_UNSAFE_SubstringAt(&url, i + 3);
+	i = String_IndexOf(&url, '/');
+	if (i >= 0) url.length = i;
+	return url;
+}
+
+/* Finds index of the first request in the list whose host has less than 'hostLimit' requests in progress */
+/* Returns -1 if every request in the list is waiting on a host that's at the limit */
+static int RequestList_NextRunnable(struct RequestList* list, struct HttpRequest** active, int activeCount, int hostLimit) {
+	cc_string host, other;
+	int i, j, count;
+
+	for (i = 0; i < list->count; i++) {
+		host  = Http_GetHost(&list->entries[i]);
+		count = 0;
+
+		for (j = 0; j < activeCount; j++) {
+			other = Http_GetHost(active[j]);
+			if (String_CaselessEquals(&host, &other)) count++;
+		}
+		if (count < hostLimit) return i;
+	}
+	return -1;
+}
+
 /* Resets state to default */
 static void RequestList_Init(struct RequestList* list) {
 	list->capacity = HTTP_DEF_ELEMS;
@@ -92,6 +136,10 @@ static void RequestList_Init(struct RequestList* list) {
 
 /* Frees any dynamically allocated memory, then resets state to default */
 static void RequestList_Free(struct RequestList* list) {
+	int i;
+	for (i = 0; i < list->count; i++) {
+		HttpRequest_FinishConsumer(&list->entries[i]);
+	}
 	if (list->entries != list->defaultEntries) Mem_Free(list->entries);
 	RequestList_Init(list);
 }
@@ -103,11 +151,12 @@ static void RequestList_Free(struct RequestList* list) {
 static void* processedMutex;
 static struct RequestList processedReqs;
 static int nextReqID;
-static void HttpBackend_Add(struct HttpRequest* req, cc_bool priority);
+static void HttpBackend_Add(struct HttpRequest* req);
 
 /* Adds a req to the list of pending requests, waking up worker thread if needed. */
-static int Http_Add(const cc_string* url, cc_bool priority, cc_uint8 type, const cc_string* lastModified,
-					const cc_string* etag, const void* data, cc_uint32 size, struct StringsBuffer* cookies) {
+static int Http_Add(const cc_string* url, cc_uint8 priority, cc_uint8 type, const cc_string* lastModified,
+					const cc_string* etag, const void* data, cc_uint32 size, struct StringsBuffer* cookies, cc_bool diskCache,
+					struct HttpConsumer* consumer) {
 	static const cc_string https = String_FromConst("https://");
 	static const cc_string http  = String_FromConst("http://");
 	struct HttpRequest req = { 0 };
@@ -117,6 +166,9 @@ static int Http_Add(const cc_string* url, cc_bool priority, cc_uint8 type, const
 
 	req.id = ++nextReqID;
 	req.requestType = type;
+	req.priority    = priority;
+	req.diskCache   = diskCache;
+	req.consumer    = consumer;
 
 	/* Change http:// to https:// if required */
 	if (httpsOnly) {
@@ -144,7 +196,7 @@ static int Http_Add(const cc_string* url, cc_bool priority, cc_uint8 type, const
 	req.cookies  = cookies;
 	req.progress = HTTP_PROGRESS_NOT_WORKING_ON;
 
-	HttpBackend_Add(&req, priority);
+	HttpBackend_Add(&req);
 	return req.id;
 }
 
@@ -171,13 +223,14 @@ static void Http_GetUrl(struct HttpRequest* req, cc_string* dst) {
 
 /* Updates state after a completed http request */
 static void Http_FinishRequest(struct HttpRequest* req) {
-	req->success = !req->result && req->statusCode == 200 && req->data && req->size;
+	/* NOTE: data is NULL when it was passed to a consumer instead */
+	req->success = !req->result && req->statusCode == 200 && req->size;
 	if (!req->success) HttpRequest_Free(req);
 
 	Mutex_Lock(processedMutex);
 	{
 		req->timeDownloaded = DateTime_CurrentUTC_MS();
-		RequestList_Append(&processedReqs, req, false);
+		RequestList_Append(&processedReqs, req);
 	}
 	Mutex_Unlock(processedMutex);
 }
@@ -214,20 +267,28 @@ int Http_AsyncGetSkin(const cc_string* skinName) {
 	} else {
 		String_Format1(&url, SKINS_SERVER "/%s.png", skinName);
 	}
-	return Http_AsyncGetData(&url, false);
+	/* Skins shouldn't hold up anything else, e.g. when joining a server with hundreds of players */
+	return Http_Add(&url, HTTP_PRIORITY_LOW, REQUEST_TYPE_GET, NULL, NULL, NULL, 0, NULL, true, NULL);
 }
 
+#define Http_Priority(priority) ((priority) ? HTTP_PRIORITY_HIGH : HTTP_PRIORITY_NORMAL)
 int Http_AsyncGetData(const cc_string* url, cc_bool priority) {
-	return Http_Add(url, priority, REQUEST_TYPE_GET, NULL, NULL, NULL, 0, NULL);
+	return Http_Add(url, Http_Priority(priority), REQUEST_TYPE_GET, NULL, NULL, NULL, 0, NULL, false, NULL);
+}
+int Http_AsyncGetCachedData(const cc_string* url, cc_bool priority) {
+	return Http_Add(url, Http_Priority(priority), REQUEST_TYPE_GET, NULL, NULL, NULL, 0, NULL, true, NULL);
 }
 int Http_AsyncGetHeaders(const cc_string* url, cc_bool priority) {
-	return Http_Add(url, priority, REQUEST_TYPE_HEAD, NULL, NULL, NULL, 0, NULL);
+	return Http_Add(url, Http_Priority(priority), REQUEST_TYPE_HEAD, NULL, NULL, NULL, 0, NULL, false, NULL);
 }
 int Http_AsyncPostData(const cc_string* url, cc_bool priority, const void* data, cc_uint32 size, struct StringsBuffer* cookies) {
-	return Http_Add(url, priority, REQUEST_TYPE_POST, NULL, NULL, data, size, cookies);
+	return Http_Add(url, Http_Priority(priority), REQUEST_TYPE_POST, NULL, NULL, data, size, cookies, false, NULL);
 }
 int Http_AsyncGetDataEx(const cc_string* url, cc_bool priority, const cc_string* lastModified, const cc_string* etag, struct StringsBuffer* cookies) {
-	return Http_Add(url, priority, REQUEST_TYPE_GET, lastModified, etag, NULL, 0, cookies);
+	return Http_Add(url, Http_Priority(priority), REQUEST_TYPE_GET, lastModified, etag, NULL, 0, cookies, false, NULL);
+}
+int Http_AsyncGetDataStreamed(const cc_string* url, cc_bool priority, const cc_string* lastModified, const cc_string* etag, struct HttpConsumer* consumer) {
+	return Http_Add(url, Http_Priority(priority), REQUEST_TYPE_GET, lastModified, etag, NULL, 0, NULL, false, consumer);
 }
 
 static cc_bool Http_UrlDirect(cc_uint8 c) {